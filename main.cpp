@@ -3,8 +3,14 @@
 #include "src/resource/resourceManager.h"
 #include "src/utils/logger.h"
 #include "src/utils/FileIO.h"
+#include "src/utils/Profiler.h"
+#include "src/utils/JobSystem.h"
+#include "src/utils/FrameArena.h"
+#include "src/utils/AllocationCounter.h"
 #include "src/utils/sdl_includes.h"
 #include <nlohmann/json.hpp>
+#include <cstdlib>
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -12,7 +18,7 @@
 #include <fcntl.h>
 #endif
 
-bool loadSettings(const std::string &filePath, int &width, int &height, int &windowWidth, int &windowHeight, std::string &resourceFile) {
+bool loadSettings(const std::string &filePath, EngineSettings &settings) {
     std::string content = FileIO::readFileAsText(filePath);
     if (content.empty()) {
         Log::error("[Main] Failed to open settings file: ", filePath);
@@ -20,19 +26,40 @@ bool loadSettings(const std::string &filePath, int &width, int &height, int &win
     }
     
     try {
-        nlohmann::json settings = nlohmann::json::parse(content);
+        nlohmann::json json = nlohmann::json::parse(content);
         
         // 내부 렌더링 해상도
-        width = settings.value("width", 800);
-        height = settings.value("height", 600);
+        settings.renderWidth = json.value("width", 800);
+        settings.renderHeight = json.value("height", 600);
         
         // 실제 창 크기 (지정하지 않으면 내부 해상도와 동일)
-        windowWidth = settings.value("window_width", width);
-        windowHeight = settings.value("window_height", height);
+        settings.windowWidth = json.value("window_width", settings.renderWidth);
+        settings.windowHeight = json.value("window_height", settings.renderHeight);
         
-        resourceFile = settings.value("resource_file", "resource.json");
+        settings.resourceFile = json.value("resource_file", "resource.json");
+
+        // 헤드리스 실행 (빌드 머신 등 디스플레이/GPU 없는 환경)
+        settings.headless = json.value("headless", false);
+        settings.headlessFrames = json.value("headless_frames", 0);
+        settings.fixedDeltaMs = json.value("fixed_delta_ms", 1000.0f / 60.0f);
+
+        // 프레임 프로파일러
+        settings.profiler = json.value("profiler", false);
+        settings.profileBudgetMs = json.value("profile_budget_ms", 0.0f);
+        settings.profileTraceFile = json.value("profile_trace_file", "profile_trace.json");
+
+        // 이미지 비동기 디코딩 / 업로드 예산
+        settings.imageDecodeThreads = json.value("image_decode_threads", 2);
+        settings.textRasterThreads = json.value("text_raster_threads", 1);
+        settings.jobThreads = json.value("job_threads", -1);
+        settings.textureUploadBudgetMs = json.value("texture_upload_budget_ms", 2.0f);
+        settings.scenePrefetchWaitMs = json.value("scene_prefetch_wait_ms", 250.0f);
+        settings.textureBudgetMb = json.value("texture_budget_mb", 256);
+        settings.textCacheMb = json.value("text_cache_mb", 16);
         
-        Log::info("[Main] Settings loaded - render: ", width, "x", height, ", window: ", windowWidth, "x", windowHeight, ", resource_file: ", resourceFile);
+        Log::info("[Main] Settings loaded - render: ", settings.renderWidth, "x", settings.renderHeight,
+                  ", window: ", settings.windowWidth, "x", settings.windowHeight,
+                  ", resource_file: ", settings.resourceFile);
         return true;
     } catch (const std::exception& e) {
         Log::error("[Main] Error parsing settings file: ", e.what());
@@ -40,6 +67,28 @@ bool loadSettings(const std::string &filePath, int &width, int &height, int &win
     }
 }
 
+// 커맨드라인 옵션으로 설정 덮어쓰기
+// --headless, --frames N, --delta MS, --profile
+static void applyCommandLine(int argc, char* argv[], EngineSettings &settings) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            settings.headless = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            settings.headlessFrames = std::atoi(argv[++i]);
+        } else if (arg == "--delta" && i + 1 < argc) {
+            settings.fixedDeltaMs = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--profile") {
+            settings.profiler = true;
+        } else {
+            Log::error("[Main] Unknown option: ", arg);
+        }
+    }
+    if (settings.fixedDeltaMs <= 0.0f) {
+        settings.fixedDeltaMs = 1000.0f / 60.0f;
+    }
+}
+
 int main(int argc, char* argv[]) {
 #ifdef _WIN32
     // Windows에서 콘솔 창 생성
@@ -55,33 +104,72 @@ int main(int argc, char* argv[]) {
 #endif
 
     // 설정 파일 로드
-    int renderWidth = 800;      // 내부 렌더링 해상도
-    int renderHeight = 600;
-    int windowWidth = 800;      // 실제 창 크기
-    int windowHeight = 600;
-    std::string resourceFile = "resource.json";
-    
-    if (!loadSettings("setting.json", renderWidth, renderHeight, windowWidth, windowHeight, resourceFile)) {
+    EngineSettings settings;
+    if (!loadSettings("setting.json", settings)) {
         Log::info("[Main] Using default settings");
     }
+    applyCommandLine(argc, argv, settings);
+
+    Profiler::setEnabled(settings.profiler);
+    Profiler::setFrameBudget(settings.profileBudgetMs);
 
-    SDL_Init(SDL_INIT_VIDEO);
-    SDL_Window* window = SDL_CreateWindow("App", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, windowWidth, windowHeight, SDL_WINDOW_SHOWN);
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    SDL_Window* window = nullptr;
+    SDL_Surface* offscreenSurface = nullptr;
+    SDL_Renderer* renderer = nullptr;
+
+    if (settings.headless) {
+        // 창 없이 이벤트 서브시스템만 초기화, 렌더링은 메모리 surface에 소프트웨어로
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        SDL_Init(SDL_INIT_EVENTS);
+        offscreenSurface = SDL_CreateRGBSurfaceWithFormat(0, settings.renderWidth, settings.renderHeight,
+                                                          32, SDL_PIXELFORMAT_RGBA32);
+        if (!offscreenSurface) {
+            Log::error("[Main] Failed to create offscreen surface: ", SDL_GetError());
+            SDL_Quit();
+            return 1;
+        }
+        renderer = SDL_CreateSoftwareRenderer(offscreenSurface);
+        Log::info("[Main] Headless mode - frames: ", settings.headlessFrames,
+                  ", fixed delta: ", settings.fixedDeltaMs, "ms");
+    } else {
+        SDL_Init(SDL_INIT_VIDEO);
+        window = SDL_CreateWindow("App", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+                                  settings.windowWidth, settings.windowHeight, SDL_WINDOW_SHOWN);
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
 
-    // 논리적 해상도 설정 - 게임은 항상 renderWidth x renderHeight로 렌더링하고, 실제 창 크기에 맞춰 자동 스케일링
-    SDL_RenderSetLogicalSize(renderer, renderWidth, renderHeight);
-    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "1");  // 1=linear filtering (부드러운 스케일링)
+        // 논리적 해상도 설정 - 게임은 항상 renderWidth x renderHeight로 렌더링하고, 실제 창 크기에 맞춰 자동 스케일링
+        SDL_RenderSetLogicalSize(renderer, settings.renderWidth, settings.renderHeight);
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "1");  // 1=linear filtering (부드러운 스케일링)
+    }
+    if (!renderer) {
+        Log::error("[Main] Failed to create renderer: ", SDL_GetError());
+        if (offscreenSurface) SDL_FreeSurface(offscreenSurface);
+        if (window) SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
 
     SDL_SetHint(SDL_HINT_MOUSE_DOUBLE_CLICK_TIME, "250");  // mouse click time limit
     SDL_SetHint(SDL_HINT_MOUSE_DOUBLE_CLICK_RADIUS, "10"); // mouse click loc limit
 
+    // 디코드/텍스트 큐는 자기 스레드를 따로 두므로 기본 잡 워커 수에서 뺌 (코어 과점유 방지)
+    const int textRasterThreads = settings.headless ? 0 : settings.textRasterThreads;
+    JobSystem::start(settings.jobThreads,
+                     std::max(0, settings.imageDecodeThreads) + std::max(0, textRasterThreads));
+
     // ResourceManager 생성
     ResourceManager resourceManager(renderer);
-    resourceManager.loadResources(resourceFile);
+    resourceManager.setDecodeThreadCount(settings.imageDecodeThreads);
+    // 헤드리스는 라벨이 나타나는 프레임이 스레드 타이밍에 좌우되지 않도록 텍스트를 동기로 그림
+    resourceManager.setTextRasterThreadCount(textRasterThreads);
+    resourceManager.setTextureBudget(static_cast<size_t>(std::max(0, settings.textureBudgetMb)) * 1024 * 1024);
+    resourceManager.setTextCacheBudget(static_cast<size_t>(std::max(0, settings.textCacheMb)) * 1024 * 1024);
+    resourceManager.loadResources(settings.resourceFile);
 
     // Scene 생성 시 ResourceManager 전달
     Scene scene(renderer, &resourceManager);
+    // 헤드리스는 재현성을 위해 prefetch를 기다리지 않고 요청 다음 프레임에 바로 전환
+    scene.setPrefetchWaitLimit(settings.headless ? 0.0f : settings.scenePrefetchWaitMs);
 
     // ResourceManager에서 초기 씬 이름 가져오기
     std::string initialScene = resourceManager.getInitialScene();
@@ -91,10 +179,19 @@ int main(int argc, char* argv[]) {
     } else {
         Log::info("[Main] Loading initial scene: ", initialScene);
     }
+    // 워커들이 병렬로 디코딩하는 동안 loadScene이 필요한 이미지부터 받아 감
+    resourceManager.prefetchScene(initialScene);
     scene.loadScene(initialScene);
 
     using clock = std::chrono::high_resolution_clock;
     auto lastTime = clock::now();
+    auto runStart = lastTime;
+    int frameCount = 0;
+    long long totalDrawCalls = 0;  // 헤드리스 요약용 UI draw call / 배치 누계
+    long long totalBatches = 0;
+    // 헤드리스 요약용 힙 할당 수 (ENABLE_ALLOCATION_COUNTER 빌드에서만, 첫 프레임은 로딩이라 제외)
+    uint64_t steadyAllocations = 0;
+    int zeroAllocationFrames = 0;
 
     const float targetFrameTimeMs = 1000.0f / 60.0f;  // ≈ 16.67ms
 
@@ -102,19 +199,28 @@ int main(int argc, char* argv[]) {
     SDL_Event event;
 
     while (running) {
+        Profiler::beginFrame();
+        FrameArena::reset();  // 이전 프레임의 임시 데이터 폐기
+        const uint64_t allocationsAtStart = AllocationCounter::getCount();
         auto frameStart = clock::now();
-        std::chrono::duration<float, std::milli> delta = frameStart - lastTime;
-        float deltaTimeMs = delta.count();
-        
-        // 첫 프레임이나 deltaTime이 너무 크면 제한 (예: 100ms 이상이면 16.67ms로 제한)
-        if (deltaTimeMs > 100.0f) {
-            deltaTimeMs = targetFrameTimeMs;
+        float deltaTimeMs;
+        if (settings.headless) {
+            // 고정 시뮬레이션 시간으로 진행 (벽시계와 무관, 재현 가능)
+            deltaTimeMs = settings.fixedDeltaMs;
+        } else {
+            std::chrono::duration<float, std::milli> delta = frameStart - lastTime;
+            deltaTimeMs = delta.count();
+            
+            // 첫 프레임이나 deltaTime이 너무 크면 제한 (예: 100ms 이상이면 16.67ms로 제한)
+            if (deltaTimeMs > 100.0f) {
+                deltaTimeMs = targetFrameTimeMs;
+            }
         }
         
         lastTime = frameStart;
 
-        // 이벤트 처리
-        std::vector<SDL_Event> events;
+        // 이벤트 처리 (프레임 아레나에 쌓음)
+        std::pmr::vector<SDL_Event> events(FrameArena::resource());
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT)
                 running = false;
@@ -124,10 +230,39 @@ int main(int argc, char* argv[]) {
 
         SDL_RenderClear(renderer);
 
+        resourceManager.processUploads(settings.textureUploadBudgetMs);
+        JobSystem::drainMainThread();
         scene.keyPressed(events);
         scene.update(deltaTimeMs);
         scene.render();
-        SDL_RenderPresent(renderer);
+        if (settings.headless) {
+            totalDrawCalls += scene.getRenderStats().drawCalls;
+            totalBatches += scene.getRenderStats().batches;
+        }
+        {
+            PROFILE_SCOPE("SDL_RenderPresent");
+            SDL_RenderPresent(renderer);
+        }
+        Profiler::endFrame();
+        if (frameCount > 0) {
+            const uint64_t frameAllocations = AllocationCounter::getCount() - allocationsAtStart;
+            steadyAllocations += frameAllocations;
+            zeroAllocationFrames += frameAllocations == 0 ? 1 : 0;
+        }
+        frameCount++;
+
+        // Lua에서 Scene.quit() 호출 시 종료
+        if (scene.isQuitRequested()) {
+            running = false;
+        }
+
+        if (settings.headless) {
+            // 대기 없이 다음 프레임으로 (CPU가 허용하는 최대 속도)
+            if (settings.headlessFrames > 0 && frameCount >= settings.headlessFrames) {
+                running = false;
+            }
+            continue;
+        }
 
         // ⏳ 남은 시간만큼 대기해서 60fps 유지
         auto frameEnd = clock::now();
@@ -139,10 +274,38 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    if (settings.headless) {
+        std::chrono::duration<double, std::milli> total = clock::now() - runStart;
+        double avgMs = frameCount > 0 ? total.count() / frameCount : 0.0;
+        Log::info("[Main] Headless run finished - frames: ", frameCount,
+                  ", wall: ", total.count(), "ms, avg: ", avgMs, "ms/frame, ",
+                  (avgMs > 0.0 ? 1000.0 / avgMs : 0.0), " fps");
+        if (frameCount > 0) {
+            Log::info("[Main] UI draw calls: ", static_cast<double>(totalDrawCalls) / frameCount,
+                      "/frame, batches: ", static_cast<double>(totalBatches) / frameCount, "/frame");
+        }
+        TextureMemoryStats texStats = resourceManager.getTextureMemoryStats();
+        Log::info("[Main] Texture memory: ", texStats.residentBytes / 1024, "KB resident (", texStats.residentCount,
+                  " entries), ", texStats.dynamicBytes / 1024, "KB dynamic, ", texStats.evictionCount, " evictions");
+        Log::info("[Main] Frame arena: peak ", FrameArena::getPeakBytes() / 1024, "KB, capacity ",
+                  FrameArena::getCapacity() / 1024, "KB, ", FrameArena::getOverflowCount(), " overflow allocations");
+        if (AllocationCounter::isEnabled() && frameCount > 1) {
+            // 전역 operator new만 셈 (Lua/SDL/stb의 malloc은 제외)
+            Log::info("[Main] C++ heap allocations (operator new): ", static_cast<double>(steadyAllocations) / (frameCount - 1),
+                      "/frame after first frame, ", zeroAllocationFrames, "/", frameCount - 1, " frames with none");
+        }
+    }
+
+    if (Profiler::isEnabled() && !settings.profileTraceFile.empty()) {
+        Profiler::dumpChromeTrace(settings.profileTraceFile);
+    }
+
+    JobSystem::shutdown();
+    resourceManager.shutdownWorkers();
     SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
+    if (window) SDL_DestroyWindow(window);
+    if (offscreenSurface) SDL_FreeSurface(offscreenSurface);
     SDL_Quit();
 
     return 0;
 }
-
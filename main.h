@@ -6,6 +6,37 @@
 #include <string>
 #include <chrono>
 
-bool loadSettings(const std::string &filePath, int &width, int &height, std::string &resourceFile);
+// setting.json 에서 읽는 엔진 설정
+struct EngineSettings {
+    int renderWidth = 800;       // 내부 렌더링 해상도
+    int renderHeight = 600;
+    int windowWidth = 800;       // 실제 창 크기
+    int windowHeight = 600;
+    std::string resourceFile = "resource.json";
+
+    // 헤드리스 모드: 창/GPU 없이 오프스크린 소프트웨어 렌더러로 실행
+    bool headless = false;
+    int headlessFrames = 0;          // 실행할 프레임 수 (0이면 Lua Scene.quit() 호출까지)
+    float fixedDeltaMs = 1000.0f / 60.0f;  // 헤드리스 모드에서 프레임마다 진행할 시뮬레이션 시간
+
+    // 프레임 프로파일러 (Chrome trace_event JSON 덤프)
+    bool profiler = false;
+    float profileBudgetMs = 0.0f;    // 프레임이 이 시간을 넘으면 자동 덤프 (0이면 비활성)
+    std::string profileTraceFile = "profile_trace.json";  // 종료 시 덤프 경로
+
+    // 이미지 비동기 디코딩
+    int imageDecodeThreads = 2;          // 디코드 워커 수 (0이면 prefetch 비활성, 모두 동기 로드)
+    int textRasterThreads = 1;           // 텍스트 래스터화 워커 수 (0이면 위젯 텍스트를 메인 스레드에서 바로 그림)
+    float textureUploadBudgetMs = 2.0f;  // 프레임당 텍스처 업로드에 쓸 최대 시간
+
+    // 범용 잡 시스템 (애니메이션 평가, 리소스 파싱)
+    int jobThreads = -1;                 // 워커 수 (-1이면 코어 수 - 1, 0이면 모두 메인 스레드)
+    float scenePrefetchWaitMs = 250.0f;  // 씬 전환 시 prefetch 완료를 기다리는 최대 시간
+
+    int textureBudgetMb = 256;           // 텍스처 메모리 예산 (0이면 무제한)
+    int textCacheMb = 16;                // 반납된 텍스트 텍스처를 보관할 최대 크기 (0이면 보관 안 함)
+};
+
+bool loadSettings(const std::string &filePath, EngineSettings &settings);
 
 #endif // MAIN_H
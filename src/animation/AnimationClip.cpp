@@ -0,0 +1,149 @@
+#include "AnimationClip.h"
+#include <iostream>
+
+namespace {
+
+// JSON 스텝 하나를 빌더에 추가
+void addStep(Animator& builder, const nlohmann::json& step, const std::string& name) {
+    std::string type = step.value("type", "");
+    const size_t keyframeCount = builder.getKeyframes().size();
+
+    if (type == "scale") {
+        float fromScale = step.value("fromScale", 1.0f);
+        float toScale = step.value("toScale", 1.0f);
+        int durationMs = step.value("durationMs", 0);
+        builder.scale(fromScale, toScale, durationMs);
+    }
+    else if (type == "rotate") {
+        float fromDegree = step.value("fromDegree", 0.0f);
+        float toDegree = step.value("toDegree", 0.0f);
+        int durationMs = step.value("durationMs", 0);
+        builder.rotate(fromDegree, toDegree, durationMs);
+    }
+    else if (type == "move") {
+        int moveX = step.value("moveX", 0);
+        int moveY = step.value("moveY", 0);
+        int durationMs = step.value("durationMs", 0);
+        builder.move(moveX, moveY, durationMs);
+    }
+    else if (type == "moveTo") {
+        if (step.contains("fromX") && step.contains("fromY")) {
+            // 시작/끝 값 버전
+            int fromX = step.value("fromX", 0);
+            int fromY = step.value("fromY", 0);
+            int toX = step.value("toX", 0);
+            int toY = step.value("toY", 0);
+            int durationMs = step.value("durationMs", 0);
+            builder.moveTo(fromX, fromY, toX, toY, durationMs);
+        } else {
+            // 단일 값 버전 (현재 위치에서 시작) - 하지만 JSON에서는 from/to 모두 명시하므로 이 경우는 없을 것
+            int toX = step.value("toX", 0);
+            int toY = step.value("toY", 0);
+            int durationMs = step.value("durationMs", 0);
+            builder.moveTo(toX, toY, durationMs);
+        }
+    }
+    else if (type == "resize") {
+        int fromW = step.value("fromW", 0);
+        int fromH = step.value("fromH", 0);
+        int toW = step.value("toW", 0);
+        int toH = step.value("toH", 0);
+        int durationMs = step.value("durationMs", 0);
+        builder.resize(fromW, fromH, toW, toH, durationMs);
+    }
+    else if (type == "alpha") {
+        float fromAlpha = step.value("fromAlpha", 1.0f);
+        float toAlpha = step.value("toAlpha", 1.0f);
+        int durationMs = step.value("durationMs", 0);
+        builder.alpha(fromAlpha, toAlpha, durationMs);
+    }
+    else if (type == "changeTexture") {
+        std::string image = step.value("image", "");
+        if (!image.empty()) {
+            builder.changeTexture(image);
+        }
+    }
+    else if (type == "flipbook") {
+        // 스프라이트 시트 한 장의 프레임을 fps로 재생 (요소의 원본 영역만 바꿈)
+        std::string image = step.value("image", "");
+        std::string modeName = step.value("mode", "loop");
+        Animator::FlipbookMode mode = Animator::FlipbookMode::Loop;
+        if (!Animator::flipbookModeFromName(modeName, mode)) {
+            std::cerr << "[WARN] AnimationClip::compile(): Unknown flipbook mode '" << modeName << "' in " << name << std::endl;
+        }
+        if (image.empty()) {
+            std::cerr << "[WARN] AnimationClip::compile(): Flipbook step without image in " << name << std::endl;
+            return;
+        }
+        builder.flipbook(image, step.value("frameWidth", 0), step.value("frameHeight", 0), step.value("frames", 1),
+                         step.value("fps", 12.0f), mode, step.value("loops", 1));
+    }
+    else if (type == "delay") {
+        int durationMs = step.value("durationMs", 0);
+        builder.delay(durationMs);
+    }
+    else if (type == "setVisible" || type == "visible") {
+        bool visible = step.value("visible", true);
+        builder.setVisible(visible);
+    }
+    else if (type == "repeat") {
+        int count = step.value("count", 1);
+        builder.repeat(count);
+    }
+    else if (type == "group") {
+        // 하위 스텝을 동시에 시작 ("at": 그룹 시작 후 시작 시점 ms)
+        builder.group();
+        for (const auto& member : step.value("steps", nlohmann::json::array())) {
+            if (member.value("type", "") == "group") {
+                std::cerr << "[WARN] AnimationClip::compile(): Nested group is not supported in " << name << std::endl;
+                continue;
+            }
+            const size_t memberKeyframeCount = builder.getKeyframes().size();
+            builder.at(member.value("at", 0));
+            addStep(builder, member, name);
+            if (builder.getKeyframes().size() == memberKeyframeCount) {
+                builder.at(0);  // 거부된 스텝의 "at"이 다음 스텝에 붙지 않도록
+            }
+        }
+        builder.endGroup();
+        return;
+    }
+    else {
+        std::cerr << "[WARN] AnimationClip::compile(): Unknown step type '" << type << "' in " << name << std::endl;
+        return;
+    }
+
+    // 보간 곡선 ("ease": "outCubic" 등, 기본 선형). 스텝이 거부되어 키프레임이 없으면 앞 스텝을 건드리지 않음
+    if (step.contains("ease") && builder.getKeyframes().size() > keyframeCount) {
+        Easing::Type easeType;
+        std::string easeName = step.value("ease", "linear");
+        if (Easing::fromName(easeName, easeType)) {
+            builder.ease(easeType);
+        } else {
+            std::cerr << "[WARN] AnimationClip::compile(): Unknown ease '" << easeName << "' in " << name << std::endl;
+        }
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<const AnimationClip> AnimationClip::compile(const std::string& name, const nlohmann::json& steps) {
+    if (!steps.is_array()) {
+        std::cerr << "[ERROR] AnimationClip::compile(): Animation JSON is not a step array: " << name << std::endl;
+        return nullptr;
+    }
+
+    // Animator 빌더로 스텝을 키프레임으로 컴파일
+    Animator builder(name);
+    for (const auto& step : steps) {
+        addStep(builder, step, name);
+    }
+
+    auto clip = std::make_shared<AnimationClip>();
+    clip->name = name;
+    clip->keyframes = builder.getKeyframes();
+    clip->imageNames = builder.getImageNames();
+    clip->repeatCount = builder.getRepeatCount();
+    clip->durationMs = Animator::computeCycleMs(clip->keyframes);
+    return clip;
+}
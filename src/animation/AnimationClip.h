@@ -0,0 +1,31 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "Animator.h"
+
+/**
+ * 애니메이션 JSON(스텝 배열)을 한 번 컴파일한 불변 클립.
+ * ResourceManager::getAnimationClip이 이름별로 캐시하고, AnimationManager::play는 클립을 복사하지 않고
+ * 참조하는 트랙만 만든다 (같은 효과를 카드 50장에 걸어도 파싱/컴파일은 한 번).
+ * JSON으로는 콜백을 줄 수 없으므로 클립 키프레임에 CALLBACK은 없다.
+ */
+class AnimationClip {
+public:
+    // 스텝 배열이 아니면 nullptr. 알 수 없는 type은 경고 후 건너뜀
+    static std::shared_ptr<const AnimationClip> compile(const std::string& name, const nlohmann::json& steps);
+
+    const std::string& getName() const { return name; }
+    const std::vector<Animator::Keyframe>& getKeyframes() const { return keyframes; }
+    const std::vector<std::string>& getImageNames() const { return imageNames; }  // CHANGE_TEXTURE payload 인덱스
+    int getRepeatCount() const { return repeatCount; }
+    int getDurationMs() const { return durationMs; }  // 한 회차 길이
+
+private:
+    std::string name;
+    std::vector<Animator::Keyframe> keyframes;
+    std::vector<std::string> imageNames;
+    int repeatCount = 0;
+    int durationMs = 0;
+};
@@ -1,7 +1,8 @@
 #include "AnimationManager.h"
 #include "../resource/resourceManager.h"
-#include <nlohmann/json.hpp>
+#include "../utils/JobSystem.h"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 
 void AnimationManager::setUiManager(UiManager* uiMgr) {
@@ -12,99 +13,681 @@ void AnimationManager::setResourceManager(ResourceManager* resMgr) {
     this->resourceManager = resMgr;
 }
 
-void AnimationManager::add(const std::string& uiName, std::shared_ptr<Animator> animator) {
-    // 에러 체크: Animator가 null인지 확인
-    if (!animator) {
-        std::cerr << "[ERROR] AnimationManager::add(): Animator is null for UI element '" << uiName << "'!" << std::endl;
-        return;
+namespace {
+// advanceTrack이 돌려주는 "이번 프레임에 바뀐 속성" 비트
+constexpr uint32_t kAffectPosition = 1u << 0;
+constexpr uint32_t kAffectSize = 1u << 1;
+constexpr uint32_t kAffectRotation = 1u << 2;
+constexpr uint32_t kAffectAlpha = 1u << 3;
+constexpr uint32_t kAffectScale = 1u << 4;
+constexpr uint32_t kAffectVisible = 1u << 5;
+constexpr uint32_t kAffectTexture = 1u << 6;  // CHANGE_TEXTURE 스텝에 진입한 프레임에만
+constexpr uint32_t kAffectSheet = 1u << 7;    // FLIPBOOK 스텝에 진입한 프레임에만
+constexpr uint32_t kAffectFrame = 1u << 8;
+
+// 죽은 키프레임이 이 개수를 넘고 풀의 절반 이상일 때만 압축
+constexpr size_t kMinCompactKeyframes = 256;
+
+// 트랙이 이보다 많을 때만 진행을 워커로 나눔 (적으면 나누는 비용이 더 큼)
+constexpr size_t kMinParallelTracks = 256;
+constexpr size_t kParallelTrackBatch = 64;
+
+// Tracks::frameResult 비트
+constexpr uint8_t kFrameAdvanced = 1u << 0;
+constexpr uint8_t kFrameVisible = 1u << 1;
+constexpr uint8_t kFrameFinished = 1u << 2;
+
+uint32_t affectMask(Animator::Op op) {
+    switch (op) {
+        case Animator::Op::MOVE:
+        case Animator::Op::MOVE_TO: return kAffectPosition;
+        case Animator::Op::RESIZE: return kAffectSize;
+        case Animator::Op::ROTATE: return kAffectRotation;
+        case Animator::Op::ALPHA: return kAffectAlpha;
+        case Animator::Op::SCALE: return kAffectScale;
+        case Animator::Op::FLIPBOOK: return kAffectFrame;
+        default: return 0;
     }
-    
+}
+}
+
+size_t AnimationManager::Tracks::push() {
+    forEachColumn([](auto& column) { column.emplace_back(); });
+    return size() - 1;
+}
+
+void AnimationManager::Tracks::swapRemove(size_t index) {
+    forEachColumn([index](auto& column) {
+        if (index + 1 != column.size()) {
+            column[index] = std::move(column.back());
+        }
+        column.pop_back();
+    });
+}
+
+size_t AnimationManager::beginTrack(const std::string& uiName, int repeatCount) {
     // 에러 체크: UiManager가 설정되어 있는지 확인
     if (!uiManager) {
         std::cerr << "[ERROR] AnimationManager::add(): UiManager is not set!" << std::endl;
-        return;
+        return kNoTrack;
     }
     
     // 에러 체크: UI 요소를 찾을 수 있는지 확인
-    const UIElement* elem = uiManager->findElementByName(uiName);
+    ElementHandle handle = uiManager->findHandleByName(uiName);
+    const UIElement* elem = uiManager->getElement(handle);
     if (!elem) {
         std::cerr << "[ERROR] AnimationManager::add(): UI element '" << uiName << "' not found!" << std::endl;
         std::cerr << "  Make sure the UI element exists in the scene JSON file." << std::endl;
+        return kNoTrack;
+    }
+
+    size_t index = tracks.push();
+    tracks.uiNames[index] = uiName;
+    tracks.handles[index] = handle;
+    tracks.keyIndex[index] = 0;
+    tracks.repeatLeft[index] = repeatCount < 0 ? -1 : repeatCount;
+    tracks.elapsed[index] = 0.0f;
+    tracks.groupStarted[index] = 0;
+    tracks.paused[index] = 0;
+    tracks.speed[index] = 1.0f;
+    tracks.dead[index] = 0;
+    tracks.hasCallbacks[index] = 0;
+    tracks.frameResult[index] = 0;
+    tracks.imageIndex[index] = -1;
+    tracks.flipFrame[index] = 0;
+    tracks.flipShown[index] = -1;
+    tracks.flipbook[index] = FlipbookState();
+
+    // 트랙의 초기 상태를 UI 요소의 현재 상태로 설정
+    tracks.posX[index] = elem->rect.x;
+    tracks.posY[index] = elem->rect.y;
+    tracks.width[index] = elem->rect.w;
+    tracks.height[index] = elem->rect.h;
+    tracks.rotation[index] = elem->rotation;
+    tracks.alpha[index] = elem->alpha;
+    tracks.scale[index] = elem->scale;
+    saveCycleStart(index);
+    return index;
+}
+
+void AnimationManager::add(const std::string& uiName, std::shared_ptr<Animator> animator) {
+    // 에러 체크: Animator가 null인지 확인
+    if (!animator) {
+        std::cerr << "[ERROR] AnimationManager::add(): Animator is null for UI element '" << uiName << "'!" << std::endl;
         return;
     }
-    
-    // Animator의 초기 상태를 UI 요소의 현재 상태로 설정
-    animator->setInitialStateFromUI(*elem);
-    
-    animators.emplace_back(uiName, animator);
+
+    const std::vector<Keyframe>& source = animator->getKeyframes();
+    if (source.empty()) {
+        return;  // 재생할 스텝 없음
+    }
+
+    size_t index = beginTrack(uiName, animator->getRepeatCount());
+    if (index == kNoTrack) {
+        return;
+    }
+    tracks.sharedKeys[index] = 0;
+    tracks.keyBegin[index] = static_cast<uint32_t>(keyframes.size());
+    tracks.keyCount[index] = static_cast<uint32_t>(source.size());
+
+    // 키프레임을 풀로 복사하면서 payload를 매니저 테이블 인덱스로 바꿈
+    for (Keyframe key : source) {
+        if (key.op == Op::CHANGE_TEXTURE || key.op == Op::FLIPBOOK) {
+            key.payload = internImage(animator->getImageNames()[key.payload]);
+        } else if (key.op == Op::CALLBACK) {
+            int32_t slot;
+            if (!freeCallbackSlots.empty()) {
+                slot = freeCallbackSlots.back();
+                freeCallbackSlots.pop_back();
+            } else {
+                slot = static_cast<int32_t>(callbackSlots.size());
+                callbackSlots.emplace_back();
+            }
+            callbackSlots[slot] = animator->getCallbacks()[key.payload];
+            key.payload = slot;
+            tracks.hasCallbacks[index] = 1;
+        }
+        keyframes.push_back(key);
+    }
+    tracks.cycleMs[index] = Animator::computeCycleMs(source);
+}
+
+void AnimationManager::play(const std::string& uiName, const std::shared_ptr<const AnimationClip>& clip) {
+    if (!clip) {
+        std::cerr << "[ERROR] AnimationManager::play(): Clip is null for UI element '" << uiName << "'!" << std::endl;
+        return;
+    }
+    if (clip->getKeyframes().empty()) {
+        return;
+    }
+
+    // 이 매니저에서 처음 재생하는 클립이면 키프레임을 공유 구간으로 한 번 옮김 (이미지 이름 인턴)
+    auto rangeIt = clipRanges.find(clip.get());
+    if (rangeIt == clipRanges.end()) {
+        ClipRange range;
+        range.clip = clip;
+        range.begin = static_cast<uint32_t>(clipKeyframes.size());
+        range.count = static_cast<uint32_t>(clip->getKeyframes().size());
+        for (Keyframe key : clip->getKeyframes()) {
+            if (key.op == Op::CHANGE_TEXTURE || key.op == Op::FLIPBOOK) {
+                key.payload = internImage(clip->getImageNames()[key.payload]);
+            }
+            clipKeyframes.push_back(key);
+        }
+        rangeIt = clipRanges.emplace(clip.get(), std::move(range)).first;
+    }
+
+    size_t index = beginTrack(uiName, clip->getRepeatCount());
+    if (index == kNoTrack) {
+        return;
+    }
+    tracks.sharedKeys[index] = 1;
+    tracks.keyBegin[index] = rangeIt->second.begin;
+    tracks.keyCount[index] = rangeIt->second.count;
+    tracks.cycleMs[index] = clip->getDurationMs();
 }
 
 void AnimationManager::remove(const std::string& uiName) {
     // 해당 UI 요소의 모든 애니메이션 제거
-    animators.erase(
-        std::remove_if(animators.begin(), animators.end(),
-            [&uiName](const std::pair<std::string, std::shared_ptr<Animator>>& pair) {
-                return pair.first == uiName;
-            }),
-        animators.end()
-    );
+    for (size_t i = 0; i < tracks.size(); i++) {
+        if (!tracks.dead[i] && tracks.uiNames[i] == uiName) {
+            tracks.dead[i] = 1;
+            hasDeadTracks = true;
+        }
+    }
+    if (!updating && hasDeadTracks) {
+        compact();
+    }
 }
 
 void AnimationManager::update(float deltaTime) {
-    if (animators.empty()) return;
-    
-    // 콜백이 animation.add()/loadFromJson()을 호출하면 animators 벡터가 재할당되어
-    // 반복자가 무효화되므로, 복사본을 순회하고 종료된 것만 나중에 실제 목록에서 제거한다.
-    using Pair = std::pair<std::string, std::shared_ptr<Animator>>;
-    std::vector<Pair> snapshot(animators.begin(), animators.end());
-    
-    for (Pair& pair : snapshot) {
-        const std::string& name = pair.first;
-        std::shared_ptr<Animator>& animator = pair.second;
+    if (tracks.size() == 0) return;
+
+    // 콜백이 animation.add()/remove()를 호출할 수 있으므로 인덱스로만 접근하고,
+    // 이번 프레임에 추가된 트랙은 다음 프레임부터 진행한다. 제거는 표시만 하고 순회 후 정리.
+    updating = true;
+    const float scaledDelta = deltaTime * timeScale;
+    const size_t count = tracks.size();
+
+    // 콜백 없는 트랙은 자기 열만 쓰므로 먼저 워커들과 나눠 진행하고 결과만 기록 (UI 반영은 아래에서 메인 스레드가)
+    const bool parallel = count >= kMinParallelTracks && JobSystem::getWorkerCount() > 0;
+    if (parallel) {
+        JobSystem::parallelFor(count, kParallelTrackBatch, [this, scaledDelta](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                tracks.frameResult[i] = 0;
+                if (tracks.hasCallbacks[i] || tracks.dead[i] || tracks.paused[i]) continue;
+                bool visible = false;
+                bool finished = false;
+                tracks.frameAffected[i] = advanceTrack(i, scaledDelta * tracks.speed[i], visible, finished);
+                tracks.frameResult[i] = kFrameAdvanced | (visible ? kFrameVisible : 0) | (finished ? kFrameFinished : 0);
+            }
+        });
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        // 미리 진행한 트랙은 앞 트랙의 콜백이 pause해도 이미 진행한 결과는 반영
+        const bool preAdvanced = parallel && (tracks.frameResult[i] & kFrameAdvanced);
+        if (tracks.dead[i] || (tracks.paused[i] && !preAdvanced)) continue;
+
+        bool visible = false;
+        bool finished = false;
+        uint32_t affected;
+        if (preAdvanced) {
+            affected = tracks.frameAffected[i];
+            visible = (tracks.frameResult[i] & kFrameVisible) != 0;
+            finished = (tracks.frameResult[i] & kFrameFinished) != 0;
+        } else {
+            affected = advanceTrack(i, scaledDelta * tracks.speed[i], visible, finished);
+        }
+
+        // 🔧 UI에 반영 (콜백에서 제거되었거나 대상 요소가 제거되었으면 건너뜀)
+        if (affected != 0 && !tracks.dead[i] && uiManager) {
+            if (UIElement* element = uiManager->getElement(tracks.handles[i])) {
+                applyTrack(i, *element, affected, visible);
+            }
+        }
+        if (finished) {
+            tracks.dead[i] = 1;
+            hasDeadTracks = true;
+        }
+    }
+    updating = false;
+
+    // 🧹 종료/제거된 트랙 정리 (swap-remove)
+    if (hasDeadTracks) {
+        compact();
+    }
+}
+
+uint32_t AnimationManager::advanceTrack(size_t index, float deltaTime, bool& outVisible, bool& outFinished) {
+    uint32_t affected = 0;
+    float budget = deltaTime > 0.0f ? deltaTime : 0.0f;  // 끝난 그룹의 남은 시간은 다음 그룹으로 넘김
+    bool wrapped = false;
+
+    while (!tracks.dead[index]) {
+        if (tracks.keyIndex[index] >= tracks.keyCount[index]) {
+            // 회차 끝: 반복하거나 종료
+            if (tracks.repeatLeft[index] == 0) {
+                outFinished = true;
+                break;
+            }
+            // 길이 0인 회차(즉시 스텝뿐)의 무한 반복이 프레임을 붙잡지 않도록 한 프레임에 한 번만
+            if (wrapped && (tracks.cycleMs[index] == 0 || budget <= 0.0f)) {
+                break;
+            }
+            if (tracks.repeatLeft[index] > 0) {
+                tracks.repeatLeft[index]--;
+            }
+            tracks.keyIndex[index] = 0;
+            saveCycleStart(index);
+            wrapped = true;
+        }
+
+        if (!tracks.groupStarted[index]) {
+            beginGroup(index);
+        }
+        tracks.elapsed[index] += budget;
+        budget = 0.0f;
+
+        affected |= evaluateGroup(index, outVisible);
+        if (tracks.dead[index]) {
+            break;  // 콜백에서 제거됨
+        }
+
+        if (tracks.elapsed[index] < tracks.groupDuration[index]) {
+            break;
+        }
+        budget = tracks.elapsed[index] - tracks.groupDuration[index];
+        tracks.keyIndex[index] = tracks.groupEnd[index];
+        tracks.groupStarted[index] = 0;
+    }
+    return affected;
+}
+
+void AnimationManager::beginGroup(size_t index) {
+    // 현재 키프레임부터 withPrevious로 이어진 키프레임까지가 한 그룹
+    const uint32_t first = tracks.keyIndex[index];
+    uint32_t end = first + 1;
+    while (end < tracks.keyCount[index] && keyframeAt(index, end).withPrevious) {
+        end++;
+    }
+    float duration = 0.0f;
+    for (uint32_t k = first; k < end; k++) {
+        const Keyframe key = keyframeAt(index, k);
+        duration = std::max(duration, static_cast<float>(key.offset + key.duration));
+    }
+    tracks.groupStarted[index] = 1;
+    tracks.groupEnd[index] = end;
+    tracks.groupDuration[index] = duration;
+    tracks.elapsed[index] = 0.0f;
+    tracks.memberStarted[index] = 0;
+    tracks.memberDone[index] = 0;
+}
 
-        // 🔄 애니메이션 갱신 (내부에서 Lua 콜백 호출 가능 → animators 변경 가능)
-        animator->update(deltaTime);
+uint32_t AnimationManager::evaluateGroup(size_t index, bool& outVisible) {
+    uint32_t affected = 0;
+    const uint32_t first = tracks.keyIndex[index];
+    const uint32_t end = tracks.groupEnd[index];
 
-        // 🔧 UI에 반영
+    for (uint32_t k = first; k < end; k++) {
+        const uint32_t bit = 1u << (k - first);
+        if (tracks.memberDone[index] & bit) {
+            continue;  // 끝난 멤버는 마지막 값을 유지 (같은 속성의 뒤 멤버를 덮지 않도록 다시 평가하지 않음)
+        }
+        // 값으로 복사 (콜백이 add()를 부르면 풀이 재할당될 수 있음)
+        const Keyframe key = keyframeAt(index, k);
+        const float local = tracks.elapsed[index] - static_cast<float>(key.offset);
+        if (local < 0.0f) {
+            continue;  // 아직 시작 전
+        }
+
+        if (!(tracks.memberStarted[index] & bit)) {
+            tracks.memberStarted[index] |= bit;
+            if (Animator::isInstant(key.op)) {
+                tracks.memberDone[index] |= bit;
+                if (key.op == Op::CHANGE_TEXTURE) {
+                    tracks.imageIndex[index] = key.payload;
+                    affected |= kAffectTexture;
+                } else if (key.op == Op::SET_VISIBLE) {
+                    outVisible = key.payload != 0;
+                    affected |= kAffectVisible;
+                } else if (key.op == Op::CALLBACK && !seeking) {
+                    // deque 원소라 콜백 안에서 add()로 슬롯이 늘어나도 참조가 유지됨
+                    Animator::Callback& cb = callbackSlots[key.payload];
+                    if (cb) {
+                        cb();
+                    }
+                    if (tracks.dead[index]) {
+                        return affected;
+                    }
+                }
+                continue;
+            }
+            beginKeyframe(index, key);
+            if (key.op == Op::FLIPBOOK) {
+                affected |= kAffectSheet;
+            }
+        }
+
+        const float duration = static_cast<float>(key.duration);
+        const float t = duration > 0.0f ? std::min(1.0f, local / duration) : 1.0f;
+        evaluateKeyframe(index, key, Easing::evaluate(key.ease, t));
+        affected |= affectMask(key.op);
+        if (t >= 1.0f) {
+            tracks.memberDone[index] |= bit;
+        }
+    }
+    return affected;
+}
+
+void AnimationManager::beginKeyframe(size_t index, const Keyframe& key) {
+    // 💡 startDeferred면 시작값을 현재 상태에서 가져옴 (속성별 칸에 보관하므로 그룹 멤버끼리 섞이지 않음)
+    const bool deferred = key.startDeferred;
+    switch (key.op) {
+        case Op::ROTATE:
+            tracks.fromRotation[index] = deferred ? tracks.rotation[index] : key.from[0];
+            break;
+        case Op::MOVE:
+        case Op::MOVE_TO:
+            tracks.fromPosX[index] = deferred ? static_cast<float>(tracks.posX[index]) : key.from[0];
+            tracks.fromPosY[index] = deferred ? static_cast<float>(tracks.posY[index]) : key.from[1];
+            break;
+        case Op::RESIZE:
+            tracks.fromWidth[index] = deferred ? static_cast<float>(tracks.width[index]) : key.from[0];
+            tracks.fromHeight[index] = deferred ? static_cast<float>(tracks.height[index]) : key.from[1];
+            break;
+        case Op::ALPHA:
+            tracks.fromAlpha[index] = deferred ? tracks.alpha[index] : key.from[0];
+            break;
+        case Op::SCALE:
+            tracks.fromScale[index] = deferred ? tracks.scale[index] : key.from[0];
+            break;
+        case Op::FLIPBOOK: {
+            FlipbookState& flip = tracks.flipbook[index];
+            const int32_t frameW = static_cast<int32_t>(key.from[0]);
+            const int32_t frameH = static_cast<int32_t>(key.from[1]);
+            if (flip.imageIndex != key.payload || flip.frameW != frameW || flip.frameH != frameH) {
+                flip.imageIndex = key.payload;
+                flip.frameW = frameW;
+                flip.frameH = frameH;
+                flip.columns = 0;  // 시트 배치는 applyTrack에서 텍스처를 바꿀 때 채움
+            }
+            tracks.flipFrame[index] = 0;
+            tracks.flipShown[index] = -1;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void AnimationManager::evaluateKeyframe(size_t index, const Keyframe& key, float t) {
+    switch (key.op) {
+        case Op::ROTATE: {
+            const float from = tracks.fromRotation[index];
+            tracks.rotation[index] = from + (key.to[0] - from) * t;
+            break;
+        }
+        case Op::MOVE:  // to = 이동량
+            tracks.posX[index] = static_cast<int32_t>(tracks.fromPosX[index] + key.to[0] * t);
+            tracks.posY[index] = static_cast<int32_t>(tracks.fromPosY[index] + key.to[1] * t);
+            break;
+        case Op::MOVE_TO: {
+            const float fromX = tracks.fromPosX[index];
+            const float fromY = tracks.fromPosY[index];
+            tracks.posX[index] = static_cast<int32_t>(fromX + (key.to[0] - fromX) * t);
+            tracks.posY[index] = static_cast<int32_t>(fromY + (key.to[1] - fromY) * t);
+            break;
+        }
+        case Op::RESIZE: {
+            const float fromW = tracks.fromWidth[index];
+            const float fromH = tracks.fromHeight[index];
+            tracks.width[index] = static_cast<int32_t>(fromW + (key.to[0] - fromW) * t);
+            tracks.height[index] = static_cast<int32_t>(fromH + (key.to[1] - fromH) * t);
+            break;
+        }
+        case Op::ALPHA: {
+            const float from = tracks.fromAlpha[index];
+            tracks.alpha[index] = from + (key.to[0] - from) * t;
+            break;
+        }
+        case Op::SCALE: {
+            const float from = tracks.fromScale[index];
+            tracks.scale[index] = from + (key.to[0] - from) * t;
+            break;
+        }
+        case Op::FLIPBOOK: {  // from = 프레임 크기, to = (프레임 수, 프레임당 ms)
+            const int32_t frameCount = static_cast<int32_t>(key.to[0]);
+            const float frameMs = key.to[1];
+            const int32_t framesPerLoop = (key.flipbookMode == Animator::FlipbookMode::PingPong && frameCount > 1)
+                ? frameCount * 2 - 2 : frameCount;
+            const int32_t lastStep = std::max(0, static_cast<int32_t>(key.duration / frameMs + 0.5f) - 1);
+            const int32_t step = std::min(static_cast<int32_t>(t * key.duration / frameMs), lastStep);
+            const int32_t frame = step % framesPerLoop;
+            tracks.flipFrame[index] = frame < frameCount ? frame : framesPerLoop - frame;  // 핑퐁 되돌아오는 구간
+            break;
+        }
+        default:  // DELAY: 아무것도 하지 않음
+            break;
+    }
+}
+
+void AnimationManager::saveCycleStart(size_t index) {
+    TrackState& state = tracks.cycleStart[index];
+    state.posX = tracks.posX[index];
+    state.posY = tracks.posY[index];
+    state.width = tracks.width[index];
+    state.height = tracks.height[index];
+    state.rotation = tracks.rotation[index];
+    state.alpha = tracks.alpha[index];
+    state.scale = tracks.scale[index];
+}
+
+void AnimationManager::pause(const std::string& uiName) {
+    for (size_t i = 0; i < tracks.size(); i++) {
+        if (tracks.uiNames[i] == uiName) tracks.paused[i] = 1;
+    }
+}
+
+void AnimationManager::resume(const std::string& uiName) {
+    for (size_t i = 0; i < tracks.size(); i++) {
+        if (tracks.uiNames[i] == uiName) tracks.paused[i] = 0;
+    }
+}
+
+void AnimationManager::setSpeed(const std::string& uiName, float speed) {
+    speed = std::max(0.0f, speed);
+    for (size_t i = 0; i < tracks.size(); i++) {
+        if (tracks.uiNames[i] == uiName) tracks.speed[i] = speed;
+    }
+}
+
+void AnimationManager::setTimeScale(float scale) {
+    timeScale = std::max(0.0f, scale);
+}
+
+void AnimationManager::seek(const std::string& uiName, float timeMs) {
+    for (size_t i = 0; i < tracks.size(); i++) {
+        if (tracks.dead[i] || tracks.uiNames[i] != uiName) continue;
+
+        // 현재 회차 시작 상태로 되돌린 뒤 timeMs만큼 다시 진행 (콜백은 실행하지 않음)
+        const TrackState& state = tracks.cycleStart[i];
+        tracks.posX[i] = state.posX;
+        tracks.posY[i] = state.posY;
+        tracks.width[i] = state.width;
+        tracks.height[i] = state.height;
+        tracks.rotation[i] = state.rotation;
+        tracks.alpha[i] = state.alpha;
+        tracks.scale[i] = state.scale;
+        tracks.keyIndex[i] = 0;
+        tracks.groupStarted[i] = 0;
+
+        float target = std::min(std::max(0.0f, timeMs), static_cast<float>(tracks.cycleMs[i]));
+        // 회차 끝까지 가면 반복/종료로 넘어가지 않도록 바로 앞에서 멈춤
+        if (target >= static_cast<float>(tracks.cycleMs[i]) && tracks.cycleMs[i] > 0) {
+            target = std::nextafter(target, 0.0f);
+        }
+        bool visible = false;
+        bool finished = false;
+        seeking = true;
+        uint32_t affected = advanceTrack(i, target, visible, finished);
+        seeking = false;
+
+        // 되돌린 속성도 반영해야 하므로 값 속성은 모두 비교해서 기록
+        affected |= kAffectPosition | kAffectSize | kAffectRotation | kAffectAlpha | kAffectScale;
         if (uiManager) {
-            if (!animator->getImageName().empty())
-                uiManager->changeTexture(name, animator->getImageName());
+            if (UIElement* element = uiManager->getElement(tracks.handles[i])) {
+                applyTrack(i, *element, affected, visible);
+            }
+        }
+    }
+}
 
-            if (animator->isAffectingPosition()) {
-                uiManager->moveTo(name, animator->getX(), animator->getY());
+void AnimationManager::applyTrack(size_t index, UIElement& element, uint32_t affected, bool visible) {
+    // 이번 프레임에 진행한 스텝의 속성 중 실제로 값이 달라진 것만 기록
+    if (affected & kAffectTexture) {
+        // 스텝 전환 때 한 번만 (나인패치 요소는 교체마다 패치 텍스처를 새로 받으므로)
+        uiManager->changeTexture(tracks.handles[index], imageNames[tracks.imageIndex[index]]);
+    }
+
+    if (affected & kAffectSheet) {
+        // 플립북 시작: 시트의 첫 프레임으로 한 번 교체하고 시트 배치를 기억 (이후 프레임은 srcRect만).
+        // 같은 시트를 반복 재생하고 요소가 아직 그 시트를 그리고 있으면 조회 없이 프레임만 다시 씀
+        FlipbookState& flip = tracks.flipbook[index];
+        if (flip.columns == 0 || element.texture != flip.texture || !element.hasSrcRect()) {
+            SDL_Rect firstFrame = {0, 0, flip.frameW, flip.frameH};
+            TextureRegion sheet = uiManager->changeTextureFrame(tracks.handles[index], imageNames[flip.imageIndex], firstFrame);
+            flip.texture = sheet.texture;
+            flip.columns = 0;
+            if (sheet) {
+                flip.originX = sheet.rect.x;
+                flip.originY = sheet.rect.y;
+                flip.columns = std::max(1, sheet.rect.w / std::max(1, flip.frameW));
+                tracks.flipShown[index] = 0;
             }
+        }
+    }
+
+    // 다른 스텝/위젯이 텍스처를 바꿨으면 (hasSrcRect가 false) 시트 프레임을 쓰지 않음
+    if ((affected & kAffectFrame) && tracks.flipShown[index] != tracks.flipFrame[index] &&
+        tracks.flipbook[index].columns > 0 && element.hasSrcRect()) {
+        const FlipbookState& flip = tracks.flipbook[index];
+        const int32_t frame = tracks.flipFrame[index];
+        element.srcRect = {flip.originX + (frame % flip.columns) * flip.frameW,
+                           flip.originY + (frame / flip.columns) * flip.frameH,
+                           flip.frameW, flip.frameH};
+        tracks.flipShown[index] = frame;
+    }
 
-            if (animator->isAffectingSize())
-                uiManager->resize(name, animator->getWidth(), animator->getHeight());
+    if ((affected & kAffectPosition) &&
+        (element.rect.x != tracks.posX[index] || element.rect.y != tracks.posY[index])) {
+        element.rect.x = tracks.posX[index];
+        element.rect.y = tracks.posY[index];
+    }
+
+    if ((affected & kAffectSize) &&
+        (element.rect.w != tracks.width[index] || element.rect.h != tracks.height[index])) {
+        element.rect.w = tracks.width[index];
+        element.rect.h = tracks.height[index];
+    }
 
-            if (animator->isAffectingRotation())
-                uiManager->setRotate(name, animator->getRotation());
-            
-            if (animator->isAffectingAlpha())
-                uiManager->setAlpha(name, animator->getAlpha());
-            
-            if (animator->isAffectingScale())
-                uiManager->setScale(name, animator->getScale());
+    if ((affected & kAffectRotation) && element.rotation != tracks.rotation[index])
+        element.rotation = tracks.rotation[index];
 
-            bool visibleVal;
-            if (animator->consumeVisibleOverride(visibleVal))
-                uiManager->setVisible(name, visibleVal);
+    if ((affected & kAffectAlpha) && element.alpha != tracks.alpha[index])
+        element.alpha = tracks.alpha[index];
+
+    if ((affected & kAffectScale) && element.scale != tracks.scale[index])
+        element.scale = tracks.scale[index];
+
+    if ((affected & kAffectVisible) && element.visible != visible)
+        element.visible = visible;
+}
+
+void AnimationManager::releaseTrack(size_t index) {
+    if (tracks.sharedKeys[index]) {
+        return;  // 클립 구간은 clear()까지 유지
+    }
+    const uint32_t begin = tracks.keyBegin[index];
+    const uint32_t end = begin + tracks.keyCount[index];
+    for (uint32_t k = begin; k < end; k++) {
+        if (keyframes[k].op == Op::CALLBACK) {
+            callbackSlots[keyframes[k].payload] = nullptr;  // Lua 함수 참조 해제
+            freeCallbackSlots.push_back(keyframes[k].payload);
         }
     }
-    
-    // 🧹 종료된 애니메이터만 실제 목록에서 제거 (같은 name의 다른 인스턴스와 구분 위해 shared_ptr 비교)
-    for (const Pair& pair : snapshot) {
-        if (pair.second->isFinished()) {
-            auto it = std::find_if(animators.begin(), animators.end(),
-                [&pair](const Pair& p) { return p.first == pair.first && p.second == pair.second; });
-            if (it != animators.end())
-                animators.erase(it);
+    deadKeyframes += tracks.keyCount[index];
+}
+
+void AnimationManager::compact() {
+    for (size_t i = 0; i < tracks.size();) {
+        if (tracks.dead[i]) {
+            releaseTrack(i);
+            tracks.swapRemove(i);  // 마지막 트랙이 i로 옮겨오므로 i는 그대로 다시 검사
+        } else {
+            i++;
+        }
+    }
+    hasDeadTracks = false;
+
+    if (tracks.size() == 0) {
+        keyframes.clear();
+        deadKeyframes = 0;
+        return;
+    }
+
+    // 제거된 트랙의 키프레임 구간이 풀의 절반을 넘으면 살아 있는 구간만 앞으로 모음
+    if (deadKeyframes > kMinCompactKeyframes && deadKeyframes * 2 > keyframes.size()) {
+        keyframeScratch.clear();
+        for (size_t i = 0; i < tracks.size(); i++) {
+            if (tracks.sharedKeys[i]) continue;
+            const uint32_t begin = tracks.keyBegin[i];
+            tracks.keyBegin[i] = static_cast<uint32_t>(keyframeScratch.size());
+            keyframeScratch.insert(keyframeScratch.end(),
+                                   keyframes.begin() + begin,
+                                   keyframes.begin() + begin + tracks.keyCount[i]);
         }
+        keyframes.swap(keyframeScratch);
+        deadKeyframes = 0;
     }
 }
 
+int32_t AnimationManager::internImage(const std::string& imageName) {
+    auto it = imageIndexByName.find(imageName);
+    if (it != imageIndexByName.end()) {
+        return it->second;
+    }
+    int32_t index = static_cast<int32_t>(imageNames.size());
+    imageNames.push_back(imageName);
+    imageIndexByName.emplace(imageName, index);
+    return index;
+}
+
 void AnimationManager::clear() {
-    animators.clear();
+    if (updating) {
+        // 콜백 안에서 호출됨: 순회가 끝난 뒤 정리
+        for (size_t i = 0; i < tracks.size(); i++) {
+            tracks.dead[i] = 1;
+        }
+        hasDeadTracks = tracks.size() > 0;
+        return;
+    }
+    tracks.forEachColumn([](auto& column) { column.clear(); });
+    keyframes.clear();
+    deadKeyframes = 0;
+    callbackSlots.clear();
+    freeCallbackSlots.clear();
+    clipKeyframes.clear();
+    clipRanges.clear();
+    imageNames.clear();
+    imageIndexByName.clear();
+    hasDeadTracks = false;
+}
+
+void AnimationManager::reserve(size_t trackCount, size_t keyframeCount) {
+    tracks.forEachColumn([trackCount](auto& column) { column.reserve(trackCount); });
+    keyframes.reserve(keyframeCount);
+    keyframeScratch.reserve(keyframeCount);
 }
 
 bool AnimationManager::loadAnimatorFromJson(const std::string& uiElementName, const std::string& animJsonName) {
@@ -118,92 +701,13 @@ bool AnimationManager::loadAnimatorFromJson(const std::string& uiElementName, co
         return false;
     }
     
-    // JSON 로드
-    nlohmann::json animJson = resourceManager->getAnimationJson(animJsonName);
-    if (animJson.is_null() || !animJson.is_array()) {
+    // 컴파일된 클립 (ResourceManager가 이름별로 한 번만 파싱/컴파일해 캐시)
+    std::shared_ptr<const AnimationClip> clip = resourceManager->getAnimationClip(animJsonName);
+    if (!clip) {
         std::cerr << "[ERROR] AnimationManager::loadAnimatorFromJson(): Failed to load animation JSON: " << animJsonName << std::endl;
         return false;
     }
-    
-    // Animator 생성
-    auto animator = std::make_shared<Animator>(uiElementName);
-    
-    // JSON 스텝들을 Animator에 추가
-    for (auto& step : animJson) {
-        std::string type = step.value("type", "");
-        
-        if (type == "scale") {
-            float fromScale = step.value("fromScale", 1.0f);
-            float toScale = step.value("toScale", 1.0f);
-            int durationMs = step.value("durationMs", 0);
-            animator->scale(fromScale, toScale, durationMs);
-        }
-        else if (type == "rotate") {
-            float fromDegree = step.value("fromDegree", 0.0f);
-            float toDegree = step.value("toDegree", 0.0f);
-            int durationMs = step.value("durationMs", 0);
-            animator->rotate(fromDegree, toDegree, durationMs);
-        }
-        else if (type == "move") {
-            int moveX = step.value("moveX", 0);
-            int moveY = step.value("moveY", 0);
-            int durationMs = step.value("durationMs", 0);
-            animator->move(moveX, moveY, durationMs);
-        }
-        else if (type == "moveTo") {
-            if (step.contains("fromX") && step.contains("fromY")) {
-                // 시작/끝 값 버전
-                int fromX = step.value("fromX", 0);
-                int fromY = step.value("fromY", 0);
-                int toX = step.value("toX", 0);
-                int toY = step.value("toY", 0);
-                int durationMs = step.value("durationMs", 0);
-                animator->moveTo(fromX, fromY, toX, toY, durationMs);
-            } else {
-                // 단일 값 버전 (현재 위치에서 시작) - 하지만 JSON에서는 from/to 모두 명시하므로 이 경우는 없을 것
-                int toX = step.value("toX", 0);
-                int toY = step.value("toY", 0);
-                int durationMs = step.value("durationMs", 0);
-                animator->moveTo(toX, toY, durationMs);
-            }
-        }
-        else if (type == "resize") {
-            int fromW = step.value("fromW", 0);
-            int fromH = step.value("fromH", 0);
-            int toW = step.value("toW", 0);
-            int toH = step.value("toH", 0);
-            int durationMs = step.value("durationMs", 0);
-            animator->resize(fromW, fromH, toW, toH, durationMs);
-        }
-        else if (type == "alpha") {
-            float fromAlpha = step.value("fromAlpha", 1.0f);
-            float toAlpha = step.value("toAlpha", 1.0f);
-            int durationMs = step.value("durationMs", 0);
-            animator->alpha(fromAlpha, toAlpha, durationMs);
-        }
-        else if (type == "changeTexture") {
-            std::string image = step.value("image", "");
-            if (!image.empty()) {
-                animator->changeTexture(image);
-            }
-        }
-        else if (type == "delay") {
-            int durationMs = step.value("durationMs", 0);
-            animator->delay(durationMs);
-        }
-        else if (type == "setVisible" || type == "visible") {
-            bool visible = step.value("visible", true);
-            animator->setVisible(visible);
-        }
-        else if (type == "repeat") {
-            int count = step.value("count", 1);
-            animator->repeat(count);
-        }
-        // callback은 JSON에서 지원하지 않음 (Lua 함수를 전달할 수 없음)
-    }
-    
-    // AnimationManager에 추가
-    add(uiElementName, animator);
+
+    play(uiElementName, clip);
     return true;
 }
-
@@ -1,14 +1,31 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include "Animator.h"  // 같은 폴더
+#include "AnimationClip.h"
 #include "../ui/uiManager.h"
 
 class UiManager; // forward declaration
 class ResourceManager; // forward declaration
 
+/**
+ * 재생 중인 애니메이션을 구조체 배열(SoA) 트랙으로 보관하고 매 프레임 UI 요소에 반영한다.
+ * 트랙은 요소 핸들에 묶여 있어 이름 조회 없이 요소를 찾고, 값이 바뀐 속성만 쓴다 (텍스처는 스텝 전환 때 한 번).
+ * - add(): Animator의 키프레임을 공용 키프레임 풀 뒤에 복사 (이미지 이름은 인덱스로 인턴, 콜백은 슬롯 풀로 이동)
+ * - play(): 컴파일된 클립을 참조만 하는 트랙 추가 (클립 키프레임은 매니저에 처음 들어올 때 한 번만 옮김)
+ * - update(): 트랙 배열을 앞에서부터 한 번 순회. 끝난 트랙은 순회 후 마지막 트랙과 자리를 바꿔 제거
+ * - 풀과 트랙 배열은 용량을 유지하므로 트윈만 도는 프레임은 힙 할당이 없다
+ * 콜백 안에서 add/remove/clear를 호출해도 안전 (제거는 표시만 하고 순회가 끝난 뒤 정리).
+ * 한 트랙 안에서 Animator 그룹의 멤버들이 동시에 진행되므로, 이동+페이드 같은 효과도 트랙 하나로 처리된다.
+ * 플립북 스텝은 시작 때 시트 텍스처로 한 번 바꾸고, 이후에는 프레임이 넘어갈 때 요소의 srcRect만 고친다.
+ * 트랙이 많으면 콜백 없는 트랙의 진행(평가)은 JobSystem::parallelFor로 나눠 돌리고,
+ * 콜백이 있는 트랙의 진행과 UI 반영은 메인 스레드에서 트랙 순서대로 한다.
+ */
 class AnimationManager {
 public:
     AnimationManager() = default;
@@ -16,15 +33,137 @@ public:
     void setUiManager(UiManager* uiManager);
     void setResourceManager(ResourceManager* resourceManager);
     void add(const std::string& uiName, std::shared_ptr<Animator> animator);
+    void play(const std::string& uiName, const std::shared_ptr<const AnimationClip>& clip);  // 공유 클립 재생
     void remove(const std::string& uiName); // 특정 UI 요소의 애니메이션 제거
     void update(float deltaTime); // 매 프레임 호출
     void clear(); // 모든 애니메이션 제거 (씬 전환 시 사용)
-    
-    // JSON에서 Animator 생성 및 추가
+    void reserve(size_t trackCount, size_t keyframeCount); // 대량 트윈 전에 트랙/키프레임 용량 확보
+
+    // 재생 제어 (uiName에 걸린 모든 트랙)
+    void pause(const std::string& uiName);
+    void resume(const std::string& uiName);
+    void setSpeed(const std::string& uiName, float speed);  // 1.0 = 기본 속도
+    // 현재 회차의 timeMs 위치로 이동 (회차 시작 상태에서 다시 진행, 콜백은 실행하지 않음)
+    void seek(const std::string& uiName, float timeMs);
+    void setTimeScale(float scale);  // 모든 트랙에 곱하는 배속 (0이면 전체 정지)
+    float getTimeScale() const { return timeScale; }
+
+    size_t getActiveCount() const { return tracks.size(); }
+    size_t getKeyframePoolSize() const { return keyframes.size(); }
+
+    // 애니메이션 JSON의 컴파일된 클립 재생 (ResourceManager::getAnimationClip 캐시 사용)
     bool loadAnimatorFromJson(const std::string& uiElementName, const std::string& animJsonName);
 
 private:
-    std::vector<std::pair<std::string, std::shared_ptr<Animator>>> animators;
+    using Keyframe = Animator::Keyframe;
+    using Op = Animator::Op;
+
+    // 회차 시작 시점의 상태 (seek용, 회차마다 한 번 기록)
+    struct TrackState {
+        int32_t posX = 0, posY = 0, width = 0, height = 0;
+        float rotation = 0.0f, alpha = 1.0f, scale = 1.0f;
+    };
+
+    // 진행 중인 플립북의 시트 배치 (프레임 영역 계산용, 스텝 시작 시 한 번 채움)
+    struct FlipbookState {
+        SDL_Texture* texture = nullptr;    // 시트 텍스처 (반복 때 요소가 그대로면 다시 조회하지 않음)
+        int32_t imageIndex = -1;
+        int32_t originX = 0, originY = 0;  // 아틀라스 안에서 시트의 위치
+        int32_t frameW = 0, frameH = 0;
+        int32_t columns = 0;               // 0이면 시트를 찾지 못함 (프레임 반영 안 함)
+    };
+
+    // 재생 중인 트랙들 (인덱스 i가 트랙 하나). 대상 요소는 추가 시점에 핸들로 고정
+    // (요소가 제거되면 핸들이 무효가 되어 반영을 건너뜀)
+    struct Tracks {
+        std::vector<std::string> uiNames;      // remove(uiName) 비교용
+        std::vector<ElementHandle> handles;
+        std::vector<uint8_t> sharedKeys;       // 1이면 clipKeyframes의 공유 구간 (해제/압축 대상 아님)
+        std::vector<uint8_t> hasCallbacks;     // 1이면 CALLBACK 스텝이 있어 메인 스레드에서만 진행
+        std::vector<uint32_t> keyBegin;        // keyframes(또는 clipKeyframes) 내 시작 위치
+        std::vector<uint32_t> keyCount;
+        std::vector<uint32_t> keyIndex;        // 현재 그룹의 첫 키프레임 (keyCount면 이번 회차 끝)
+        std::vector<uint32_t> groupEnd;        // 현재 그룹 다음 키프레임
+        std::vector<int32_t> cycleMs;          // 한 회차 전체 길이 (0이면 한 프레임에 한 회차만)
+        std::vector<int32_t> repeatLeft;       // -1 무한
+        std::vector<float> elapsed;            // 현재 그룹 경과 시간 (ms)
+        std::vector<float> groupDuration;      // 현재 그룹 길이 (가장 늦게 끝나는 멤버)
+        std::vector<uint32_t> memberStarted;   // 그룹 멤버별 시작 여부 (비트)
+        std::vector<uint32_t> memberDone;      // 그룹 멤버별 종료 여부 (비트)
+        std::vector<uint8_t> groupStarted;     // 현재 그룹을 시작했는지
+        std::vector<uint8_t> dead;             // 제거 예정 (순회 후 정리)
+        std::vector<uint8_t> paused;
+        std::vector<float> speed;              // 트랙별 배속
+        // 진행 중인 보간의 실제 시작값 (속성별로 따로 두어 그룹 멤버가 동시에 진행)
+        std::vector<float> fromPosX, fromPosY, fromWidth, fromHeight, fromRotation, fromAlpha, fromScale;
+        // 애니메이션이 계산한 현재 상태 (add 시점에 UI 요소 값으로 초기화)
+        std::vector<int32_t> posX, posY, width, height;
+        std::vector<float> rotation, alpha, scale;
+        std::vector<int32_t> imageIndex;       // 마지막으로 진입한 CHANGE_TEXTURE 이미지 (-1 없음)
+        std::vector<int32_t> flipFrame;        // 플립북이 계산한 현재 프레임
+        std::vector<int32_t> flipShown;        // 요소에 마지막으로 쓴 프레임 (-1 없음)
+        std::vector<FlipbookState> flipbook;
+        std::vector<TrackState> cycleStart;    // 자주 쓰지 않는 값이라 한 열에 묶음
+        // 병렬 진행 결과 (update 한 번 안에서만 유효)
+        std::vector<uint32_t> frameAffected;
+        std::vector<uint8_t> frameResult;      // kFrame* 비트
+
+        size_t size() const { return handles.size(); }
+
+        template <typename Fn>
+        void forEachColumn(Fn&& fn) {
+            fn(uiNames); fn(handles); fn(sharedKeys); fn(hasCallbacks); fn(keyBegin); fn(keyCount); fn(keyIndex); fn(groupEnd);
+            fn(cycleMs); fn(repeatLeft); fn(elapsed); fn(groupDuration); fn(memberStarted); fn(memberDone);
+            fn(groupStarted); fn(dead); fn(paused); fn(speed);
+            fn(fromPosX); fn(fromPosY); fn(fromWidth); fn(fromHeight); fn(fromRotation); fn(fromAlpha); fn(fromScale);
+            fn(posX); fn(posY); fn(width); fn(height); fn(rotation); fn(alpha); fn(scale); fn(imageIndex);
+            fn(flipFrame); fn(flipShown); fn(flipbook); fn(cycleStart); fn(frameAffected); fn(frameResult);
+        }
+        size_t push();
+        void swapRemove(size_t index);
+    };
+
+    // 트랙의 keyIndex번째 키프레임 (값 복사: 콜백이 add()를 부르면 풀이 재할당될 수 있음)
+    Keyframe keyframeAt(size_t index, uint32_t keyIndex) const {
+        const std::vector<Keyframe>& pool = tracks.sharedKeys[index] ? clipKeyframes : keyframes;
+        return pool[tracks.keyBegin[index] + keyIndex];
+    }
+    // 대상 요소를 찾아 트랙 하나를 추가하고 상태를 요소 값으로 초기화. 실패하면 kNoTrack
+    static constexpr size_t kNoTrack = static_cast<size_t>(-1);
+    size_t beginTrack(const std::string& uiName, int repeatCount);
+    // update()의 트랙 하나 진행. 이번 프레임에 값이 바뀐 속성을 affected 비트로 돌려줌
+    uint32_t advanceTrack(size_t index, float deltaTime, bool& outVisible, bool& outFinished);
+    void beginGroup(size_t index);
+    uint32_t evaluateGroup(size_t index, bool& outVisible);
+    void saveCycleStart(size_t index);
+    void beginKeyframe(size_t index, const Keyframe& key);
+    void evaluateKeyframe(size_t index, const Keyframe& key, float t);
+    void applyTrack(size_t index, UIElement& element, uint32_t affected, bool visible);
+    void releaseTrack(size_t index);  // 콜백 슬롯 반환 + 키프레임 풀 사용량 갱신
+    void compact();                   // 제거 표시된 트랙 정리, 필요하면 키프레임 풀 압축
+    int32_t internImage(const std::string& imageName);
+
+    Tracks tracks;
+    std::vector<Keyframe> keyframes;          // 모든 트랙의 키프레임 (트랙별 연속 구간)
+    std::vector<Keyframe> keyframeScratch;    // 압축용 (용량 재사용)
+    size_t deadKeyframes = 0;
+    // play()로 들어온 클립 → clipKeyframes 구간 (clear()까지 유지, 클립 수만큼만 늘어남)
+    struct ClipRange {
+        std::shared_ptr<const AnimationClip> clip;  // 키 포인터가 가리키는 클립 유지
+        uint32_t begin = 0;
+        uint32_t count = 0;
+    };
+    std::unordered_map<const AnimationClip*, ClipRange> clipRanges;
+    std::vector<Keyframe> clipKeyframes;
+    std::deque<Animator::Callback> callbackSlots;  // deque: 콜백 실행 중 add로 늘어나도 참조 유지
+    std::vector<int32_t> freeCallbackSlots;
+    std::vector<std::string> imageNames;      // CHANGE_TEXTURE/FLIPBOOK 이미지 이름 (인턴, 씬 동안 유지)
+    std::unordered_map<std::string, int32_t> imageIndexByName;
+    bool updating = false;
+    bool seeking = false;  // seek 중에는 콜백을 실행하지 않음
+    float timeScale = 1.0f;
+    bool hasDeadTracks = false;
+
     UiManager* uiManager = nullptr; // 기본은 null
     ResourceManager* resourceManager = nullptr;
 };
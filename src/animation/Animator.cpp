@@ -1,405 +1,205 @@
 #include "Animator.h"
-#include "../ui/uiManager.h"  // UIElement 사용
-#include "../utils/logger.h"
+#include <algorithm>
+#include <iostream>
 
 Animator::Animator(const std::string& targetName)
     : targetName(targetName) {}
 
-void Animator::applyInitialStateFromUI(const UIElement& element) {
-    if (!currentStep || !currentStep->startDeferred) return;
+Animator::Keyframe& Animator::addKeyframe(Op op, int durationMs, bool startDeferred) {
+    Keyframe key;
+    key.op = op;
+    key.duration = durationMs > 0 ? durationMs : 0;
+    key.startDeferred = startDeferred;
+    key.offset = pendingOffset;
+    pendingOffset = 0;
+    if (inGroup) {
+        if (groupMembers >= kMaxGroupMembers) {
+            std::cerr << "[WARN] Animator::group(): More than " << kMaxGroupMembers
+                      << " steps in a group for '" << targetName << "', starting a new group" << std::endl;
+            groupMembers = 0;
+        }
+        key.withPrevious = groupMembers > 0;
+        groupMembers++;
+    }
+    keyframes.push_back(key);
+    return keyframes.back();
+}
 
-    currentStep->startDeferred = false;
+int Animator::computeCycleMs(const std::vector<Keyframe>& keyframes) {
+    int total = 0;
+    int groupLength = 0;
+    for (const Keyframe& key : keyframes) {
+        if (!key.withPrevious) {
+            total += groupLength;
+            groupLength = 0;
+        }
+        groupLength = std::max(groupLength, key.offset + key.duration);
+    }
+    return total + groupLength;
+}
+
+Animator& Animator::group() {
+    inGroup = true;
+    groupMembers = 0;
+    return *this;
+}
+
+Animator& Animator::endGroup() {
+    inGroup = false;
+    groupMembers = 0;
+    return *this;
+}
 
-    currentStep->fromX = static_cast<float>(element.rect.x);
-    currentStep->fromY = static_cast<float>(element.rect.y);
-    currentStep->fromWidth = element.rect.w;
-    currentStep->fromHeight = element.rect.h;
-    currentStep->fromDegree = element.rotation;
-    currentStep->fromAlpha = element.alpha;
-    currentStep->fromScale = element.scale;
+Animator& Animator::at(int offsetMs) {
+    pendingOffset = offsetMs > 0 ? offsetMs : 0;
+    return *this;
 }
 
-void Animator::setInitialStateFromUI(const UIElement& element) {
-    // Animator의 초기 상태를 UI 요소의 현재 상태로 설정
-    posX = element.rect.x;
-    posY = element.rect.y;
-    width = element.rect.w;
-    height = element.rect.h;
-    rotation = element.rotation;
-    currentAlpha = element.alpha;
-    currentScale = element.scale;
+Animator& Animator::ease(Easing::Type type) {
+    if (!keyframes.empty()) {
+        keyframes.back().ease = type;
+    }
+    return *this;
 }
 
 Animator& Animator::changeTexture(const std::string& imageName) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::CHANGE_TEXTURE;
-    step->imageName = imageName;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::CHANGE_TEXTURE, 0, false);
+    key.payload = static_cast<int32_t>(imageNames.size());
+    imageNames.push_back(imageName);
     return *this;
 }
 
 Animator& Animator::rotate(float endDegree, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::ROTATE;
-    step->fromDegree = 0;
-    step->degree = endDegree;
-    step->duration = durationMs;
-    step->startDeferred = true;
-    steps.push(step);
-    originalSteps.push(step);
-
+    Keyframe& key = addKeyframe(Op::ROTATE, durationMs, true);
+    key.to[0] = endDegree;
     return *this;
 }
 
 Animator& Animator::rotate(float startDegree, float endDegree, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::ROTATE;
-    step->fromDegree = startDegree;
-    step->degree = endDegree;
-    step->duration = durationMs;
-    steps.push(step);
-    originalSteps.push(step);
-
+    Keyframe& key = addKeyframe(Op::ROTATE, durationMs, false);
+    key.from[0] = startDegree;
+    key.to[0] = endDegree;
     return *this;
 }
 
 Animator& Animator::move(int dx, int dy, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::MOVE;
-    step->x = dx;
-    step->y = dy;
-    step->duration = durationMs;
-    step->startDeferred = true;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::MOVE, durationMs, true);
+    key.to[0] = static_cast<float>(dx);
+    key.to[1] = static_cast<float>(dy);
     return *this;
 }
 
 Animator& Animator::moveTo(int endX, int endY, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::MOVE_TO;
-    step->fromX = 0;
-    step->fromY = 0;
-    step->x = endX;
-    step->y = endY;
-    step->duration = durationMs;
-    step->startDeferred = true;
-    steps.push(step);
-    originalSteps.push(step);
-
+    Keyframe& key = addKeyframe(Op::MOVE_TO, durationMs, true);
+    key.to[0] = static_cast<float>(endX);
+    key.to[1] = static_cast<float>(endY);
     return *this;
 }
 
 Animator& Animator::moveTo(int startX, int startY, int endX, int endY, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::MOVE_TO;
-    step->fromX = startX;
-    step->fromY = startY;
-    step->x = endX;
-    step->y = endY;
-    step->duration = durationMs;
-    steps.push(step);
-    originalSteps.push(step);
-
+    Keyframe& key = addKeyframe(Op::MOVE_TO, durationMs, false);
+    key.from[0] = static_cast<float>(startX);
+    key.from[1] = static_cast<float>(startY);
+    key.to[0] = static_cast<float>(endX);
+    key.to[1] = static_cast<float>(endY);
     return *this;
 }
 
 Animator& Animator::resize(int endW, int endH, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::RESIZE;
-    step->fromWidth = 0;
-    step->fromHeight = 0;
-    step->width = endW;
-    step->height = endH;
-    step->duration = durationMs;
-    step->startDeferred = true;
-    steps.push(step);
-    originalSteps.push(step);
-
+    Keyframe& key = addKeyframe(Op::RESIZE, durationMs, true);
+    key.to[0] = static_cast<float>(endW);
+    key.to[1] = static_cast<float>(endH);
     return *this;
 }
 
 Animator& Animator::resize(int startW, int startH, int endW, int endH, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::RESIZE;
-    step->fromWidth = startW;
-    step->fromHeight = startH;
-    step->width = endW;
-    step->height = endH;
-    step->duration = durationMs;
-    steps.push(step);
-    originalSteps.push(step);
-
+    Keyframe& key = addKeyframe(Op::RESIZE, durationMs, false);
+    key.from[0] = static_cast<float>(startW);
+    key.from[1] = static_cast<float>(startH);
+    key.to[0] = static_cast<float>(endW);
+    key.to[1] = static_cast<float>(endH);
     return *this;
 }
 
 Animator& Animator::alpha(float endAlpha, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::ALPHA;
-    step->fromAlpha = 0.0f;  // Will be set from UI
-    step->alpha = endAlpha;
-    step->duration = durationMs;
-    step->startDeferred = true;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::ALPHA, durationMs, true);
+    key.to[0] = endAlpha;
     return *this;
 }
 
 Animator& Animator::alpha(float startAlpha, float endAlpha, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::ALPHA;
-    step->fromAlpha = startAlpha;
-    step->alpha = endAlpha;
-    step->duration = durationMs;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::ALPHA, durationMs, false);
+    key.from[0] = startAlpha;
+    key.to[0] = endAlpha;
     return *this;
 }
 
 Animator& Animator::scale(float endScale, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::SCALE;
-    step->fromScale = 0.0f;  // Will be set from UI
-    step->scale = endScale;
-    step->duration = durationMs;
-    step->startDeferred = true;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::SCALE, durationMs, true);
+    key.to[0] = endScale;
     return *this;
 }
 
 Animator& Animator::scale(float startScale, float endScale, int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::SCALE;
-    step->fromScale = startScale;
-    step->scale = endScale;
-    step->duration = durationMs;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::SCALE, durationMs, false);
+    key.from[0] = startScale;
+    key.to[0] = endScale;
     return *this;
 }
 
 Animator& Animator::delay(int durationMs) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::DELAY;
-    step->duration = durationMs;
-    steps.push(step);
-    originalSteps.push(step);
+    addKeyframe(Op::DELAY, durationMs, false);
     return *this;
 }
 
 Animator& Animator::repeat(int count) {
     repeatCount = count;
-    
     return *this;
 }
 
 Animator& Animator::callback(Callback cb) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::CALLBACK;
-    step->cb = cb;
-    steps.push(step);
-    originalSteps.push(step);
-    return *this;
-}
-
-Animator& Animator::setVisible(bool visible) {
-    auto step = std::make_shared<AnimationStep>();
-    step->type = AnimationStep::SET_VISIBLE;
-    step->visibleValue = visible;
-    step->duration = 0;
-    steps.push(step);
-    originalSteps.push(step);
+    Keyframe& key = addKeyframe(Op::CALLBACK, 0, false);
+    key.payload = static_cast<int32_t>(callbacks.size());
+    callbacks.push_back(std::move(cb));
     return *this;
 }
 
-// bool 로 바꾸고, false 면 manager 에서 얘를 제거 해야 한다.
-void Animator::update(float deltaTime) {
-    if (!currentStep && !steps.empty()) {
-        currentStep = steps.front();
-        steps.pop();
-        currentStep->elapsed = 0;
-
-        // 💡 startDeferred 처리
-        if (currentStep->startDeferred) {
-            currentStep->fromX = static_cast<float>(posX);
-            currentStep->fromY = static_cast<float>(posY);
-            currentStep->fromDegree = rotation;
-            currentStep->fromWidth = width;
-            currentStep->fromHeight = height;
-            currentStep->fromAlpha = currentAlpha;
-            currentStep->fromScale = currentScale;
-            currentStep->startDeferred = false;
-        }
-
-        // 텍스처 즉시 반영
-        if (currentStep->type == AnimationStep::CHANGE_TEXTURE) {
-            currentImage = currentStep->imageName;
-            currentStep = nullptr;
-        }
-        // visible 즉시 반영
-        if (currentStep->type == AnimationStep::SET_VISIBLE) {
-            visibleOverrideValid = true;
-            visibleOverrideValue = currentStep->visibleValue;
-            currentStep = nullptr;
-        }
+Animator& Animator::flipbook(const std::string& sheetImage, int frameWidth, int frameHeight, int frameCount,
+                             float fps, FlipbookMode mode, int loops) {
+    if (frameWidth <= 0 || frameHeight <= 0 || frameCount <= 0 || fps <= 0.0f) {
+        std::cerr << "[ERROR] Animator::flipbook(): Invalid frame size/count/fps for '" << sheetImage << "'" << std::endl;
+        return *this;
     }
-
-    if (!currentStep) return;
-
-    currentStep->elapsed += static_cast<int>(deltaTime);
-    float t = std::min(1.0f, currentStep->duration > 0
-        ? static_cast<float>(currentStep->elapsed) / currentStep->duration
-        : 1.0f);
-
-    switch (currentStep->type) {
-        case AnimationStep::ROTATE: {
-            rotation = currentStep->fromDegree +
-                       (currentStep->degree - currentStep->fromDegree) * t;
-            break;
-        }
-
-        case AnimationStep::MOVE: {
-            posX = static_cast<int>(currentStep->fromX +
-                    currentStep->x * t);  // x = delta 이동량
-            posY = static_cast<int>(currentStep->fromY +
-                    currentStep->y * t);
-            break;
-        }
-
-        case AnimationStep::MOVE_TO: {
-            posX = static_cast<int>(currentStep->fromX +
-                    (currentStep->x - currentStep->fromX) * t);
-            posY = static_cast<int>(currentStep->fromY +
-                    (currentStep->y - currentStep->fromY) * t);
-            break;
-        }
-
-        case AnimationStep::RESIZE: {
-            width = static_cast<int>(currentStep->fromWidth +
-                     (currentStep->width - currentStep->fromWidth) * t);
-            height = static_cast<int>(currentStep->fromHeight +
-                      (currentStep->height - currentStep->fromHeight) * t);
-            break;
-        }
-
-        case AnimationStep::ALPHA: {
-            currentAlpha = currentStep->fromAlpha +
-                    (currentStep->alpha - currentStep->fromAlpha) * t;
-            break;
-        }
-
-        case AnimationStep::SCALE: {
-            currentScale = currentStep->fromScale +
-                    (currentStep->scale - currentStep->fromScale) * t;
-            break;
-        }
-
-        // case AnimationStep::REPEAT:  // todo: 악보의 도돌이표처러 동작하게 수정
-
-        case AnimationStep::DELAY:
-            // 아무것도 하지 않음
-            break;
-
-        case AnimationStep::CALLBACK:
-            if (currentStep->cb) {
-                currentStep->cb();
-            }
-            break;
-
-        default: break;
+    const float frameMs = 1000.0f / fps;
+    // 핑퐁 한 바퀴는 양 끝 프레임을 한 번씩만 보여 줌 (0,1,2,1 → 0,1,2,1 ...)
+    const int framesPerLoop = (mode == FlipbookMode::PingPong && frameCount > 1) ? frameCount * 2 - 2 : frameCount;
+    const int duration = static_cast<int>(frameMs * framesPerLoop * std::max(1, loops) + 0.5f);
+
+    Keyframe& key = addKeyframe(Op::FLIPBOOK, duration, false);
+    key.flipbookMode = mode;
+    key.payload = static_cast<int32_t>(imageNames.size());
+    key.from[0] = static_cast<float>(frameWidth);
+    key.from[1] = static_cast<float>(frameHeight);
+    key.to[0] = static_cast<float>(frameCount);
+    key.to[1] = frameMs;
+    imageNames.push_back(sheetImage);
+    return *this;
+}
+
+bool Animator::flipbookModeFromName(const std::string& name, FlipbookMode& outMode) {
+    if (name == "loop") {
+        outMode = FlipbookMode::Loop;
+        return true;
     }
-
-    if (currentStep->elapsed >= currentStep->duration) {
-        currentStep = nullptr;
-
-        if (steps.empty()) {
-            if (repeatCount == -1 || repeatCount > 0) {
-                if (repeatCount > 0) --repeatCount;
-
-                std::queue<std::shared_ptr<AnimationStep>> copy = originalSteps;
-                while (!copy.empty()) {
-                    steps.push(copy.front());
-                    copy.pop();
-                }
-            }
-        }
+    if (name == "pingPong" || name == "pingpong") {
+        outMode = FlipbookMode::PingPong;
+        return true;
     }
+    return false;
 }
 
-
-
-
-bool Animator::isFinished() const {
-    return currentStep == nullptr && steps.empty() && repeatCount == 0;
-}
-
-// 상태 getter
-const std::string& Animator::getTargetName() const {
-    return targetName;
-}
-
-const std::string& Animator::getImageName() const {
-    return currentImage;
-}
-
-int Animator::getX() const {
-    return posX;
-}
-
-int Animator::getY() const {
-    return posY;
-}
-
-int Animator::getWidth() const {
-    return width;
-}
-
-int Animator::getHeight() const {
-    return height;
-}
-
-float Animator::getRotation() const {
-    return rotation;
-}
-
-float Animator::getAlpha() const {
-    return currentAlpha;
-}
-
-float Animator::getScale() const {
-    return currentScale;
-}
-
-std::shared_ptr<Animator::AnimationStep> Animator::getCurrentStep() const {
-    return currentStep;
-}
-
-bool Animator::isAffectingPosition() const {
-    return currentStep && (currentStep->type == AnimationStep::MOVE || 
-                          currentStep->type == AnimationStep::MOVE_TO);
-}
-
-bool Animator::isAffectingSize() const {
-    return currentStep && (currentStep->type == AnimationStep::RESIZE);
-}
-
-bool Animator::isAffectingRotation() const {
-    return currentStep && (currentStep->type == AnimationStep::ROTATE);
-}
-
-bool Animator::isAffectingAlpha() const {
-    return currentStep && (currentStep->type == AnimationStep::ALPHA);
-}
-
-bool Animator::isAffectingScale() const {
-    return currentStep && (currentStep->type == AnimationStep::SCALE);
+Animator& Animator::setVisible(bool visible) {
+    Keyframe& key = addKeyframe(Op::SET_VISIBLE, 0, false);
+    key.payload = visible ? 1 : 0;
+    return *this;
 }
-
-bool Animator::consumeVisibleOverride(bool& outVisible) {
-    if (!visibleOverrideValid) return false;
-    outVisible = visibleOverrideValue;
-    visibleOverrideValid = false;
-    return true;
-}
\ No newline at end of file
@@ -1,36 +1,56 @@
 #pragma once
-#include <string>
+#include <cstdint>
 #include <functional>
-#include <queue>
-#include <memory>
-
-#include "../ui/uiManager.h"
-
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Easing.h"
 
+/**
+ * 체이닝 방식의 애니메이션 빌더.
+ * 각 스텝은 추가 시점에 POD 키프레임 하나로 컴파일되고, 이미지 이름/콜백은 옆 테이블에 인덱스로 보관한다.
+ * 스텝은 차례로 실행되고, group()~endGroup() 사이의 스텝은 한 그룹으로 동시에 시작한다 (at()으로 그룹 안 시작 시점 지정).
+ * 그룹은 가장 늦게 끝나는 멤버가 끝나면 끝남. 같은 속성을 겹치는 시간에 두 멤버가 바꾸면 뒤 멤버가 우선.
+ * 재생은 AnimationManager가 담당: add()에서 키프레임을 자기 풀로 복사하므로 add 이후 같은 Animator에
+ * 스텝을 더해도 이미 재생 중인 애니메이션에는 반영되지 않는다.
+ */
 class Animator {
     public:
         Animator(const std::string& targetName);
         using Callback = std::function<void()>;
 
-        struct AnimationStep {
-            enum Type { CHANGE_TEXTURE, ROTATE, MOVE, MOVE_TO, RESIZE, ALPHA, SCALE, REPEAT, DELAY, CALLBACK, SET_VISIBLE } type;
-            std::string imageName;
-            float fromX = 0, fromY = 0, fromDegree = 0;
-            float x = 0, y = 0, degree = 0;
-            int width = 0, height = 0;
-            int fromWidth = 0, fromHeight = 0;
-            float fromAlpha = 0.0f, alpha = 0.0f;
-            float fromScale = 0.0f, scale = 0.0f;
-            int duration = 0;
-            int elapsed = 0;
-            int value = 0;
-            bool visibleValue = false;
-            Callback cb;
-            bool startDeferred = false;
+        enum class Op : uint8_t { CHANGE_TEXTURE, ROTATE, MOVE, MOVE_TO, RESIZE, ALPHA, SCALE, DELAY, CALLBACK, SET_VISIBLE, FLIPBOOK };
+        // FLIPBOOK 한 바퀴: Loop는 0→n-1, PingPong은 0→n-1→1
+        enum class FlipbookMode : uint8_t { Loop, PingPong };
+        // "loop" / "pingPong" (JSON·Lua 공용). 모르는 이름이면 false
+        static bool flipbookModeFromName(const std::string& name, FlipbookMode& outMode);
+
+        // 컴파일된 스텝 (from/to의 [0]만 쓰는 타입: ROTATE, ALPHA, SCALE)
+        // FLIPBOOK: payload = 시트 이미지 이름 인덱스, from = 프레임 크기, to = (프레임 수, 프레임당 ms)
+        struct Keyframe {
+            Op op = Op::DELAY;
+            bool startDeferred = false;  // 시작값을 재생 시점의 현재 상태에서 가져옴
+            Easing::Type ease = Easing::Type::Linear;
+            bool withPrevious = false;   // 앞 키프레임과 같은 그룹 (동시에 시작)
+            FlipbookMode flipbookMode = FlipbookMode::Loop;
+            int32_t duration = 0;        // ms
+            int32_t payload = 0;         // CHANGE_TEXTURE/FLIPBOOK: 이미지 이름 인덱스, CALLBACK: 콜백 인덱스, SET_VISIBLE: 0/1
+            int32_t offset = 0;          // 그룹 시작부터 이 키프레임 시작까지 (ms)
+            float from[2] = {0.0f, 0.0f};
+            float to[2] = {0.0f, 0.0f};   // MOVE는 이동량
         };
+        static_assert(std::is_trivially_copyable<Keyframe>::value, "Keyframe must stay POD");
+
+        // 한 그룹의 최대 멤버 수 (재생 중 멤버 상태를 32비트 마스크로 관리). 넘으면 새 그룹으로 이어짐
+        static constexpr int kMaxGroupMembers = 32;
+        // 그룹 길이(가장 늦게 끝나는 멤버)의 합 = 한 회차 길이
+        static int computeCycleMs(const std::vector<Keyframe>& keyframes);
+
+        // 즉시 실행되는 스텝 (재생 시간 없음)
+        static bool isInstant(Op op) {
+            return op == Op::CHANGE_TEXTURE || op == Op::CALLBACK || op == Op::SET_VISIBLE;
+        }
 
-        void applyInitialStateFromUI(const UIElement& element);
-        void setInitialStateFromUI(const UIElement& element);
         Animator& changeTexture(const std::string& imageName);
         Animator& rotate(float degree, int durationMs);
         Animator& rotate(float startDegree, float endDegree, int durationMs);
@@ -47,52 +67,37 @@ class Animator {
         Animator& repeat(int count); // -1 for infinite
         Animator& callback(std::function<void()> cb);
         Animator& setVisible(bool visible);
-    
-        void update(float deltaTime);
-        bool isFinished() const;
-    
-        // 현재 상태 정보
-        const std::string& getTargetName() const;
-        const std::string& getImageName() const;
-        int getX() const;
-        int getY() const;
-        int getWidth() const;
-        int getHeight() const;
-        float getRotation() const;
-        float getAlpha() const;
-        float getScale() const;
-        std::shared_ptr<Animator::AnimationStep> getCurrentStep() const;
+        // 스프라이트 시트 한 장의 프레임(왼쪽 위부터 행 우선)을 fps로 재생. 요소의 원본 영역만 바꿈 (텍스처 교체는 시작 시 한 번).
+        // loops바퀴 재생 후 다음 스텝으로 (계속 돌리려면 repeat(-1))
+        Animator& flipbook(const std::string& sheetImage, int frameWidth, int frameHeight, int frameCount,
+                           float fps, FlipbookMode mode = FlipbookMode::Loop, int loops = 1);
 
-        bool isAffectingPosition() const;
-        bool isAffectingSize() const;
-        bool isAffectingRotation() const;
-        bool isAffectingAlpha() const;
-        bool isAffectingScale() const;
+        // 이후 스텝을 endGroup()까지 한 그룹으로 묶어 동시에 실행 (중첩 불가)
+        Animator& group();
+        Animator& endGroup();
+        // 다음 스텝이 그룹 시작 후 offsetMs에 시작 (그룹 밖이면 그 스텝 앞의 지연과 같음)
+        Animator& at(int offsetMs);
+        // 바로 앞 스텝의 보간 곡선 (기본 선형)
+        Animator& ease(Easing::Type type);
 
-        // SET_VISIBLE 스텝용: 적용 후 true 반환, 내부 플래그 클리어
-        bool consumeVisibleOverride(bool& outVisible);
+        const std::string& getTargetName() const { return targetName; }
+        const std::vector<Keyframe>& getKeyframes() const { return keyframes; }
+        const std::vector<std::string>& getImageNames() const { return imageNames; }
+        const std::vector<Callback>& getCallbacks() const { return callbacks; }
+        int getRepeatCount() const { return repeatCount; }
 
-    
         bool operator==(const Animator&) const { // lua 등록용 더미
             return false;
         }
     private:
-
+        Keyframe& addKeyframe(Op op, int durationMs, bool startDeferred);
 
         std::string targetName; // <- UiManager 내 element 이름
-        std::string currentImage;
-        int posX = 0, posY = 0;
-        int width = 0, height = 0;
-        float rotation = 0.0f;
-        float currentRotation = 0.0f;
-        float currentAlpha = 1.0f;
-        float currentScale = 1.0f;
+        std::vector<Keyframe> keyframes;
+        std::vector<std::string> imageNames;
+        std::vector<Callback> callbacks;
         int repeatCount = 0;
-        bool visibleOverrideValid = false;
-        bool visibleOverrideValue = false;
-
-        std::queue<std::shared_ptr<AnimationStep>> steps;
-        std::queue<std::shared_ptr<AnimationStep>> originalSteps;
-        std::shared_ptr<AnimationStep> currentStep = nullptr;
+        bool inGroup = false;
+        int groupMembers = 0;
+        int pendingOffset = 0;
     };
-    
\ No newline at end of file
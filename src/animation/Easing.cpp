@@ -0,0 +1,121 @@
+#include "Easing.h"
+#include <array>
+#include <cmath>
+
+namespace {
+
+constexpr float kPi = 3.14159265358979f;
+constexpr int kCurveCount = static_cast<int>(Easing::Type::Count);
+
+const char* const kNames[kCurveCount] = {
+    "linear",
+    "inQuad", "outQuad", "inOutQuad",
+    "inCubic", "outCubic", "inOutCubic",
+    "inSine", "outSine", "inOutSine",
+    "inBack", "outBack",
+    "outBounce",
+    "outElastic",
+};
+
+float outBounce(float t) {
+    const float n1 = 7.5625f;
+    const float d1 = 2.75f;
+    if (t < 1.0f / d1) {
+        return n1 * t * t;
+    }
+    if (t < 2.0f / d1) {
+        t -= 1.5f / d1;
+        return n1 * t * t + 0.75f;
+    }
+    if (t < 2.5f / d1) {
+        t -= 2.25f / d1;
+        return n1 * t * t + 0.9375f;
+    }
+    t -= 2.625f / d1;
+    return n1 * t * t + 0.984375f;
+}
+
+// 곡선별 표본 (Linear 자리는 비워 둠). 함수 안 static이라 처음 evaluate에서 한 번만 생성
+using Table = std::array<float, Easing::kTableSize + 1>;
+
+const std::array<Table, kCurveCount>& tables() {
+    static const std::array<Table, kCurveCount> built = []() {
+        std::array<Table, kCurveCount> result{};
+        for (int curve = 1; curve < kCurveCount; curve++) {
+            for (int i = 0; i <= Easing::kTableSize; i++) {
+                float t = static_cast<float>(i) / Easing::kTableSize;
+                result[curve][i] = Easing::evaluateExact(static_cast<Easing::Type>(curve), t);
+            }
+        }
+        return result;
+    }();
+    return built;
+}
+
+}  // namespace
+
+namespace Easing {
+
+float evaluateExact(Type type, float t) {
+    t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    switch (type) {
+        case Type::InQuad: return t * t;
+        case Type::OutQuad: return 1.0f - (1.0f - t) * (1.0f - t);
+        case Type::InOutQuad:
+            return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 2.0f) / 2.0f;
+        case Type::InCubic: return t * t * t;
+        case Type::OutCubic: return 1.0f - std::pow(1.0f - t, 3.0f);
+        case Type::InOutCubic:
+            return t < 0.5f ? 4.0f * t * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 3.0f) / 2.0f;
+        case Type::InSine: return 1.0f - std::cos(t * kPi / 2.0f);
+        case Type::OutSine: return std::sin(t * kPi / 2.0f);
+        case Type::InOutSine: return -(std::cos(kPi * t) - 1.0f) / 2.0f;
+        case Type::InBack: {
+            const float c1 = 1.70158f;
+            return (c1 + 1.0f) * t * t * t - c1 * t * t;
+        }
+        case Type::OutBack: {
+            const float c1 = 1.70158f;
+            const float u = t - 1.0f;
+            return 1.0f + (c1 + 1.0f) * u * u * u + c1 * u * u;
+        }
+        case Type::OutBounce: return outBounce(t);
+        case Type::OutElastic: {
+            if (t <= 0.0f || t >= 1.0f) return t;
+            const float c4 = (2.0f * kPi) / 3.0f;
+            return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f - 0.75f) * c4) + 1.0f;
+        }
+        default: return t;
+    }
+}
+
+float evaluate(Type type, float t) {
+    if (type == Type::Linear || type >= Type::Count) {
+        return t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    }
+    if (t <= 0.0f) return 0.0f;
+    if (t >= 1.0f) return 1.0f;
+
+    const Table& table = tables()[static_cast<int>(type)];
+    float position = t * kTableSize;
+    int i = static_cast<int>(position);
+    float fraction = position - static_cast<float>(i);
+    return table[i] + (table[i + 1] - table[i]) * fraction;
+}
+
+bool fromName(const std::string& name, Type& outType) {
+    for (int curve = 0; curve < kCurveCount; curve++) {
+        if (name == kNames[curve]) {
+            outType = static_cast<Type>(curve);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* getName(Type type) {
+    int curve = static_cast<int>(type);
+    return curve >= 0 && curve < kCurveCount ? kNames[curve] : "linear";
+}
+
+}  // namespace Easing
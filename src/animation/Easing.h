@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * 애니메이션 보간 곡선.
+ * 선형 외의 곡선은 처음 사용할 때 곡선마다 kTableSize+1개 표본을 만들어 두고, 평가 시 두 표본을 선형 보간한다.
+ * (매 프레임 트윈마다 sin/pow를 계산하지 않음. 최대 오차는 1/kTableSize 구간 내 곡률 수준)
+ */
+namespace Easing {
+    enum class Type : uint8_t {
+        Linear,
+        InQuad, OutQuad, InOutQuad,
+        InCubic, OutCubic, InOutCubic,
+        InSine, OutSine, InOutSine,
+        InBack, OutBack,
+        OutBounce,
+        OutElastic,
+        Count
+    };
+
+    constexpr int kTableSize = 256;
+
+    // t는 0~1로 잘라서 평가 (Back/Elastic은 결과가 0~1 밖으로 나갈 수 있음)
+    float evaluate(Type type, float t);
+    // 표 없이 정확한 값 (표 생성/비교용)
+    float evaluateExact(Type type, float t);
+
+    // "outCubic" 같은 이름 → 곡선. 모르는 이름이면 false
+    bool fromName(const std::string& name, Type& outType);
+    const char* getName(Type type);
+}
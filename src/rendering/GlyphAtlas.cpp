@@ -0,0 +1,445 @@
+#include "GlyphAtlas.h"
+#include "../utils/logger.h"
+#include "../utils/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// UTF-8 한 글자 디코딩 (잘못된 바이트는 U+FFFD로 바꾸고 한 바이트만 소비)
+Uint32 decodeUtf8(const std::string& text, size_t& index) {
+    unsigned char c = static_cast<unsigned char>(text[index]);
+    int length = 1;
+    Uint32 codepoint = 0xFFFD;
+    if (c < 0x80) {
+        codepoint = c;
+    } else if ((c & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = c & 0x07;
+    } else {
+        index++;
+        return 0xFFFD;
+    }
+    if (index + length > text.size()) {
+        index++;
+        return 0xFFFD;
+    }
+    for (int i = 1; i < length; i++) {
+        unsigned char next = static_cast<unsigned char>(text[index + i]);
+        if ((next & 0xC0) != 0x80) {
+            index++;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+    index += length;
+    return codepoint;
+}
+
+int getKerning(TTF_Font* font, Uint32 previous, Uint32 codepoint) {
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+    return TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+#else
+    if (previous > 0xFFFF || codepoint > 0xFFFF) return 0;
+    return TTF_GetFontKerningSizeGlyphs(font, static_cast<Uint16>(previous), static_cast<Uint16>(codepoint));
+#endif
+}
+
+bool isSpace(Uint32 codepoint) {
+    return codepoint == ' ' || codepoint == '\t' || codepoint == 0x3000;
+}
+
+// 거리장 값(128 = 경계, 양 끝 = ±kSpread텍셀) → 램프 단계 배율에서 화면 1픽셀 폭 램프의 알파
+void buildRampTable(int step, Uint8 (&table)[256]) {
+    const float pixelsPerTexel = std::pow(2.0f, step * 0.5f);
+    for (int value = 0; value < 256; value++) {
+        float distance = (value / 255.0f - 0.5f) * 2.0f * GlyphAtlas::kSpread;
+        float alpha = std::clamp(0.5f + distance * pixelsPerTexel, 0.0f, 1.0f);
+        table[value] = static_cast<Uint8>(alpha * 255.0f + 0.5f);
+    }
+}
+
+}  // namespace
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* sdlRenderer, bool useDistanceField)
+    : renderer(sdlRenderer), distanceField(useDistanceField) {}
+
+GlyphAtlas::~GlyphAtlas() {
+    clear();
+}
+
+void GlyphAtlas::clear() {
+    for (Page& page : pages) {
+        if (page.texture) SDL_DestroyTexture(page.texture);
+        for (const RampTexture& ramp : page.rampTextures) {
+            SDL_DestroyTexture(ramp.texture);
+        }
+    }
+    pages.clear();
+    glyphs.clear();
+}
+
+int GlyphAtlas::getGlyphCount() const {
+    int count = 0;
+    for (const auto& fontGlyphs : glyphs) {
+        count += static_cast<int>(fontGlyphs.second.size());
+    }
+    return count;
+}
+
+size_t GlyphAtlas::getTextureBytes() const {
+    size_t textureCount = pages.size();
+    for (const Page& page : pages) {
+        textureCount += page.rampTextures.size();
+    }
+    return textureCount * static_cast<size_t>(kPageSize) * kPageSize * 4;
+}
+
+SDL_Texture* GlyphAtlas::createPageTexture() {
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+    if (!texture) {
+        Log::error("[GlyphAtlas] Failed to create page texture: ", SDL_GetError());
+        return nullptr;
+    }
+    // STATIC 텍스처는 초기 내용이 정해져 있지 않으므로 투명으로 채움 (페이지당 한 번)
+    std::vector<Uint32> clearPixels(static_cast<size_t>(kPageSize) * kPageSize, 0);
+    SDL_UpdateTexture(texture, nullptr, clearPixels.data(), kPageSize * 4);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+    if (distanceField) {
+        // 램프는 보간해야 경계가 매끄러움 (렌더 힌트와 무관하게 선형)
+        SDL_SetTextureScaleMode(texture, SDL_ScaleModeLinear);
+    }
+#endif
+    return texture;
+}
+
+bool GlyphAtlas::addPage() {
+    Page page;
+    page.texture = createPageTexture();
+    if (!page.texture) {
+        return false;
+    }
+    if (distanceField) {
+        page.field.assign(static_cast<size_t>(kPageSize) * kPageSize, 0);
+    }
+    pages.push_back(std::move(page));
+    Log::info("[GlyphAtlas] Added page ", pages.size(), " (", getGlyphCount(), " glyphs cached)");
+    return true;
+}
+
+bool GlyphAtlas::rasterize(TTF_Font* font, Uint32 codepoint, Glyph& outGlyph) {
+    PROFILE_SCOPE("GlyphAtlas::rasterize");
+    SDL_Color white = {255, 255, 255, 255};  // 색은 정점 색으로 입힘
+    SDL_Surface* rendered = nullptr;
+    int advance = 0;
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+    if (TTF_GlyphMetrics32(font, codepoint, nullptr, nullptr, nullptr, nullptr, &advance) != 0) {
+        return false;
+    }
+    if (!isSpace(codepoint)) {
+        rendered = TTF_RenderGlyph32_Blended(font, codepoint, white);
+    }
+#else
+    if (codepoint > 0xFFFF) return false;
+    if (TTF_GlyphMetrics(font, static_cast<Uint16>(codepoint), nullptr, nullptr, nullptr, nullptr, &advance) != 0) {
+        return false;
+    }
+    if (!isSpace(codepoint)) {
+        rendered = TTF_RenderGlyph_Blended(font, static_cast<Uint16>(codepoint), white);
+    }
+#endif
+    outGlyph.advance = advance;
+    outGlyph.page = -1;
+    if (!rendered) {
+        return true;  // 공백: 진행 폭만 있음
+    }
+
+    SDL_Surface* surface = rendered;
+    if (rendered->format->format != SDL_PIXELFORMAT_RGBA32) {
+        surface = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(rendered);
+        if (!surface) return true;
+    }
+    if (distanceField) {
+        SDL_Surface* field = buildDistanceField(surface);
+        SDL_FreeSurface(surface);
+        if (!field) return true;
+        surface = field;
+        outGlyph.offset = -kSpread;
+    }
+
+    int paddedW = surface->w + kPadding;
+    int paddedH = surface->h + kPadding;
+    SDL_Rect placed;
+    int pageIndex = -1;
+    for (size_t i = 0; i < pages.size(); i++) {
+        if (pages[i].packer.insert(paddedW, paddedH, placed)) {
+            pageIndex = static_cast<int>(i);
+            break;
+        }
+    }
+    if (pageIndex < 0 && paddedW <= kPageSize && paddedH <= kPageSize && addPage() &&
+        pages.back().packer.insert(paddedW, paddedH, placed)) {
+        pageIndex = static_cast<int>(pages.size()) - 1;
+    }
+    if (pageIndex >= 0) {
+        outGlyph.page = pageIndex;
+        outGlyph.rect = {placed.x, placed.y, surface->w, surface->h};
+        Page& page = pages[pageIndex];
+        if (distanceField) {
+            // 거리장을 CPU 사본에 옮기고, 이미 만들어진 램프 단계 텍스처마다 같은 영역을 갱신
+            SDL_LockSurface(surface);
+            for (int y = 0; y < surface->h; y++) {
+                const Uint8* src = static_cast<const Uint8*>(surface->pixels) + y * surface->pitch;
+                Uint8* dst = &page.field[static_cast<size_t>(placed.y + y) * kPageSize + placed.x];
+                for (int x = 0; x < surface->w; x++) {
+                    dst[x] = src[x * 4 + 3];
+                }
+            }
+            SDL_UnlockSurface(surface);
+            uploadRamp(page, page.texture, 0, outGlyph.rect);
+            for (const RampTexture& ramp : page.rampTextures) {
+                uploadRamp(page, ramp.texture, ramp.step, outGlyph.rect);
+            }
+        } else {
+            SDL_UpdateTexture(page.texture, &outGlyph.rect, surface->pixels, surface->pitch);
+        }
+    } else {
+        Log::error("[GlyphAtlas] Glyph ", codepoint, " does not fit in a page");
+    }
+    SDL_FreeSurface(surface);
+    return true;
+}
+
+SDL_Surface* GlyphAtlas::buildDistanceField(SDL_Surface* coverage) {
+    const int srcW = coverage->w;
+    const int srcH = coverage->h;
+    const int outW = srcW + kSpread * 2;
+    const int outH = srcH + kSpread * 2;
+    SDL_Surface* field = SDL_CreateRGBSurfaceWithFormat(0, outW, outH, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!field) {
+        Log::error("[GlyphAtlas] Failed to create distance field surface: ", SDL_GetError());
+        return nullptr;
+    }
+
+    // 커버리지(0~1)를 kSpread만큼 둘러싼 격자로 옮김 (바깥은 0)
+    std::vector<float> alpha(static_cast<size_t>(outW) * outH, 0.0f);
+    SDL_LockSurface(coverage);
+    for (int y = 0; y < srcH; y++) {
+        const Uint8* row = static_cast<const Uint8*>(coverage->pixels) + y * coverage->pitch;
+        for (int x = 0; x < srcW; x++) {
+            alpha[(y + kSpread) * outW + (x + kSpread)] = row[x * 4 + 3] / 255.0f;
+        }
+    }
+    SDL_UnlockSurface(coverage);
+
+    // 부호 있는 거리 (안쪽 +). 반대 상태 텍셀까지의 최단 거리를 kSpread 반경에서 찾고,
+    // 경계 바로 옆 텍셀은 안티앨리어싱 커버리지로 서브픽셀 위치를 보정
+    auto inside = [&](int x, int y) { return alpha[y * outW + x] >= 0.5f; };
+    const float maxDistance = static_cast<float>(kSpread);
+    SDL_LockSurface(field);
+    for (int y = 0; y < outH; y++) {
+        Uint8* row = static_cast<Uint8*>(field->pixels) + y * field->pitch;
+        for (int x = 0; x < outW; x++) {
+            bool in = inside(x, y);
+            float nearest = maxDistance;
+            for (int dy = -kSpread; dy <= kSpread; dy++) {
+                int sy = y + dy;
+                if (sy < 0 || sy >= outH) continue;
+                for (int dx = -kSpread; dx <= kSpread; dx++) {
+                    int sx = x + dx;
+                    if (sx < 0 || sx >= outW || inside(sx, sy) == in) continue;
+                    float d = std::sqrt(static_cast<float>(dx * dx + dy * dy));
+                    if (d < nearest) nearest = d;
+                }
+            }
+            float distance;
+            if (nearest <= 1.0f) {
+                distance = alpha[y * outW + x] - 0.5f;
+            } else {
+                distance = (nearest - 0.5f) * (in ? 1.0f : -1.0f);
+            }
+            // ±kSpread 범위 전체를 0~255로 (임계값은 그릴 때 램프 단계 텍스처에서 적용)
+            float value = std::clamp(0.5f + distance / (2.0f * maxDistance), 0.0f, 1.0f);
+            row[x * 4 + 0] = 255;
+            row[x * 4 + 1] = 255;
+            row[x * 4 + 2] = 255;
+            row[x * 4 + 3] = static_cast<Uint8>(value * 255.0f + 0.5f);
+        }
+    }
+    SDL_UnlockSurface(field);
+    return field;
+}
+
+void GlyphAtlas::uploadRamp(const Page& page, SDL_Texture* texture, int step, const SDL_Rect& rect) {
+    Uint8 table[256];
+    buildRampTable(step, table);
+    std::vector<Uint8> pixels(static_cast<size_t>(rect.w) * rect.h * 4);
+    for (int y = 0; y < rect.h; y++) {
+        const Uint8* src = &page.field[static_cast<size_t>(rect.y + y) * kPageSize + rect.x];
+        Uint8* dst = &pixels[static_cast<size_t>(y) * rect.w * 4];
+        for (int x = 0; x < rect.w; x++) {
+            dst[x * 4 + 0] = 255;
+            dst[x * 4 + 1] = 255;
+            dst[x * 4 + 2] = 255;
+            dst[x * 4 + 3] = table[src[x]];
+        }
+    }
+    SDL_UpdateTexture(texture, &rect, pixels.data(), rect.w * 4);
+}
+
+SDL_Texture* GlyphAtlas::getDrawTexture(SDL_Texture* pageTexture, float pixelsPerTexel) {
+    if (!distanceField || pixelsPerTexel <= 0.0f) {
+        return pageTexture;
+    }
+    int step = static_cast<int>(std::lround(2.0f * std::log2(pixelsPerTexel)));
+    step = std::clamp(step, kMinRampStep, 0);
+    if (step == 0) {
+        return pageTexture;
+    }
+
+    for (Page& page : pages) {
+        if (page.texture != pageTexture) continue;
+        for (const RampTexture& ramp : page.rampTextures) {
+            if (ramp.step == step) return ramp.texture;
+        }
+        // 이 페이지에서 처음 쓰는 단계: 페이지 전체를 변환해 한 번 만듦
+        SDL_Texture* texture = createPageTexture();
+        if (!texture) {
+            return pageTexture;
+        }
+        uploadRamp(page, texture, step, SDL_Rect{0, 0, kPageSize, kPageSize});
+        page.rampTextures.push_back({step, texture});
+        Log::info("[GlyphAtlas] Added ramp step ", step, " for a distance field page (",
+                  getTextureBytes() / (1024 * 1024), "MB)");
+        return texture;
+    }
+    return pageTexture;
+}
+
+const GlyphAtlas::Glyph* GlyphAtlas::getGlyph(TTF_Font* font, Uint32 codepoint) {
+    auto& fontGlyphs = glyphs[font];
+    auto it = fontGlyphs.find(codepoint);
+    if (it != fontGlyphs.end()) {
+        return &it->second;
+    }
+    Glyph glyph;
+    if (!rasterize(font, codepoint, glyph)) {
+        // 폰트에 없는 글자도 기록 (매번 다시 시도하지 않음, 폭 0)
+        glyph = Glyph{};
+    }
+    return &fontGlyphs.emplace(codepoint, glyph).first->second;
+}
+
+bool GlyphAtlas::layout(TTF_Font* font, const std::string& text, int wrapWidth, int maxHeight, TextRun& outRun) {
+    outRun.quads.clear();
+    outRun.width = 0;
+    outRun.height = 0;
+    outRun.unitScale = 1.0f;
+    outRun.distanceFieldAtlas = distanceField ? this : nullptr;
+    if (!font || !renderer) return false;
+
+    struct Placed {
+        const Glyph* glyph;
+        int x;
+        int line;
+    };
+    std::vector<Placed> placed;
+    placed.reserve(text.size());
+
+    const size_t kNone = static_cast<size_t>(-1);
+    int line = 0;
+    int penX = 0;
+    size_t lineStart = 0;
+    size_t lastSpace = kNone;  // 현재 줄의 마지막 공백 (줄바꿈 후보)
+    bool wrapped = false;      // 현재 줄이 자동 줄바꿈으로 시작했는지 (앞 공백 생략)
+    Uint32 previous = 0;
+
+    for (size_t i = 0; i < text.size();) {
+        Uint32 codepoint = decodeUtf8(text, i);
+        if (codepoint == '\r') continue;
+        if (codepoint == '\n') {
+            line++;
+            penX = 0;
+            lineStart = placed.size();
+            lastSpace = kNone;
+            wrapped = false;
+            previous = 0;
+            continue;
+        }
+
+        bool space = isSpace(codepoint);
+        if (space && wrapped && placed.size() == lineStart) {
+            continue;
+        }
+
+        const Glyph* glyph = getGlyph(font, codepoint);
+        int kerning = previous ? getKerning(font, previous, codepoint) : 0;
+
+        if (wrapWidth > 0 && !space && placed.size() > lineStart && penX + kerning + glyph->advance > wrapWidth) {
+            if (lastSpace != kNone && lastSpace + 1 < placed.size()) {
+                // 마지막 공백 뒤 단어를 다음 줄로 옮김
+                int shift = placed[lastSpace + 1].x;
+                for (size_t k = lastSpace + 1; k < placed.size(); k++) {
+                    placed[k].x -= shift;
+                    placed[k].line = line + 1;
+                }
+                penX -= shift;
+                lineStart = lastSpace + 1;
+            } else {
+                // 공백이 없으면 (긴 단어, 공백 없는 한글 문장) 글자 단위로 줄바꿈
+                penX = 0;
+                lineStart = placed.size();
+            }
+            line++;
+            lastSpace = kNone;
+            wrapped = true;
+            kerning = 0;
+        }
+
+        placed.push_back({glyph, penX + kerning, line});
+        if (space) lastSpace = placed.size() - 1;
+        penX += kerning + glyph->advance;
+        previous = codepoint;
+    }
+
+    int lineSkip = TTF_FontLineSkip(font);
+    int cellHeight = TTF_FontHeight(font);
+    int lineCount = placed.empty() ? 0 : line + 1;
+
+    outRun.quads.reserve(placed.size());
+    for (const Placed& p : placed) {
+        int right = p.x + std::max(p.glyph->advance, p.glyph->rect.w + p.glyph->offset * 2);
+        outRun.width = std::max(outRun.width, right);
+        if (p.glyph->page < 0) continue;
+
+        GlyphQuad quad;
+        quad.texture = pages[p.glyph->page].texture;
+        quad.src = p.glyph->rect;
+        quad.dst = {p.x + p.glyph->offset, p.line * lineSkip + p.glyph->offset, p.glyph->rect.w, p.glyph->rect.h};
+        if (maxHeight > 0 && quad.dst.y + quad.dst.h > maxHeight) {
+            // maxHeight 아래는 잘라냄 (기존 surface 클리핑과 같은 결과)
+            int visible = maxHeight - quad.dst.y;
+            if (visible <= 0) continue;
+            quad.src.h = visible;
+            quad.dst.h = visible;
+        }
+        outRun.quads.push_back(quad);
+    }
+
+    if (lineCount > 0) {
+        outRun.height = (lineCount - 1) * lineSkip + cellHeight;
+        if (maxHeight > 0 && outRun.height > maxHeight) {
+            outRun.height = maxHeight;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+#include "../resource/TextureAtlas.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GlyphAtlas;
+
+// 글리프 하나를 그릴 쿼드 (dst는 텍스트 좌상단 (0,0) 기준)
+struct GlyphQuad {
+    SDL_Texture* texture = nullptr;  // 글리프 아틀라스 페이지
+    SDL_Rect src = {0, 0, 0, 0};
+    SDL_Rect dst = {0, 0, 0, 0};
+};
+
+// 레이아웃 결과: 쿼드 목록 + 전체 크기 (TTF_RenderUTF8_Blended(_Wrapped) 결과 텍스처 크기에 해당)
+struct TextRun {
+    std::vector<GlyphQuad> quads;
+    int width = 0;
+    int height = 0;
+    float unitScale = 1.0f;  // 쿼드 좌표 1단위가 width/height 기준 몇 픽셀인지 (SDF는 기준 크기 → 요청 크기)
+    GlyphAtlas* distanceFieldAtlas = nullptr;  // SDF면 그릴 때 getDrawTexture로 배율에 맞는 페이지를 고름
+};
+
+/**
+ * 글리프 아틀라스.
+ * (폰트, 크기)별 글리프를 처음 쓰일 때 한 번만 흰색으로 래스터화해서 kPageSize 페이지에 패킹하고,
+ * 문자열은 페이지 영역을 가리키는 쿼드 목록으로 레이아웃한다. 색상은 그릴 때 정점 색으로 입힌다.
+ * 한글 음절처럼 글자 수가 많은 문자도 화면에 나온 글자만 올라간다.
+ *
+ * 페이지는 TextRenderer가 살아 있는 동안 유지된다 (UIElement가 페이지 포인터를 들고 있음).
+ *
+ * distanceField 모드: 글리프마다 부호 있는 거리장을 계산해서 kSpread 범위 전체를 0~255로 CPU 사본(Page::field)에
+ * 보관한다 (128 = 경계). SDL_Renderer에는 프래그먼트 셰이더가 없으므로 임계값은 그릴 때 배율별 페이지 텍스처로 적용한다:
+ * getDrawTexture가 화면 1픽셀 폭의 가파른 알파 램프(경계 0.5 중심)로 변환한 텍스처를 배율 단계마다 한 번 만들어 재사용.
+ * 큰 기준 크기 한 벌로 모든 글자 크기/스케일 애니메이션을 처리 (TextRenderer::kDistanceFieldBaseSize).
+ */
+class GlyphAtlas {
+public:
+    static constexpr int kPageSize = 1024;
+    static constexpr int kPadding = 1;  // 글리프 사이 투명 여백 (확대 시 이웃 글리프 번짐 방지)
+    static constexpr int kSpread = 4;   // distanceField 모드에서 글리프 둘레로 거리를 계산하는 범위 (텍셀)
+    // 램프 단계: 화면 픽셀/텍셀 배율을 2^(단계/2)로 반올림. 0 = 1배(램프 1텍셀), 최소 단계 = 램프가 kSpread*2텍셀 전체
+    static constexpr int kMinRampStep = -6;
+
+    explicit GlyphAtlas(SDL_Renderer* renderer, bool distanceField = false);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    // wrapWidth > 0이면 공백 기준 줄바꿈 (한 단어가 너무 길면 글자 단위), maxHeight > 0이면 아래를 잘라냄
+    bool layout(TTF_Font* font, const std::string& text, int wrapWidth, int maxHeight, TextRun& outRun);
+
+    // distanceField 모드: 쿼드의 페이지 텍스처를 화면 배율(텍셀당 픽셀)에 맞게 임계값을 적용한 텍스처로 바꿈.
+    // 일반 모드나 1배 이상이면 그대로 (확대 시에는 선형 필터링이 1텍셀 램프를 보간)
+    SDL_Texture* getDrawTexture(SDL_Texture* pageTexture, float pixelsPerTexel);
+
+    SDL_Renderer* getRenderer() const { return renderer; }
+    bool isDistanceField() const { return distanceField; }
+    int getPageCount() const { return static_cast<int>(pages.size()); }
+    int getGlyphCount() const;
+    size_t getTextureBytes() const;  // 배율별 임계값 텍스처 포함 (거리장 CPU 사본은 제외)
+
+    // 모든 페이지와 글리프 해제 (폰트를 닫기 전에 호출. 이전 레이아웃의 쿼드는 무효)
+    void clear();
+
+private:
+    struct Glyph {
+        int page = -1;             // -1이면 그릴 픽셀 없음 (공백 등)
+        SDL_Rect rect = {0, 0, 0, 0};  // 페이지 내 영역 (셀 = 한 글자 렌더 결과, 높이는 폰트 높이)
+        int offset = 0;                // 셀 대비 영역 시작 위치 (distanceField 모드는 -kSpread)
+        int advance = 0;
+    };
+    struct RampTexture {
+        int step = 0;
+        SDL_Texture* texture = nullptr;
+    };
+    struct Page {
+        SDL_Texture* texture = nullptr;  // distanceField 모드는 램프 단계 0 텍스처
+        SkylinePacker packer{kPageSize, kPageSize};
+        std::vector<Uint8> field;              // distanceField 모드: 거리장 (kPageSize x kPageSize)
+        std::vector<RampTexture> rampTextures;  // 단계 0 이외에 그려진 적 있는 램프 단계
+    };
+
+    SDL_Renderer* renderer;
+    bool distanceField;
+    std::vector<Page> pages;
+    std::unordered_map<TTF_Font*, std::unordered_map<Uint32, Glyph>> glyphs;
+
+    const Glyph* getGlyph(TTF_Font* font, Uint32 codepoint);
+    bool rasterize(TTF_Font* font, Uint32 codepoint, Glyph& outGlyph);
+    SDL_Surface* buildDistanceField(SDL_Surface* coverage);  // RGBA32 커버리지 → kSpread만큼 넓힌 RGBA32 거리장 (알파)
+    bool addPage();
+    SDL_Texture* createPageTexture();
+    void uploadRamp(const Page& page, SDL_Texture* texture, int step, const SDL_Rect& rect);  // field → 램프 알파
+};
@@ -1,11 +1,12 @@
 #include "ImageRenderer.h"
 #include "TextRenderer.h"
+#include "RasterKernels.h"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
 
 ImageRenderer::ImageRenderer(SDL_Renderer* sdlRenderer, int w, int h)
-    : renderer(sdlRenderer), width(w), height(h), needsUpdate(true), cachedTexture(nullptr) {
+    : renderer(sdlRenderer), width(w), height(h), cachedTexture(nullptr), dirtyCount(0) {
     // RGBA 포맷의 surface 생성
     surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
     if (!surface) {
@@ -35,21 +36,55 @@ void ImageRenderer::unlockSurface() {
 }
 
 void ImageRenderer::updateTexture() {
-    if (cachedTexture) {
-        SDL_DestroyTexture(cachedTexture);
-        cachedTexture = nullptr;
-    }
+    if (!surface || !renderer) return;
     
-    if (surface && renderer) {
-        cachedTexture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!cachedTexture) {
+        // surface와 같은 포맷의 스트리밍 텍스처 (이후 그리기는 바뀐 영역만 SDL_UpdateTexture)
+        cachedTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING, width, height);
         if (!cachedTexture) {
             SDL_Log("ImageRenderer: Failed to create texture: %s", SDL_GetError());
-        } else {
-            // 투명도 유지를 위한 블렌딩 모드 설정
-            SDL_SetTextureBlendMode(cachedTexture, SDL_BLENDMODE_BLEND);
+            return;
+        }
+        // 투명도 유지를 위한 블렌딩 모드 설정
+        SDL_SetTextureBlendMode(cachedTexture, SDL_BLENDMODE_BLEND);
+        dirtyRects[0] = {0, 0, width, height};
+        dirtyCount = 1;
+    }
+    
+    lockSurface();
+    const Uint8* pixels = static_cast<const Uint8*>(surface->pixels);
+    for (int i = 0; i < dirtyCount; i++) {
+        const SDL_Rect& rect = dirtyRects[i];
+        const Uint8* start = pixels + rect.y * surface->pitch + rect.x * 4;
+        if (SDL_UpdateTexture(cachedTexture, &rect, start, surface->pitch) != 0) {
+            SDL_Log("ImageRenderer: Failed to update texture: %s", SDL_GetError());
         }
-        needsUpdate = false;
     }
+    unlockSurface();
+    dirtyCount = 0;
+}
+
+void ImageRenderer::markDirty(const SDL_Rect& rect) {
+    SDL_Rect bounds = {0, 0, width, height};
+    SDL_Rect clipped;
+    if (!SDL_IntersectRect(&rect, &bounds, &clipped)) return;
+    
+    // 겹치는 영역이 있으면 합치고, 칸이 모자라면 전부 하나로 합침
+    for (int i = 0; i < dirtyCount; i++) {
+        if (SDL_HasIntersection(&dirtyRects[i], &clipped)) {
+            SDL_UnionRect(&dirtyRects[i], &clipped, &dirtyRects[i]);
+            return;
+        }
+    }
+    if (dirtyCount < kMaxDirtyRects) {
+        dirtyRects[dirtyCount++] = clipped;
+        return;
+    }
+    for (int i = 1; i < dirtyCount; i++) {
+        SDL_UnionRect(&dirtyRects[0], &dirtyRects[i], &dirtyRects[0]);
+    }
+    SDL_UnionRect(&dirtyRects[0], &clipped, &dirtyRects[0]);
+    dirtyCount = 1;
 }
 
 void ImageRenderer::drawPixel(int x, int y, SDL_Color color) {
@@ -64,7 +99,7 @@ void ImageRenderer::drawPixel(int x, int y, SDL_Color color) {
     pixels[y * surface->pitch / 4 + x] = pixelColor;
     
     unlockSurface();
-    needsUpdate = true;
+    markDirty({x, y, 1, 1});
 }
 
 void ImageRenderer::drawColor(SDL_Color color) {
@@ -72,131 +107,94 @@ void ImageRenderer::drawColor(SDL_Color color) {
     
     SDL_Rect rect = {0, 0, width, height};
     SDL_FillRect(surface, &rect, SDL_MapRGBA(surface->format, color.r, color.g, color.b, color.a));
-    needsUpdate = true;
+    markDirty(rect);
 }
 
-void ImageRenderer::drawText(const std::string& text, int x, int y, int fontSize, SDL_Color color, TextRenderer* textRenderer, int maxWidth) {
-    if (!surface || !textRenderer || !renderer) return;
-    
-    // TextRenderer로 텍스처 생성
-    SDL_Texture* textTexture = textRenderer->renderText(renderer, text, fontSize, color, maxWidth);
-    if (!textTexture) return;
-    
-    // 텍스처 크기 가져오기
-    int texW, texH;
-    SDL_QueryTexture(textTexture, nullptr, nullptr, &texW, &texH);
-    
-    // 임시 렌더 타겟 생성 (텍스처를 surface로 변환하기 위해)
-    SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
+void ImageRenderer::drawText(const std::string& text, int x, int y, int fontSize, SDL_Color color, TextRenderer* textRenderer, int maxWidth,
+                             const std::string& fontName) {
+    if (!surface || !textRenderer) return;
     
-    // 텍스처를 임시 surface로 변환하기 위해 렌더 타겟을 텍스처로 설정
-    // 하지만 더 나은 방법: 임시 렌더 타겟 surface 생성
-    SDL_Surface* textSurface = SDL_CreateRGBSurfaceWithFormat(0, texW, texH, 32, SDL_PIXELFORMAT_RGBA32);
-    if (!textSurface) {
-        SDL_DestroyTexture(textTexture);
-        return;
-    }
-    
-    // 텍스처를 임시 렌더 타겟으로 렌더링하고 읽기
-    SDL_Texture* tempTarget = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, texW, texH);
-    if (tempTarget) {
-        SDL_SetRenderTarget(renderer, tempTarget);
-        SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, textTexture, nullptr, nullptr);
-        SDL_RenderReadPixels(renderer, nullptr, textSurface->format->format, textSurface->pixels, textSurface->pitch);
-        SDL_SetRenderTarget(renderer, oldTarget);
-        SDL_DestroyTexture(tempTarget);
-    } else {
-        // 실패 시 기존 타겟 복원
-        SDL_SetRenderTarget(renderer, oldTarget);
-        SDL_FreeSurface(textSurface);
-        SDL_DestroyTexture(textTexture);
-        return;
-    }
+    // 텍스처를 거치지 않고 surface로 바로 받아서 blit
+    SDL_Surface* textSurface = TextRenderer::renderSurface(textRenderer->getFont(fontName, fontSize), text, color, maxWidth);
+    if (!textSurface) return;
     
-    // surface에 blit
-    SDL_Rect dstRect = {x, y, texW, texH};
-    SDL_BlitSurface(textSurface, nullptr, surface, &dstRect);
+    SDL_Rect dstRect = {x, y, textSurface->w, textSurface->h};
+    blitSurface(textSurface, {0, 0, textSurface->w, textSurface->h}, dstRect);
     
     SDL_FreeSurface(textSurface);
-    SDL_DestroyTexture(textTexture);
-    needsUpdate = true;
+    markDirty(dstRect);
 }
 
 void ImageRenderer::drawRect(int x, int y, int w, int h, SDL_Color color, bool filled) {
-    if (!surface) return;
+    if (!surface || w <= 0 || h <= 0) return;
     
-    // 범위 체크
-    if (x >= width || y >= height || x + w < 0 || y + h < 0) {
+    SDL_Rect rect = {x, y, w, h};
+    SDL_Rect bounds = {0, 0, width, height};
+    SDL_Rect clipped;
+    if (!SDL_IntersectRect(&rect, &bounds, &clipped)) {
         return;
     }
     
-    // 클리핑
-    int drawX = std::max(0, x);
-    int drawY = std::max(0, y);
-    int drawW = std::min(w, width - drawX);
-    int drawH = std::min(h, height - drawY);
-    
-    SDL_Rect rect = {drawX, drawY, drawW, drawH};
     Uint32 pixelColor = SDL_MapRGBA(surface->format, color.r, color.g, color.b, color.a);
     
     if (filled) {
-        SDL_FillRect(surface, &rect, pixelColor);
+        SDL_FillRect(surface, &clipped, pixelColor);
     } else {
-        // 테두리만 그리기
+        // 테두리만 그리기 (화면 밖으로 나간 변은 그리지 않음)
         lockSurface();
         Uint32* pixels = (Uint32*)surface->pixels;
         int pitch = surface->pitch / 4;
+        int right = x + w - 1;
+        int bottom = y + h - 1;
         
-        // 상단/하단 테두리
-        for (int px = drawX; px < drawX + drawW; px++) {
-            if (px >= 0 && px < width) {
-                if (drawY >= 0 && drawY < height) {
-                    pixels[drawY * pitch + px] = pixelColor;
-                }
-                if (drawY + drawH - 1 >= 0 && drawY + drawH - 1 < height) {
-                    pixels[(drawY + drawH - 1) * pitch + px] = pixelColor;
-                }
-            }
+        // 상단/하단 테두리 (행 단위)
+        if (y >= 0 && y < height) {
+            RasterKernels::fillSpan(pixels + y * pitch + clipped.x, clipped.w, pixelColor);
+        }
+        if (bottom != y && bottom >= 0 && bottom < height) {
+            RasterKernels::fillSpan(pixels + bottom * pitch + clipped.x, clipped.w, pixelColor);
         }
         
         // 좌측/우측 테두리
-        for (int py = drawY; py < drawY + drawH; py++) {
-            if (py >= 0 && py < height) {
-                if (drawX >= 0 && drawX < width) {
-                    pixels[py * pitch + drawX] = pixelColor;
-                }
-                if (drawX + drawW - 1 >= 0 && drawX + drawW - 1 < width) {
-                    pixels[py * pitch + drawX + drawW - 1] = pixelColor;
-                }
-            }
+        for (int py = clipped.y; py < clipped.y + clipped.h; py++) {
+            Uint32* row = pixels + py * pitch;
+            if (x >= 0 && x < width) row[x] = pixelColor;
+            if (right != x && right >= 0 && right < width) row[right] = pixelColor;
         }
         
         unlockSurface();
     }
     
-    needsUpdate = true;
+    markDirty(clipped);
 }
 
-void ImageRenderer::drawCircle(int centerX, int centerY, int radius, SDL_Color color, bool filled) {
+void ImageRenderer::drawCircle(int centerX, int centerY, int radius, SDL_Color color, bool filled, bool antiAliased) {
     if (!surface || radius <= 0) return;
     
+    if (filled && antiAliased) {
+        // 픽셀 (centerX, centerY)의 중심을 원점으로 하는 반지름 radius + 0.5 원
+        drawRoundedRect(centerX - radius, centerY - radius, radius * 2 + 1, radius * 2 + 1, radius + 0.5f, color, true);
+        return;
+    }
+    
     lockSurface();
     Uint32* pixels = (Uint32*)surface->pixels;
     int pitch = surface->pitch / 4;
     Uint32 pixelColor = SDL_MapRGBA(surface->format, color.r, color.g, color.b, color.a);
     
     if (filled) {
-        // 채워진 원 그리기
-        for (int y = -radius; y <= radius; y++) {
-            for (int x = -radius; x <= radius; x++) {
-                if (x * x + y * y <= radius * radius) {
-                    int px = centerX + x;
-                    int py = centerY + y;
-                    if (px >= 0 && px < width && py >= 0 && py < height) {
-                        pixels[py * pitch + px] = pixelColor;
-                    }
-                }
+        // 채워진 원 그리기: 행마다 x * x + y * y <= r * r 를 만족하는 구간을 한 번에 채움
+        int rowBegin = std::max(-radius, -centerY);
+        int rowEnd = std::min(radius, height - 1 - centerY);
+        for (int y = rowBegin; y <= rowEnd; y++) {
+            int limit = radius * radius - y * y;
+            int halfWidth = static_cast<int>(std::sqrt(static_cast<float>(limit)));
+            while (halfWidth * halfWidth > limit) halfWidth--;
+            while ((halfWidth + 1) * (halfWidth + 1) <= limit) halfWidth++;
+            int spanBegin = std::max(0, centerX - halfWidth);
+            int spanEnd = std::min(width - 1, centerX + halfWidth);
+            if (spanBegin <= spanEnd) {
+                RasterKernels::fillSpan(pixels + (centerY + y) * pitch + spanBegin, spanEnd - spanBegin + 1, pixelColor);
             }
         }
     } else {
@@ -248,7 +246,114 @@ void ImageRenderer::drawCircle(int centerX, int centerY, int radius, SDL_Color c
     }
     
     unlockSurface();
-    needsUpdate = true;
+    markDirty({centerX - radius, centerY - radius, radius * 2 + 1, radius * 2 + 1});
+}
+
+void ImageRenderer::drawBlendedRect(int x, int y, int w, int h, SDL_Color color) {
+    if (!surface || color.a == 0) return;
+    
+    SDL_Rect rect = {x, y, w, h};
+    SDL_Rect bounds = {0, 0, width, height};
+    SDL_Rect clipped;
+    if (!SDL_IntersectRect(&rect, &bounds, &clipped)) {
+        return;
+    }
+    
+    lockSurface();
+    Uint32* pixels = (Uint32*)surface->pixels;
+    int pitch = surface->pitch / 4;
+    Uint32 pixelColor = RasterKernels::packColor(color);
+    for (int py = clipped.y; py < clipped.y + clipped.h; py++) {
+        RasterKernels::blendSpan(pixels + py * pitch + clipped.x, clipped.w, pixelColor);
+    }
+    unlockSurface();
+    markDirty(clipped);
+}
+
+void ImageRenderer::drawRoundedRect(int x, int y, int w, int h, float radius, SDL_Color color, bool antiAliased) {
+    if (!surface || w <= 0 || h <= 0 || color.a == 0) return;
+    
+    float r = std::max(0.0f, std::min(radius, std::min(w, h) * 0.5f));
+    if (r <= 0.0f) {
+        drawBlendedRect(x, y, w, h, color);
+        return;
+    }
+    
+    SDL_Rect rect = {x, y, w, h};
+    SDL_Rect bounds = {0, 0, width, height};
+    SDL_Rect clipped;
+    if (!SDL_IntersectRect(&rect, &bounds, &clipped)) {
+        return;
+    }
+    
+    lockSurface();
+    Uint32* pixels = (Uint32*)surface->pixels;
+    int pitch = surface->pitch / 4;
+    Uint32 pixelColor = RasterKernels::packColor(color);
+    
+    // 모서리 원 중심 (픽셀 좌표계, 픽셀 (px, py)의 중심은 (px + 0.5, py + 0.5))
+    const float leftCenter = x + r;
+    const float rightCenter = x + w - r;
+    const float topCenter = y + r;
+    const float bottomCenter = y + h - r;
+    const int clipLeft = clipped.x;
+    const int clipRight = clipped.x + clipped.w;  // exclusive
+    
+    for (int py = clipped.y; py < clipped.y + clipped.h; py++) {
+        Uint32* row = pixels + py * pitch;
+        float cy = py + 0.5f;
+        float dy = std::max(0.0f, std::max(topCenter - cy, cy - bottomCenter));
+        
+        if (dy <= 0.0f) {
+            // 모서리 구간이 아닌 행은 전체가 한 구간
+            RasterKernels::blendSpan(row + clipLeft, clipRight - clipLeft, pixelColor);
+            continue;
+        }
+        
+        if (!antiAliased) {
+            // 픽셀 중심이 원 안에 있는 구간만
+            float ext = std::sqrt(std::max(0.0f, r * r - dy * dy));
+            int spanBegin = std::max(clipLeft, static_cast<int>(std::ceil(leftCenter - ext - 0.5f)));
+            int spanEnd = std::min(clipRight, static_cast<int>(std::floor(rightCenter + ext - 0.5f)) + 1);
+            if (spanBegin < spanEnd) {
+                RasterKernels::blendSpan(row + spanBegin, spanEnd - spanBegin, pixelColor);
+            }
+            continue;
+        }
+        
+        // 거리 r - 0.5 안쪽은 완전히 덮이고, r + 0.5 바깥은 비어 있음. 그 사이 경계 픽셀만 coverage 계산
+        float inner = std::max(0.0f, r - 0.5f);
+        float extIn = dy < inner ? std::sqrt(inner * inner - dy * dy) : 0.0f;
+        float outer = r + 0.5f;
+        if (dy >= outer) continue;
+        float extOut = std::sqrt(outer * outer - dy * dy);
+        
+        int innerBegin = std::max(clipLeft, static_cast<int>(std::ceil(leftCenter - extIn - 0.5f)));
+        int innerEnd = std::min(clipRight, static_cast<int>(std::floor(rightCenter + extIn - 0.5f)) + 1);
+        int outerBegin = std::max(clipLeft, static_cast<int>(std::floor(leftCenter - extOut - 0.5f)));
+        int outerEnd = std::min(clipRight, static_cast<int>(std::ceil(rightCenter + extOut - 0.5f)) + 1);
+        if (innerEnd < innerBegin) innerEnd = innerBegin;
+        
+        auto edgePixel = [&](int px) {
+            float cx = px + 0.5f;
+            float dx = std::max(0.0f, std::max(leftCenter - cx, cx - rightCenter));
+            float coverage = outer - std::sqrt(dx * dx + dy * dy);
+            if (coverage <= 0.0f) return;
+            RasterKernels::blendPixel(row + px, pixelColor, static_cast<int>(std::min(coverage, 1.0f) * 255.0f + 0.5f));
+        };
+        for (int px = outerBegin; px < std::min(innerBegin, outerEnd); px++) {
+            edgePixel(px);
+        }
+        if (innerBegin < innerEnd) {
+            RasterKernels::blendSpan(row + innerBegin, innerEnd - innerBegin, pixelColor);
+        }
+        for (int px = std::max(innerEnd, outerBegin); px < outerEnd; px++) {
+            edgePixel(px);
+        }
+    }
+    
+    unlockSurface();
+    markDirty(clipped);
 }
 
 void ImageRenderer::drawImage(SDL_Surface* srcSurface, int dstX, int dstY, int srcX, int srcY, int srcW, int srcH) {
@@ -263,93 +368,97 @@ void ImageRenderer::drawImage(SDL_Surface* srcSurface, int dstX, int dstY, int s
     
     SDL_Rect dstRect = {dstX, dstY, srcRect.w, srcRect.h};
     
-    SDL_BlitSurface(srcSurface, &srcRect, surface, &dstRect);
-    needsUpdate = true;
+    blitSurface(srcSurface, srcRect, dstRect);
+    markDirty(dstRect);  // blit 후 실제로 그려진 (잘린) 영역
 }
 
-void ImageRenderer::drawImage(SDL_Texture* srcTexture, int dstX, int dstY, int srcX, int srcY, int srcW, int srcH) {
-    if (!surface || !srcTexture || !renderer) {
+void ImageRenderer::blitSurface(SDL_Surface* srcSurface, SDL_Rect srcRect, SDL_Rect& dstRect) {
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    Uint8 alphaMod = 0, r = 0, g = 0, b = 0;
+    SDL_GetSurfaceBlendMode(srcSurface, &blendMode);
+    SDL_GetSurfaceAlphaMod(srcSurface, &alphaMod);
+    SDL_GetSurfaceColorMod(srcSurface, &r, &g, &b);
+    bool plainBlend = blendMode == SDL_BLENDMODE_BLEND && alphaMod == 255 && r == 255 && g == 255 && b == 255;
+    if (!plainBlend || srcSurface->format->format != SDL_PIXELFORMAT_RGBA32 || SDL_MUSTLOCK(srcSurface)) {
+        SDL_BlitSurface(srcSurface, &srcRect, surface, &dstRect);
         return;
     }
     
-    // 텍스처 크기 가져오기
-    int texW, texH;
-    SDL_QueryTexture(srcTexture, nullptr, nullptr, &texW, &texH);
-    
-    if (srcW < 0) srcW = texW - srcX;
-    if (srcH < 0) srcH = texH - srcY;
-    
-    // 텍스처를 임시 surface로 변환
-    SDL_Surface* tempSurface = SDL_CreateRGBSurfaceWithFormat(0, texW, texH, 32, SDL_PIXELFORMAT_RGBA32);
-    if (!tempSurface) {
+    // 원본 범위로 자른 만큼 대상 위치도 옮긴 뒤, 대상 범위로 다시 자름
+    SDL_Rect srcBounds = {0, 0, srcSurface->w, srcSurface->h};
+    SDL_Rect clippedSrc;
+    if (!SDL_IntersectRect(&srcRect, &srcBounds, &clippedSrc)) {
+        dstRect = {dstRect.x, dstRect.y, 0, 0};
         return;
     }
-    
-    // 텍스처를 임시 렌더 타겟으로 렌더링하고 읽기
-    SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-    SDL_Texture* tempTarget = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, texW, texH);
-    if (tempTarget) {
-        SDL_SetRenderTarget(renderer, tempTarget);
-        SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, srcTexture, nullptr, nullptr);
-        SDL_RenderReadPixels(renderer, nullptr, tempSurface->format->format, tempSurface->pixels, tempSurface->pitch);
-        SDL_SetRenderTarget(renderer, oldTarget);
-        SDL_DestroyTexture(tempTarget);
-    } else {
-        SDL_SetRenderTarget(renderer, oldTarget);
-        SDL_FreeSurface(tempSurface);
+    SDL_Rect target = {dstRect.x + (clippedSrc.x - srcRect.x), dstRect.y + (clippedSrc.y - srcRect.y), clippedSrc.w, clippedSrc.h};
+    SDL_Rect bounds = {0, 0, width, height};
+    if (!SDL_IntersectRect(&target, &bounds, &dstRect)) {
+        dstRect = {target.x, target.y, 0, 0};
         return;
     }
+    int offsetX = clippedSrc.x + (dstRect.x - target.x);
+    int offsetY = clippedSrc.y + (dstRect.y - target.y);
     
-    // 부분 영역만 blit
-    SDL_Rect srcRect = {srcX, srcY, srcW, srcH};
-    SDL_Rect dstRect = {dstX, dstY, srcW, srcH};
-    
-    SDL_BlitSurface(tempSurface, &srcRect, surface, &dstRect);
-    SDL_FreeSurface(tempSurface);
-    needsUpdate = true;
+    lockSurface();
+    const Uint8* srcPixels = static_cast<const Uint8*>(srcSurface->pixels);
+    Uint8* dstPixels = static_cast<Uint8*>(surface->pixels);
+    for (int row = 0; row < dstRect.h; row++) {
+        const Uint32* srcRow = reinterpret_cast<const Uint32*>(srcPixels + (offsetY + row) * srcSurface->pitch) + offsetX;
+        Uint32* dstRow = reinterpret_cast<Uint32*>(dstPixels + (dstRect.y + row) * surface->pitch) + dstRect.x;
+        RasterKernels::blitSpan(dstRow, srcRow, dstRect.w);
+    }
+    unlockSurface();
 }
 
-void ImageRenderer::drawImageScaled(SDL_Texture* srcTexture, int dstX, int dstY, int dstW, int dstH, int srcX, int srcY, int srcW, int srcH) {
-    if (!surface || !srcTexture || !renderer) return;
-
-    int texW, texH;
-    SDL_QueryTexture(srcTexture, nullptr, nullptr, &texW, &texH);
-    if (srcW < 0) srcW = texW - srcX;
-    if (srcH < 0) srcH = texH - srcY;
+void ImageRenderer::drawImageScaled(SDL_Surface* srcSurface, int dstX, int dstY, int dstW, int dstH, int srcX, int srcY, int srcW, int srcH) {
+    if (!surface || !srcSurface || dstW <= 0 || dstH <= 0) return;
 
-    SDL_Surface* tempSurface = SDL_CreateRGBSurfaceWithFormat(0, texW, texH, 32, SDL_PIXELFORMAT_RGBA32);
-    if (!tempSurface) return;
+    if (srcW < 0) srcW = srcSurface->w - srcX;
+    if (srcH < 0) srcH = srcSurface->h - srcY;
 
-    SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-    SDL_Texture* tempTarget = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, texW, texH);
-    if (tempTarget) {
-        SDL_SetRenderTarget(renderer, tempTarget);
-        SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, srcTexture, nullptr, nullptr);
-        SDL_RenderReadPixels(renderer, nullptr, tempSurface->format->format, tempSurface->pixels, tempSurface->pitch);
-        SDL_SetRenderTarget(renderer, oldTarget);
-        SDL_DestroyTexture(tempTarget);
+    SDL_Rect srcRect = {srcX, srcY, srcW, srcH};
+    SDL_Rect dstRect = {dstX, dstY, dstW, dstH};
+    if (srcW == dstW && srcH == dstH) {
+        blitSurface(srcSurface, srcRect, dstRect);
     } else {
-        SDL_SetRenderTarget(renderer, oldTarget);
-        SDL_FreeSurface(tempSurface);
-        return;
+        SDL_BlitScaled(srcSurface, &srcRect, surface, &dstRect);
     }
+    markDirty(dstRect);
+}
 
-    SDL_Rect srcRect = {srcX, srcY, srcW, srcH};
-    SDL_Rect dstRect = {dstX, dstY, dstW, dstH};
-    SDL_BlitScaled(tempSurface, &srcRect, surface, &dstRect);
-    SDL_FreeSurface(tempSurface);
-    needsUpdate = true;
+void ImageRenderer::drawPatch(SDL_Surface* srcSurface, PatchMode mode, int dstX, int dstY, int dstW, int dstH) {
+    if (!surface || !srcSurface) return;
+
+    SDL_Rect srcRects[PatchSlices::kMaxSlices];
+    SDL_Rect dstRects[PatchSlices::kMaxSlices];
+    SDL_Rect full = {0, 0, srcSurface->w, srcSurface->h};
+    int sliceCount = PatchSlices::compute(mode, full, dstW, dstH, srcRects, dstRects);
+    if (sliceCount == 0) {
+        drawImageScaled(srcSurface, dstX, dstY, dstW, dstH);
+        return;
+    }
+    for (int i = 0; i < sliceCount; i++) {
+        const SDL_Rect& src = srcRects[i];
+        const SDL_Rect& local = dstRects[i];
+        if (src.w <= 0 || src.h <= 0 || local.w <= 0 || local.h <= 0) continue;
+        drawImageScaled(srcSurface, dstX + local.x, dstY + local.y, local.w, local.h, src.x, src.y, src.w, src.h);
+    }
 }
 
 SDL_Texture* ImageRenderer::getTexture() {
-    if (needsUpdate || !cachedTexture) {
+    if (!cachedTexture || dirtyCount > 0) {
         updateTexture();
     }
     return cachedTexture;
 }
 
+SDL_Texture* ImageRenderer::takeTexture() {
+    SDL_Texture* texture = getTexture();
+    cachedTexture = nullptr;
+    return texture;
+}
+
 void ImageRenderer::clear(SDL_Color color) {
     drawColor(color);
 }
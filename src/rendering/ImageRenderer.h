@@ -1,20 +1,29 @@
 #pragma once
 #include "../utils/sdl_includes.h"
+#include "PatchSlices.h"
 #include <string>
 
 class TextRenderer;
 
 class ImageRenderer {
+public:
+    static constexpr int kMaxDirtyRects = 8;  // 넘으면 하나의 경계 사각형으로 합침
+
 private:
     SDL_Surface* surface;      // 그리기 작업을 수행할 surface
     SDL_Renderer* renderer;    // 텍스처 생성용
     int width;
     int height;
-    bool needsUpdate;          // 텍스처 업데이트 필요 여부
-    SDL_Texture* cachedTexture; // 캐시된 텍스처
+    SDL_Texture* cachedTexture; // 스트리밍 텍스처 (한 번 만들고 계속 재사용)
+    SDL_Rect dirtyRects[kMaxDirtyRects];  // 마지막 업로드 이후 바뀐 영역 (surface 범위로 잘림)
+    int dirtyCount;
     
     // 내부 헬퍼 함수들
-    void updateTexture();      // surface를 texture로 변환
+    void updateTexture();      // 바뀐 영역만 texture로 업로드 (텍스처가 없으면 만들고 전체 업로드)
+    void markDirty(const SDL_Rect& rect);  // 그리기 함수가 건드린 영역 기록
+    // 등배 blit. RGBA32 + 기본 블렌딩 원본은 RasterKernels::blitSpan, 그 외는 SDL_BlitSurface.
+    // dstRect는 SDL_BlitSurface처럼 실제로 그려진 (잘린) 영역으로 바뀜
+    void blitSurface(SDL_Surface* srcSurface, SDL_Rect srcRect, SDL_Rect& dstRect);
     void lockSurface();        // surface 잠금
     void unlockSurface();      // surface 잠금 해제
     
@@ -30,21 +39,30 @@ public:
     void drawPixel(int x, int y, SDL_Color color);
     void drawColor(SDL_Color color);  // 전체 이미지를 하나의 색으로 채우기
     
-    // 텍스트 그리기
-    void drawText(const std::string& text, int x, int y, int fontSize, SDL_Color color, TextRenderer* textRenderer, int maxWidth = 0);
+    // 텍스트 그리기 (TextRenderer::renderSurface로 CPU에서 바로 합성, GPU 왕복 없음)
+    void drawText(const std::string& text, int x, int y, int fontSize, SDL_Color color, TextRenderer* textRenderer, int maxWidth = 0,
+                  const std::string& fontName = "");
     
-    // 도형 그리기
+    // 도형 그리기 (행 단위 RasterKernels). drawRect/drawCircle은 색을 그대로 덮어씀
     void drawRect(int x, int y, int w, int h, SDL_Color color, bool filled = true);
-    void drawCircle(int centerX, int centerY, int radius, SDL_Color color, bool filled = true);
+    // antiAliased면 채운 원을 경계 coverage로 블렌딩 (drawRoundedRect와 같은 경로)
+    void drawCircle(int centerX, int centerY, int radius, SDL_Color color, bool filled = true, bool antiAliased = false);
+    // 알파 블렌딩 채우기 (반투명 오버레이 등, 아래 픽셀과 SDL_BLENDMODE_BLEND 식으로 합성)
+    void drawBlendedRect(int x, int y, int w, int h, SDL_Color color);
+    // 둥근 사각형 채우기 (블렌딩). antiAliased면 모서리 경계 픽셀을 coverage만큼 블렌딩
+    void drawRoundedRect(int x, int y, int w, int h, float radius, SDL_Color color, bool antiAliased = true);
     
-    // 이미지 그리기
+    // 이미지 그리기 (CPU 합성, ResourceManager::getSurface와 함께 사용)
     void drawImage(SDL_Surface* srcSurface, int dstX, int dstY, int srcX = 0, int srcY = 0, int srcW = -1, int srcH = -1);
-    void drawImage(SDL_Texture* srcTexture, int dstX, int dstY, int srcX = 0, int srcY = 0, int srcW = -1, int srcH = -1);
     // 이미지 스케일 그리기 (원본을 dstW x dstH로 확대/축소)
-    void drawImageScaled(SDL_Texture* srcTexture, int dstX, int dstY, int dstW, int dstH, int srcX = 0, int srcY = 0, int srcW = -1, int srcH = -1);
+    void drawImageScaled(SDL_Surface* srcSurface, int dstX, int dstY, int dstW, int dstH, int srcX = 0, int srcY = 0, int srcW = -1, int srcH = -1);
+    // 9/3패치로 늘려 그리기 (PatchSlices 조각별 SDL_BlitScaled, ResourceManager 패치 텍스처와 같은 결과)
+    void drawPatch(SDL_Surface* srcSurface, PatchMode mode, int dstX, int dstY, int dstW, int dstH);
     
     // 이미지 가져오기
-    SDL_Texture* getTexture();  // 텍스처 반환 (화면 출력용)
+    SDL_Texture* getTexture();  // 텍스처 반환 (화면 출력용). 계속 그려도 같은 텍스처이고 바뀐 영역만 업로드됨
+    // 텍스처 소유권을 호출자에게 넘김 (ImageRenderer가 사라져도 유지, 렌더 타겟 복사 불필요). 이후 getTexture는 새로 만듦
+    SDL_Texture* takeTexture();
     SDL_Surface* getSurface() const { return surface; }  // surface 직접 접근
     
     // 크기 정보
@@ -0,0 +1,112 @@
+#include "PatchSlices.h"
+
+namespace {
+
+int computeNine(const SDL_Rect& src, int width, int height, SDL_Rect* outSrc, SDL_Rect* outDst) {
+    // 원본 크기 기준으로 9등분 (나머지는 오른쪽/아래 조각에)
+    int thirdW = src.w / 3;
+    int thirdH = src.h / 3;
+    int srcLeftW = thirdW;
+    int srcCenterW = thirdW;
+    int srcRightW = src.w - thirdW * 2;
+    int srcTopH = thirdH;
+    int srcCenterH = thirdH;
+    int srcBottomH = src.h - thirdH * 2;
+
+    // 모서리는 원본 크기를 유지하되, 목표가 모서리 합보다 작으면 비율에 맞게 축소 (최소 1픽셀)
+    int dstLeftW = srcLeftW;
+    int dstRightW = srcRightW;
+    int dstTopH = srcTopH;
+    int dstBottomH = srcBottomH;
+    if (dstLeftW + dstRightW > width) {
+        float scale = static_cast<float>(width) / static_cast<float>(dstLeftW + dstRightW);
+        dstLeftW = static_cast<int>(dstLeftW * scale);
+        dstRightW = static_cast<int>(dstRightW * scale);
+        if (dstLeftW < 1) dstLeftW = 1;
+        if (dstRightW < 1) dstRightW = 1;
+    }
+    if (dstTopH + dstBottomH > height) {
+        float scale = static_cast<float>(height) / static_cast<float>(dstTopH + dstBottomH);
+        dstTopH = static_cast<int>(dstTopH * scale);
+        dstBottomH = static_cast<int>(dstBottomH * scale);
+        if (dstTopH < 1) dstTopH = 1;
+        if (dstBottomH < 1) dstBottomH = 1;
+    }
+
+    // 중앙은 남은 공간. 음수면 모서리를 반씩 나눔
+    int dstCenterW = width - dstLeftW - dstRightW;
+    int dstCenterH = height - dstTopH - dstBottomH;
+    if (dstCenterW < 0) {
+        dstCenterW = 0;
+        dstLeftW = width / 2;
+        dstRightW = width - dstLeftW;
+    }
+    if (dstCenterH < 0) {
+        dstCenterH = 0;
+        dstTopH = height / 2;
+        dstBottomH = height - dstTopH;
+    }
+
+    int srcCols[3][2] = {{0, srcLeftW}, {srcLeftW, srcCenterW}, {srcLeftW + srcCenterW, srcRightW}};
+    int srcRows[3][2] = {{0, srcTopH}, {srcTopH, srcCenterH}, {srcTopH + srcCenterH, srcBottomH}};
+    int dstCols[3][2] = {{0, dstLeftW}, {dstLeftW, dstCenterW}, {dstLeftW + dstCenterW, dstRightW}};
+    int dstRows[3][2] = {{0, dstTopH}, {dstTopH, dstCenterH}, {dstTopH + dstCenterH, dstBottomH}};
+
+    // 좌상, 상중, 우상, 좌중, 중앙, 우중, 좌하, 하중, 우하
+    for (int row = 0; row < 3; row++) {
+        for (int col = 0; col < 3; col++) {
+            int i = row * 3 + col;
+            outSrc[i] = {src.x + srcCols[col][0], src.y + srcRows[row][0], srcCols[col][1], srcRows[row][1]};
+            outDst[i] = {dstCols[col][0], dstRows[row][0], dstCols[col][1], dstRows[row][1]};
+        }
+    }
+    return 9;
+}
+
+int computeThree(const SDL_Rect& src, int width, int height, SDL_Rect* outSrc, SDL_Rect* outDst) {
+    int thirdW = src.w / 3;
+    int srcLeftW = thirdW;
+    int srcCenterW = thirdW;
+    int srcRightW = src.w - thirdW * 2;
+
+    // 좌/우: 원본 비율 유지하며 높이에 맞춰 확대·축소. 가운데만 가변으로 나머지 너비 채움
+    float scaleH = static_cast<float>(height) / static_cast<float>(src.h);
+    int dstLeftW = static_cast<int>(srcLeftW * scaleH + 0.5f);
+    int dstRightW = static_cast<int>(srcRightW * scaleH + 0.5f);
+    if (dstLeftW < 1) dstLeftW = 1;
+    if (dstRightW < 1) dstRightW = 1;
+    if (dstLeftW + dstRightW > width) {
+        float scaleW = static_cast<float>(width) / static_cast<float>(dstLeftW + dstRightW);
+        dstLeftW = static_cast<int>(dstLeftW * scaleW + 0.5f);
+        dstRightW = static_cast<int>(dstRightW * scaleW + 0.5f);
+        if (dstLeftW < 1) dstLeftW = 1;
+        if (dstRightW < 1) dstRightW = 1;
+    }
+    int dstCenterW = width - dstLeftW - dstRightW;
+    if (dstCenterW < 0) dstCenterW = 0;
+
+    outSrc[0] = {src.x, src.y, srcLeftW, src.h};
+    outSrc[1] = {src.x + srcLeftW, src.y, srcCenterW, src.h};
+    outSrc[2] = {src.x + srcLeftW + srcCenterW, src.y, srcRightW, src.h};
+    outDst[0] = {0, 0, dstLeftW, height};
+    outDst[1] = {dstLeftW, 0, dstCenterW, height};
+    outDst[2] = {dstLeftW + dstCenterW, 0, dstRightW, height};
+    return 3;
+}
+
+}  // namespace
+
+int PatchSlices::compute(PatchMode mode, const SDL_Rect& src, int width, int height,
+                         SDL_Rect outSrc[kMaxSlices], SDL_Rect outDst[kMaxSlices]) {
+    if (src.w <= 0 || src.h <= 0 || width <= 0 || height <= 0) {
+        return 0;
+    }
+    switch (mode) {
+        case PatchMode::Nine:
+            return computeNine(src, width, height, outSrc, outDst);
+        case PatchMode::Three:
+            return computeThree(src, width, height, outSrc, outDst);
+        default:
+            return 0;
+    }
+}
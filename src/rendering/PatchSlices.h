@@ -0,0 +1,21 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+
+enum class PatchMode {
+    None,
+    Nine,   // 9등분: 모서리 고정, 변은 한 방향, 중앙은 양방향으로 늘림
+    Three   // 가로 3등분: 좌/우는 높이에 맞춰 비율 유지, 중앙만 가로로 늘림
+};
+
+/**
+ * 9/3패치 조각 계산.
+ * 미리 구운 패치 텍스처(ResourceManager)와 렌더 시 직접 그리기(UiManager)가 같은 결과를 내도록 한 곳에서 계산한다.
+ */
+namespace PatchSlices {
+    constexpr int kMaxSlices = 9;
+
+    // src 영역을 width x height로 늘릴 때 조각별 src/dst rect (dst는 (0,0) 기준).
+    // 조각 수(9 또는 3)를 반환하고, 계산할 수 없으면 0. 너비/높이가 0인 조각은 그리지 않으면 됨
+    int compute(PatchMode mode, const SDL_Rect& src, int width, int height,
+                SDL_Rect outSrc[kMaxSlices], SDL_Rect outDst[kMaxSlices]);
+}
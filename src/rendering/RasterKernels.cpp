@@ -0,0 +1,311 @@
+#include "RasterKernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define RASTER_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define RASTER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RASTER_TARGET_AVX2
+#endif
+#else
+#define RASTER_KERNELS_X86 0
+#endif
+
+namespace {
+
+// x / 255 반올림 (x <= 65025). SIMD 경로의 mulhi((x + 128), 257)과 같은 값
+inline Uint8 div255(unsigned x) {
+    x += 128;
+    return static_cast<Uint8>((x + (x >> 8)) >> 8);
+}
+
+// 메모리상 RGBA 바이트 4개에 straight 알파 원본을 source-over로 블렌딩
+inline void blendBytes(Uint8* d, Uint8 r, Uint8 g, Uint8 b, unsigned alpha) {
+    unsigned inv = 255 - alpha;
+    d[0] = div255(r * alpha + d[0] * inv);
+    d[1] = div255(g * alpha + d[1] * inv);
+    d[2] = div255(b * alpha + d[2] * inv);
+    d[3] = div255(255 * alpha + d[3] * inv);
+}
+
+// ---- 스칼라 ----
+
+void fillScalar(Uint32* dst, int count, Uint32 pixel) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = pixel;
+    }
+}
+
+void blendScalar(Uint32* dst, int count, Uint32 pixel) {
+    const Uint8* s = reinterpret_cast<const Uint8*>(&pixel);
+    Uint8* d = reinterpret_cast<Uint8*>(dst);
+    for (int i = 0; i < count; i++, d += 4) {
+        blendBytes(d, s[0], s[1], s[2], s[3]);
+    }
+}
+
+void blitScalar(Uint32* dst, const Uint32* src, int count) {
+    const Uint8* s = reinterpret_cast<const Uint8*>(src);
+    Uint8* d = reinterpret_cast<Uint8*>(dst);
+    for (int i = 0; i < count; i++, s += 4, d += 4) {
+        unsigned alpha = s[3];
+        if (alpha == 255) {
+            dst[i] = src[i];
+        } else if (alpha != 0) {
+            blendBytes(d, s[0], s[1], s[2], alpha);
+        }
+    }
+}
+
+#if RASTER_KERNELS_X86
+
+// ---- SSE2 (x86-64 기본) ----
+// 바이트를 16비트로 풀어 픽셀 2개(8채널)씩 곱하고, (x + 128) * 257 >> 16 으로 255 나눗셈
+
+void fillSSE2(Uint32* dst, int count, Uint32 pixel) {
+    __m128i value = _mm_set1_epi32(static_cast<int>(pixel));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), value);
+    }
+    fillScalar(dst + i, count - i, pixel);
+}
+
+void blendSSE2(Uint32* dst, int count, Uint32 pixel) {
+    const Uint8* s = reinterpret_cast<const Uint8*>(&pixel);
+    const short alpha = s[3];
+    // 원본 항 (RGB * a, 255 * a) + 반올림 128을 미리 계산
+    const __m128i srcTerm = _mm_set_epi16(
+        static_cast<short>(255 * alpha + 128), static_cast<short>(s[2] * alpha + 128),
+        static_cast<short>(s[1] * alpha + 128), static_cast<short>(s[0] * alpha + 128),
+        static_cast<short>(255 * alpha + 128), static_cast<short>(s[2] * alpha + 128),
+        static_cast<short>(s[1] * alpha + 128), static_cast<short>(s[0] * alpha + 128));
+    const __m128i inv = _mm_set1_epi16(static_cast<short>(255 - alpha));
+    const __m128i k257 = _mm_set1_epi16(257);
+    const __m128i zero = _mm_setzero_si128();
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i lo = _mm_unpacklo_epi8(d, zero);
+        __m128i hi = _mm_unpackhi_epi8(d, zero);
+        lo = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(lo, inv), srcTerm), k257);
+        hi = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(hi, inv), srcTerm), k257);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    blendScalar(dst + i, count - i, pixel);
+}
+
+// 픽셀 2개(16비트 8채널) 블렌딩: 채널마다 그 픽셀의 알파를 펼쳐 곱함
+inline __m128i blendPairSSE2(__m128i s, __m128i d) {
+    const __m128i rgbMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i k255 = _mm_set1_epi16(255);
+    const __m128i k128 = _mm_set1_epi16(128);
+    const __m128i k257 = _mm_set1_epi16(257);
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i inv = _mm_sub_epi16(k255, alpha);
+    __m128i color = _mm_or_si128(_mm_and_si128(s, rgbMask), alphaOne);  // 알파 채널 자리는 255 * a
+    __m128i sum = _mm_add_epi16(_mm_mullo_epi16(color, alpha), _mm_mullo_epi16(d, inv));
+    return _mm_mulhi_epu16(_mm_add_epi16(sum, k128), k257);
+}
+
+void blitSSE2(Uint32* dst, const Uint32* src, int count) {
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m128i zero = _mm_setzero_si128();
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i a = _mm_and_si128(s, alphaMask);
+        // 4픽셀 모두 불투명이면 복사, 모두 투명이면 건너뜀 (이미지 대부분이 이 경우)
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, alphaMask)) == 0xFFFF) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), s);
+            continue;
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, zero)) == 0xFFFF) {
+            continue;
+        }
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i lo = blendPairSSE2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+        __m128i hi = blendPairSSE2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    blitScalar(dst + i, src + i, count - i);
+}
+
+// ---- AVX2 (런타임 검사 후에만 호출) ----
+// unpack/pack이 128비트 레인 안에서만 섞이므로 풀었다 다시 묶으면 원래 순서가 유지됨
+
+RASTER_TARGET_AVX2 void fillAVX2(Uint32* dst, int count, Uint32 pixel) {
+    __m256i value = _mm256_set1_epi32(static_cast<int>(pixel));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), value);
+    }
+    fillSSE2(dst + i, count - i, pixel);
+}
+
+RASTER_TARGET_AVX2 void blendAVX2(Uint32* dst, int count, Uint32 pixel) {
+    const Uint8* s = reinterpret_cast<const Uint8*>(&pixel);
+    const short alpha = s[3];
+    const __m256i srcTerm = _mm256_set_epi16(
+        static_cast<short>(255 * alpha + 128), static_cast<short>(s[2] * alpha + 128),
+        static_cast<short>(s[1] * alpha + 128), static_cast<short>(s[0] * alpha + 128),
+        static_cast<short>(255 * alpha + 128), static_cast<short>(s[2] * alpha + 128),
+        static_cast<short>(s[1] * alpha + 128), static_cast<short>(s[0] * alpha + 128),
+        static_cast<short>(255 * alpha + 128), static_cast<short>(s[2] * alpha + 128),
+        static_cast<short>(s[1] * alpha + 128), static_cast<short>(s[0] * alpha + 128),
+        static_cast<short>(255 * alpha + 128), static_cast<short>(s[2] * alpha + 128),
+        static_cast<short>(s[1] * alpha + 128), static_cast<short>(s[0] * alpha + 128));
+    const __m256i inv = _mm256_set1_epi16(static_cast<short>(255 - alpha));
+    const __m256i k257 = _mm256_set1_epi16(257);
+    const __m256i zero = _mm256_setzero_si256();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i lo = _mm256_unpacklo_epi8(d, zero);
+        __m256i hi = _mm256_unpackhi_epi8(d, zero);
+        lo = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(lo, inv), srcTerm), k257);
+        hi = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(hi, inv), srcTerm), k257);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+    }
+    blendSSE2(dst + i, count - i, pixel);
+}
+
+RASTER_TARGET_AVX2 inline __m256i blendPairAVX2(__m256i s, __m256i d) {
+    const __m256i rgbMask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alphaOne = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    const __m256i k255 = _mm256_set1_epi16(255);
+    const __m256i k128 = _mm256_set1_epi16(128);
+    const __m256i k257 = _mm256_set1_epi16(257);
+    __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i inv = _mm256_sub_epi16(k255, alpha);
+    __m256i color = _mm256_or_si256(_mm256_and_si256(s, rgbMask), alphaOne);
+    __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(color, alpha), _mm256_mullo_epi16(d, inv));
+    return _mm256_mulhi_epu16(_mm256_add_epi16(sum, k128), k257);
+}
+
+RASTER_TARGET_AVX2 void blitAVX2(Uint32* dst, const Uint32* src, int count) {
+    const __m256i alphaMask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m256i zero = _mm256_setzero_si256();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i a = _mm256_and_si256(s, alphaMask);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, alphaMask)) == -1) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), s);
+            continue;
+        }
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, zero)) == -1) {
+            continue;
+        }
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i lo = blendPairAVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero));
+        __m256i hi = blendPairAVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+    }
+    blitSSE2(dst + i, src + i, count - i);
+}
+
+#endif  // RASTER_KERNELS_X86
+
+RasterKernels::Backend detectBackend() {
+#if RASTER_KERNELS_X86
+    if (SDL_HasAVX2()) return RasterKernels::Backend::AVX2;
+    return RasterKernels::Backend::SSE2;  // x86-64는 항상 SSE2
+#else
+    return RasterKernels::Backend::Scalar;
+#endif
+}
+
+RasterKernels::Backend& activeBackend() {
+    static RasterKernels::Backend backend = detectBackend();
+    return backend;
+}
+
+}  // namespace
+
+namespace RasterKernels {
+
+Backend getBackend() {
+    return activeBackend();
+}
+
+const char* getBackendName(Backend backend) {
+    switch (backend) {
+        case Backend::AVX2: return "AVX2";
+        case Backend::SSE2: return "SSE2";
+        default: return "scalar";
+    }
+}
+
+void setBackend(Backend backend) {
+    Backend supported = detectBackend();
+    activeBackend() = static_cast<int>(backend) > static_cast<int>(supported) ? supported : backend;
+}
+
+Uint32 packColor(SDL_Color color) {
+    Uint32 pixel;
+    Uint8* bytes = reinterpret_cast<Uint8*>(&pixel);
+    bytes[0] = color.r;
+    bytes[1] = color.g;
+    bytes[2] = color.b;
+    bytes[3] = color.a;
+    return pixel;
+}
+
+void fillSpan(Uint32* dst, int count, Uint32 pixel) {
+    if (count <= 0) return;
+#if RASTER_KERNELS_X86
+    switch (activeBackend()) {
+        case Backend::AVX2: fillAVX2(dst, count, pixel); return;
+        case Backend::SSE2: fillSSE2(dst, count, pixel); return;
+        default: break;
+    }
+#endif
+    fillScalar(dst, count, pixel);
+}
+
+void blendSpan(Uint32* dst, int count, Uint32 pixel) {
+    if (count <= 0) return;
+    unsigned alpha = reinterpret_cast<const Uint8*>(&pixel)[3];
+    if (alpha == 0) return;
+    if (alpha == 255) {
+        fillSpan(dst, count, pixel);
+        return;
+    }
+#if RASTER_KERNELS_X86
+    switch (activeBackend()) {
+        case Backend::AVX2: blendAVX2(dst, count, pixel); return;
+        case Backend::SSE2: blendSSE2(dst, count, pixel); return;
+        default: break;
+    }
+#endif
+    blendScalar(dst, count, pixel);
+}
+
+void blendPixel(Uint32* dst, Uint32 pixel, int coverage) {
+    if (coverage <= 0) return;
+    const Uint8* s = reinterpret_cast<const Uint8*>(&pixel);
+    unsigned alpha = coverage >= 255 ? s[3] : div255(s[3] * static_cast<unsigned>(coverage));
+    if (alpha == 0) return;
+    blendBytes(reinterpret_cast<Uint8*>(dst), s[0], s[1], s[2], alpha);
+}
+
+void blitSpan(Uint32* dst, const Uint32* src, int count) {
+    if (count <= 0) return;
+#if RASTER_KERNELS_X86
+    switch (activeBackend()) {
+        case Backend::AVX2: blitAVX2(dst, src, count); return;
+        case Backend::SSE2: blitSSE2(dst, src, count); return;
+        default: break;
+    }
+#endif
+    blitScalar(dst, src, count);
+}
+
+}  // namespace RasterKernels
@@ -0,0 +1,40 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+
+/**
+ * RGBA32 픽셀 행(span) 단위 래스터 커널.
+ * ImageRenderer의 채우기/블렌딩/blit 내부 루프를 한 곳에 모아 SSE2/AVX2로 처리하고, 그 외 CPU는 스칼라로 처리한다.
+ * 백엔드는 처음 호출 시 고른다: x86-64에서 SDL_HasAVX2면 AVX2, 아니면 SSE2 (x86-64는 SSE2가 기본이라 검사하지 않음),
+ * 그 외 아키텍처는 스칼라. 모든 백엔드가 비트 단위로 같은 결과를 낸다.
+ *
+ * 픽셀은 SDL_PIXELFORMAT_RGBA32 (메모리상 R, G, B, A 바이트 순서, 알파는 straight)
+ * 블렌딩은 SDL_BLENDMODE_BLEND와 같은 식을 정수로 계산:
+ *   dstRGB = (srcRGB * srcA + dstRGB * (255 - srcA)) / 255
+ *   dstA   = (255    * srcA + dstA   * (255 - srcA)) / 255
+ * 즉 원본을 그 자리에서 premultiply한 뒤 source-over로 합성한다.
+ */
+namespace RasterKernels {
+    enum class Backend {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // 현재 사용하는 백엔드 (처음 호출 시 CPU 기능 검사)
+    Backend getBackend();
+    const char* getBackendName(Backend backend);
+    // 백엔드 강제 지정 (벤치마크/비교용). 지원하지 않는 백엔드는 지원하는 가장 가까운 것으로 낮춤
+    void setBackend(Backend backend);
+
+    // RGBA32 바이트 순서로 포장한 픽셀 값 (SDL_MapRGBA(RGBA32 포맷)과 같음)
+    Uint32 packColor(SDL_Color color);
+
+    // count개 픽셀을 pixel로 덮어씀
+    void fillSpan(Uint32* dst, int count, Uint32 pixel);
+    // count개 픽셀 위에 단색 pixel(알파 포함)을 블렌딩
+    void blendSpan(Uint32* dst, int count, Uint32 pixel);
+    // 픽셀 하나에 단색을 coverage(0~255)만큼 블렌딩 (안티에일리어싱 경계용)
+    void blendPixel(Uint32* dst, Uint32 pixel, int coverage);
+    // src 행을 dst 행 위에 픽셀별 알파로 블렌딩 (겹치지 않는 버퍼)
+    void blitSpan(Uint32* dst, const Uint32* src, int count);
+}
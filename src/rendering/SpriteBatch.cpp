@@ -0,0 +1,182 @@
+#include "SpriteBatch.h"
+#include "../utils/logger.h"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+void SpriteBatch::begin(SDL_Renderer* sdlRenderer) {
+    renderer = sdlRenderer;
+    stats = Stats{};
+    quads.clear();
+    batchTexture = nullptr;
+    // 호출 전 클립 상태는 비어 있다고 가정 (UiManager 렌더는 클립 없이 시작)
+    appliedHasClip = false;
+}
+
+void SpriteBatch::draw(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst,
+                       float angle, Uint8 alpha, const SDL_Rect* clip, const SDL_Point* center,
+                       SDL_Color tint) {
+    if (!renderer || !texture) return;
+
+    SDL_BlendMode blend = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureBlendMode(texture, &blend);
+
+    bool hasClip = clip != nullptr;
+    bool sameClip = hasClip == batchHasClip &&
+                    (!hasClip || (clip->x == batchClip.x && clip->y == batchClip.y &&
+                                  clip->w == batchClip.w && clip->h == batchClip.h));
+    if (!quads.empty() && (texture != batchTexture || blend != batchBlend || !sameClip)) {
+        flush();
+    }
+    if (quads.empty()) {
+        batchTexture = texture;
+        batchBlend = blend;
+        batchHasClip = hasClip;
+        if (hasClip) batchClip = *clip;
+    }
+
+    Quad quad;
+    quad.fullSource = (src == nullptr);
+    quad.src = src ? *src : SDL_Rect{0, 0, 0, 0};
+    quad.dst = dst;
+    quad.angle = angle;
+    quad.pivotX = center ? static_cast<float>(dst.x + center->x) : dst.x + dst.w * 0.5f;
+    quad.pivotY = center ? static_cast<float>(dst.y + center->y) : dst.y + dst.h * 0.5f;
+    quad.alpha = alpha;
+    quad.r = tint.r;
+    quad.g = tint.g;
+    quad.b = tint.b;
+    quads.push_back(quad);
+    stats.quads++;
+}
+
+void SpriteBatch::applyClip() {
+    bool same = appliedHasClip == batchHasClip &&
+                (!batchHasClip || (appliedClip.x == batchClip.x && appliedClip.y == batchClip.y &&
+                                   appliedClip.w == batchClip.w && appliedClip.h == batchClip.h));
+    if (same) return;
+    SDL_RenderSetClipRect(renderer, batchHasClip ? &batchClip : nullptr);
+    appliedHasClip = batchHasClip;
+    appliedClip = batchClip;
+}
+
+void SpriteBatch::flush() {
+    if (quads.empty() || !renderer) return;
+
+    applyClip();
+    stats.batches++;
+    if (!geometrySupported || !drawGeometry()) {
+        drawFallback();
+    }
+    quads.clear();
+}
+
+void SpriteBatch::end() {
+    flush();
+    if (renderer && appliedHasClip) {
+        SDL_RenderSetClipRect(renderer, nullptr);
+        appliedHasClip = false;
+    }
+    lastStats = stats;
+}
+
+bool SpriteBatch::drawGeometry() {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    float invW = 1.0f, invH = 1.0f;
+    bool needSize = false;
+    for (const Quad& quad : quads) {
+        if (!quad.fullSource) { needSize = true; break; }
+    }
+    if (needSize) {
+        int texW = 0, texH = 0;
+        SDL_QueryTexture(batchTexture, nullptr, nullptr, &texW, &texH);
+        if (texW <= 0 || texH <= 0) return false;
+        invW = 1.0f / texW;
+        invH = 1.0f / texH;
+    }
+
+    vertices.clear();
+    indices.clear();
+    vertices.reserve(quads.size() * 4);
+    indices.reserve(quads.size() * 6);
+
+    for (const Quad& quad : quads) {
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+        if (!quad.fullSource) {
+            u0 = quad.src.x * invW;
+            v0 = quad.src.y * invH;
+            u1 = (quad.src.x + quad.src.w) * invW;
+            v1 = (quad.src.y + quad.src.h) * invH;
+        }
+
+        // 회전 중심 기준 꼭짓점 오프셋 (좌상, 우상, 우하, 좌하)
+        float cx = quad.pivotX;
+        float cy = quad.pivotY;
+        float left = quad.dst.x - cx;
+        float top = quad.dst.y - cy;
+        float right = left + quad.dst.w;
+        float bottom = top + quad.dst.h;
+        float ox[4] = {left, right, right, left};
+        float oy[4] = {top, top, bottom, bottom};
+        float us[4] = {u0, u1, u1, u0};
+        float vs[4] = {v0, v0, v1, v1};
+
+        float cosR = 1.0f, sinR = 0.0f;
+        if (quad.angle != 0.0f) {
+            float rad = quad.angle * static_cast<float>(M_PI) / 180.0f;
+            cosR = std::cos(rad);
+            sinR = std::sin(rad);
+        }
+
+        int base = static_cast<int>(vertices.size());
+        SDL_Color color = {quad.r, quad.g, quad.b, quad.alpha};
+        for (int i = 0; i < 4; i++) {
+            SDL_Vertex v;
+            v.position.x = cx + ox[i] * cosR - oy[i] * sinR;
+            v.position.y = cy + ox[i] * sinR + oy[i] * cosR;
+            v.color = color;
+            v.tex_coord.x = us[i];
+            v.tex_coord.y = vs[i];
+            vertices.push_back(v);
+        }
+        indices.push_back(base);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+
+    if (SDL_RenderGeometry(renderer, batchTexture, vertices.data(), static_cast<int>(vertices.size()),
+                           indices.data(), static_cast<int>(indices.size())) != 0) {
+        Log::error("[SpriteBatch] SDL_RenderGeometry failed, falling back to RenderCopyEx: ", SDL_GetError());
+        geometrySupported = false;
+        return false;
+    }
+    stats.drawCalls++;
+    return true;
+#else
+    geometrySupported = false;
+    return false;
+#endif
+}
+
+void SpriteBatch::drawFallback() {
+    Uint8 previousAlpha = 255;
+    Uint8 previousR = 255, previousG = 255, previousB = 255;
+    SDL_GetTextureAlphaMod(batchTexture, &previousAlpha);
+    SDL_GetTextureColorMod(batchTexture, &previousR, &previousG, &previousB);
+    for (const Quad& quad : quads) {
+        SDL_SetTextureAlphaMod(batchTexture, quad.alpha);
+        SDL_SetTextureColorMod(batchTexture, quad.r, quad.g, quad.b);
+        SDL_Point center = {static_cast<int>(quad.pivotX - quad.dst.x),
+                            static_cast<int>(quad.pivotY - quad.dst.y)};
+        SDL_RenderCopyEx(renderer, batchTexture, quad.fullSource ? nullptr : &quad.src, &quad.dst,
+                         quad.angle, &center, SDL_FLIP_NONE);
+        stats.drawCalls++;
+    }
+    SDL_SetTextureAlphaMod(batchTexture, previousAlpha);
+    SDL_SetTextureColorMod(batchTexture, previousR, previousG, previousB);
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+#include <vector>
+
+/**
+ * 스프라이트 배치 렌더러.
+ * 쿼드(위치, UV, alpha, 회전)를 모아 두었다가 텍스처·블렌드 모드·클립 rect가 같은
+ * 연속 구간을 SDL_RenderGeometry 한 번으로 그린다. 그리는 순서(painter's order)는 유지된다.
+ *
+ * SDL_RenderGeometry는 텍스처 alpha/color mod를 무시하므로 alpha와 색(tint)은 정점 색상으로 전달한다.
+ * SDL 2.0.18 미만이거나 렌더러가 geometry를 지원하지 않으면 쿼드마다 SDL_RenderCopyEx로 그린다.
+ *
+ * 사용법: begin(renderer) → draw(...) 반복 → end()
+ */
+class SpriteBatch {
+public:
+    struct Stats {
+        int quads = 0;      // 제출된 쿼드 수
+        int batches = 0;    // 상태(텍스처/블렌드/클립)가 같은 연속 구간 수
+        int drawCalls = 0;  // 실제 SDL 그리기 호출 수 (geometry 미지원이면 쿼드 수와 같음)
+    };
+
+    SpriteBatch() = default;
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    void begin(SDL_Renderer* renderer);
+    // src가 nullptr이면 텍스처 전체, clip이 nullptr이면 클리핑 없음. angle은 시계 방향(도)
+    // center는 회전 중심 (SDL_RenderCopyEx처럼 dst 좌상단 기준, nullptr이면 dst 중심)
+    // tint는 RGB 곱 (흰색 글리프에 글자색 입히기 등, alpha는 alpha 인자 사용). 색이 달라도 같은 배치에 들어감
+    void draw(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst,
+              float angle, Uint8 alpha, const SDL_Rect* clip = nullptr, const SDL_Point* center = nullptr,
+              SDL_Color tint = SDL_Color{255, 255, 255, 255});
+    void flush();
+    void end();
+
+    // 마지막으로 end()까지 마친 구간의 통계
+    const Stats& getStats() const { return lastStats; }
+
+private:
+    struct Quad {
+        SDL_Rect src;
+        bool fullSource;
+        SDL_Rect dst;
+        float angle;
+        float pivotX;  // 회전 중심 (화면 좌표)
+        float pivotY;
+        Uint8 alpha;
+        Uint8 r, g, b;
+    };
+
+    SDL_Renderer* renderer = nullptr;
+
+    // 현재 모으는 배치의 상태
+    SDL_Texture* batchTexture = nullptr;
+    SDL_BlendMode batchBlend = SDL_BLENDMODE_BLEND;
+    bool batchHasClip = false;
+    SDL_Rect batchClip = {0, 0, 0, 0};
+    std::vector<Quad> quads;
+
+    // 렌더러에 마지막으로 적용한 클립
+    bool appliedHasClip = false;
+    SDL_Rect appliedClip = {0, 0, 0, 0};
+
+    bool geometrySupported = true;  // SDL_RenderGeometry 실패 시 false로 바꾸고 폴백
+
+    // 재사용 버퍼
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+    Stats stats;
+    Stats lastStats;
+
+    void applyClip();
+    bool drawGeometry();
+    void drawFallback();
+};
@@ -0,0 +1,181 @@
+#include "TextRasterQueue.h"
+#include "TextRenderer.h"
+#include "../utils/Profiler.h"
+#include <algorithm>
+
+TextRasterQueue::TextRasterQueue(int workerCount) {
+    workerCount = std::max(1, workerCount);
+    workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&TextRasterQueue::workerLoop, this);
+    }
+}
+
+TextRasterQueue::~TextRasterQueue() {
+    shutdown();
+}
+
+bool TextRasterQueue::request(const std::string& key, const TextRasterRequest& rasterRequest) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping) {
+            return false;
+        }
+        auto it = jobs.find(key);
+        if (it != jobs.end()) {
+            if (!it->second.cancelled) {
+                return false;
+            }
+            it->second.cancelled = false;  // 진행 중인 결과를 그대로 게시
+            return true;
+        }
+        Job job;
+        job.request = rasterRequest;
+        jobs.emplace(key, std::move(job));
+        queue.push_back(key);
+    }
+    workAvailable.notify_one();
+    return true;
+}
+
+void TextRasterQueue::cancel(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(key);
+    if (it == jobs.end()) {
+        return;
+    }
+    if (it->second.state == State::Rendering) {
+        // 워커가 끝날 때 표시를 보고 결과를 해제하고 항목을 지움
+        it->second.cancelled = true;
+        return;
+    }
+    if (it->second.surface) {
+        SDL_FreeSurface(it->second.surface);
+    }
+    jobs.erase(it);
+    completed.erase(std::remove(completed.begin(), completed.end(), key), completed.end());
+}
+
+bool TextRasterQueue::popCompleted(std::string& outKey, SDL_Surface*& outSurface) {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (!completed.empty()) {
+        std::string key = completed.front();
+        completed.pop_front();
+        auto it = jobs.find(key);
+        if (it == jobs.end() || it->second.state != State::Done) {
+            continue;
+        }
+        outKey = key;
+        outSurface = it->second.surface;
+        jobs.erase(it);
+        return true;
+    }
+    return false;
+}
+
+bool TextRasterQueue::isPending(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(key);
+    return it != jobs.end() && !it->second.cancelled;
+}
+
+size_t TextRasterQueue::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = 0;
+    for (const auto& jobPair : jobs) {
+        if (!jobPair.second.cancelled) count++;
+    }
+    return count;
+}
+
+void TextRasterQueue::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping && workers.empty()) {
+            return;
+        }
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& jobPair : jobs) {
+        if (jobPair.second.surface) {
+            SDL_FreeSurface(jobPair.second.surface);
+        }
+    }
+    jobs.clear();
+    queue.clear();
+    completed.clear();
+}
+
+void TextRasterQueue::workerLoop() {
+    // 이 워커 전용 폰트 (TTF_Font는 스레드 간 공유하지 않음)
+    std::map<std::pair<std::string, int>, TTF_Font*> fonts;
+
+    while (true) {
+        std::string key;
+        TextRasterRequest rasterRequest;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (stopping) {
+                break;
+            }
+            key = queue.front();
+            queue.pop_front();
+            auto it = jobs.find(key);
+            if (it == jobs.end() || it->second.state != State::Queued) {
+                continue;  // cancel로 취소됨
+            }
+            it->second.state = State::Rendering;
+            rasterRequest = it->second.request;
+        }
+
+        SDL_Surface* surface = nullptr;
+        {
+            PROFILE_SCOPE("TextRasterQueue::rasterize");
+            auto fontKey = std::make_pair(rasterRequest.fontPath, rasterRequest.fontSize);
+            auto fontIt = fonts.find(fontKey);
+            if (fontIt == fonts.end()) {
+                std::lock_guard<std::mutex> fontLock(TextRenderer::fontMutex());
+                TTF_Font* font = TTF_OpenFont(rasterRequest.fontPath.c_str(), rasterRequest.fontSize);
+                if (!font) {
+                    SDL_Log("TextRasterQueue: TTF_OpenFont Error: %s", TTF_GetError());
+                }
+                fontIt = fonts.emplace(fontKey, font).first;
+            }
+            if (fontIt->second) {
+                surface = TextRenderer::renderSurface(fontIt->second, rasterRequest.text, rasterRequest.color,
+                                                      rasterRequest.wrapWidth, rasterRequest.maxHeight);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = jobs.find(key);
+            if (it == jobs.end() || it->second.cancelled) {
+                // 진행 중에 취소됨
+                if (surface) SDL_FreeSurface(surface);
+                if (it != jobs.end()) jobs.erase(it);
+                continue;
+            }
+            it->second.state = State::Done;
+            it->second.surface = surface;
+            completed.push_back(key);
+        }
+    }
+
+    std::lock_guard<std::mutex> fontLock(TextRenderer::fontMutex());
+    for (auto& fontPair : fonts) {
+        if (fontPair.second) {
+            TTF_CloseFont(fontPair.second);
+        }
+    }
+}
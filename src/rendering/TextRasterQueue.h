@@ -0,0 +1,73 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 워커에서 래스터화할 텍스트 (폰트는 이름이 아니라 실제 파일 경로)
+struct TextRasterRequest {
+    std::string fontPath;
+    int fontSize = 0;
+    std::string text;
+    SDL_Color color = {255, 255, 255, 255};
+    int wrapWidth = 0;
+    int maxHeight = -1;
+};
+
+/**
+ * 워커 스레드 텍스트 래스터라이저.
+ * TTF 렌더링 + 높이 클리핑까지 워커에서 SDL_Surface로 만들고, 텍스처 업로드는 메인 스레드(ResourceManager)가 담당한다.
+ * 워커마다 자기 TTF_Font를 따로 열어 쓰므로 메인 스레드의 TextRenderer 폰트와 공유하지 않는다
+ * (폰트 열기/닫기는 TextRenderer::fontMutex로 직렬화).
+ *
+ * ImageDecodeQueue와 같은 Queued → Rendering → Done 상태를 거치고, Done 결과는 popCompleted로 꺼내면 사라진다.
+ */
+class TextRasterQueue {
+public:
+    explicit TextRasterQueue(int workerCount);
+    ~TextRasterQueue();
+
+    TextRasterQueue(const TextRasterQueue&) = delete;
+    TextRasterQueue& operator=(const TextRasterQueue&) = delete;
+
+    // 래스터화 요청. 같은 키가 이미 대기/진행/완료 상태면 무시하고 false
+    // (취소된 채 진행 중인 키는 취소를 되돌리고 true: 키가 같으면 결과도 같으므로 그 결과를 씀)
+    bool request(const std::string& key, const TextRasterRequest& rasterRequest);
+
+    // 요청 취소 (대기 중/완료면 바로 지우고, 진행 중이면 표시만 해 두었다가 워커가 끝날 때 결과를 버림)
+    void cancel(const std::string& key);
+
+    // 완료 순서대로 하나 꺼내기 (없으면 false). outSurface가 nullptr이면 래스터화 실패
+    bool popCompleted(std::string& outKey, SDL_Surface*& outSurface);
+
+    bool isPending(const std::string& key) const;
+    size_t getPendingCount() const;
+
+    // 워커 종료 및 남은 결과 해제 (이후 request는 무시)
+    void shutdown();
+
+private:
+    enum class State { Queued, Rendering, Done };
+    struct Job {
+        State state = State::Queued;
+        TextRasterRequest request;
+        SDL_Surface* surface = nullptr;
+        bool cancelled = false;  // Rendering 중 취소됨 (항목은 워커가 끝날 때까지 남겨 같은 키의 새 job과 섞이지 않게)
+    };
+
+    mutable std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::deque<std::string> queue;      // Queued 키 (취소된 항목은 꺼낼 때 건너뜀)
+    std::deque<std::string> completed;  // Done 키 (완료 순서)
+    std::unordered_map<std::string, Job> jobs;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    void workerLoop();
+};
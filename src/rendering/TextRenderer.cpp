@@ -1,5 +1,12 @@
 #include "TextRenderer.h"
+#include "../utils/Profiler.h"
+#include <cmath>
 
+TextRenderer::~TextRenderer() {
+    if (TTF_WasInit()) {
+        clearFontCache();
+    }
+}
 
 bool TextRenderer::init(const std::string& fontPath) {
     if (TTF_Init() < 0) {
@@ -8,15 +15,110 @@ bool TextRenderer::init(const std::string& fontPath) {
     }
 
     fontFile = fontPath;
+    fontPaths["default"] = fontPath;
     return true;
 }
 
+void TextRenderer::registerFont(const std::string& fontName, const std::string& fontPath) {
+    if (fontName.empty() || fontPath.empty()) return;
+    fontPaths[fontName] = fontPath;
+    missingFonts.erase(fontName);
+    if (fontName == "default") {
+        fontFile = fontPath;
+    }
+}
+
+bool TextRenderer::hasFont(const std::string& fontName) const {
+    return fontPaths.count(fontName) > 0;
+}
+
+const std::string& TextRenderer::resolveFontPath(const std::string& fontName) {
+    if (fontName.empty()) return fontFile;
+    auto it = fontPaths.find(fontName);
+    if (it != fontPaths.end()) return it->second;
+    if (missingFonts.insert(fontName).second) {
+        SDL_Log("TextRenderer: unknown font '%s', using default", fontName.c_str());
+    }
+    return fontFile;
+}
+
+TTF_Font* TextRenderer::getFont(const std::string& fontName, int fontSize) {
+    const std::string& path = resolveFontPath(fontName);
+    auto key = std::make_pair(path, fontSize);
+    auto it = fontCache.find(key);
+    if (it != fontCache.end()) {
+        return it->second;
+    }
+
+    PROFILE_SCOPE("TextRenderer::openFont");
+    std::lock_guard<std::mutex> lock(fontMutex());
+    TTF_Font* font = TTF_OpenFont(path.c_str(), fontSize);
+    if (!font) {
+        SDL_Log("TTF_OpenFont Error: %s", TTF_GetError());
+    }
+    // 실패도 캐시 (매 프레임 같은 파일을 다시 열지 않도록)
+    fontCache[key] = font;
+    return font;
+}
+
+int TextRenderer::preloadFont(const std::string& fontName, const std::vector<int>& sizes) {
+    int opened = 0;
+    for (int size : sizes) {
+        if (size > 0 && getFont(fontName, size)) {
+            opened++;
+        }
+    }
+    return opened;
+}
+
+void TextRenderer::clearFontCache() {
+    // 글리프 표는 TTF_Font 포인터를 키로 쓰므로 폰트보다 먼저 비움
+    if (glyphAtlas) {
+        glyphAtlas->clear();
+    }
+    if (distanceFieldAtlas) {
+        distanceFieldAtlas->clear();
+    }
+    std::lock_guard<std::mutex> lock(fontMutex());
+    for (auto& entry : fontCache) {
+        if (entry.second) {
+            TTF_CloseFont(entry.second);
+        }
+    }
+    fontCache.clear();
+}
+
 SDL_Texture* TextRenderer::renderText(SDL_Renderer* renderer, const std::string& text,
                                       int fontSize, SDL_Color color,
-                                      int wrapWidth, int maxHeight) {
-    TTF_Font* font = TTF_OpenFont(fontFile.c_str(), fontSize);
+                                      int wrapWidth, int maxHeight,
+                                      const std::string& fontName) {
+    PROFILE_SCOPE("TextRenderer::renderText");
+    TTF_Font* font = getFont(fontName, fontSize);
+    if (!font) {
+        return nullptr;
+    }
+
+    SDL_Surface* surface = renderSurface(font, text, color, wrapWidth, maxHeight);
+    if (!surface) {
+        return nullptr;
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        SDL_Log("SDL_CreateTextureFromSurface Error: %s", SDL_GetError());
+    }
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+std::mutex& TextRenderer::fontMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+SDL_Surface* TextRenderer::renderSurface(TTF_Font* font, const std::string& text, SDL_Color color,
+                                         int wrapWidth, int maxHeight) {
     if (!font) {
-        SDL_Log("TTF_OpenFont Error: %s", TTF_GetError());
         return nullptr;
     }
 
@@ -31,41 +133,74 @@ SDL_Texture* TextRenderer::renderText(SDL_Renderer* renderer, const std::string&
 
     if (!fullSurface) {
         SDL_Log("TTF_RenderText Error: %s", TTF_GetError());
-        TTF_CloseFont(font);
         return nullptr;
     }
 
     // Height 클리핑 처리
-    SDL_Surface* clippedSurface = fullSurface;
     if (maxHeight > 0 && fullSurface->h > maxHeight) {
-        clippedSurface = SDL_CreateRGBSurfaceWithFormat(0, fullSurface->w, maxHeight, 32, fullSurface->format->format);
-        SDL_Rect srcRect = {0, 0, fullSurface->w, maxHeight};
-        SDL_BlitSurface(fullSurface, &srcRect, clippedSurface, nullptr);
-        SDL_FreeSurface(fullSurface);
+        SDL_Surface* clippedSurface = SDL_CreateRGBSurfaceWithFormat(0, fullSurface->w, maxHeight, 32, fullSurface->format->format);
+        if (clippedSurface) {
+            SDL_Rect srcRect = {0, 0, fullSurface->w, maxHeight};
+            SDL_BlitSurface(fullSurface, &srcRect, clippedSurface, nullptr);
+            SDL_FreeSurface(fullSurface);
+            return clippedSurface;
+        }
     }
+    return fullSurface;
+}
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, clippedSurface);
-    if (!texture) {
-        SDL_Log("SDL_CreateTextureFromSurface Error: %s", SDL_GetError());
+bool TextRenderer::layoutText(SDL_Renderer* renderer, const std::string& text, int fontSize,
+                              int wrapWidth, int maxHeight, TextRun& outRun, const std::string& fontName,
+                              bool distanceField) {
+    PROFILE_SCOPE("TextRenderer::layoutText");
+    if (distanceField) {
+        return layoutDistanceField(renderer, text, fontSize, wrapWidth, maxHeight, outRun, fontName);
     }
+    TTF_Font* font = getFont(fontName, fontSize);
+    if (!font || !renderer) {
+        outRun = TextRun{};
+        return false;
+    }
+    if (!glyphAtlas || glyphAtlas->getRenderer() != renderer) {
+        glyphAtlas = std::make_unique<GlyphAtlas>(renderer);
+    }
+    return glyphAtlas->layout(font, text, wrapWidth, maxHeight, outRun);
+}
 
-    if (clippedSurface != fullSurface) {
-        SDL_FreeSurface(clippedSurface);
+bool TextRenderer::layoutDistanceField(SDL_Renderer* renderer, const std::string& text, int fontSize,
+                                       int wrapWidth, int maxHeight, TextRun& outRun, const std::string& fontName) {
+    // 기준 크기로 한 번만 래스터화하고, 요청 크기는 쿼드 배율(unitScale)로만 표현
+    TTF_Font* font = getFont(fontName, kDistanceFieldBaseSize);
+    if (!font || !renderer || fontSize <= 0) {
+        outRun = TextRun{};
+        return false;
+    }
+    if (!distanceFieldAtlas || distanceFieldAtlas->getRenderer() != renderer) {
+        distanceFieldAtlas = std::make_unique<GlyphAtlas>(renderer, true);
     }
 
-    TTF_CloseFont(font);
-    return texture;
+    float scale = static_cast<float>(fontSize) / kDistanceFieldBaseSize;
+    int baseWrap = wrapWidth > 0 ? static_cast<int>(wrapWidth / scale) : wrapWidth;
+    int baseMaxHeight = maxHeight > 0 ? static_cast<int>(maxHeight / scale) : maxHeight;
+    if (!distanceFieldAtlas->layout(font, text, baseWrap, baseMaxHeight, outRun)) {
+        return false;
+    }
+    outRun.width = static_cast<int>(std::ceil(outRun.width * scale));
+    outRun.height = static_cast<int>(std::ceil(outRun.height * scale));
+    outRun.unitScale = scale;
+    return true;
 }
 
-bool TextRenderer::getTextSize(const std::string& text, int fontSize, int* outW, int* outH) {
+bool TextRenderer::getTextSize(const std::string& text, int fontSize, int* outW, int* outH,
+                               const std::string& fontName) {
     if (!outW || !outH || text.empty()) return false;
-    TTF_Font* font = TTF_OpenFont(fontFile.c_str(), fontSize);
+    TTF_Font* font = getFont(fontName, fontSize);
     if (!font) return false;
     int ret = TTF_SizeUTF8(font, text.c_str(), outW, outH);
-    TTF_CloseFont(font);
     return (ret == 0);
 }
 
 void TextRenderer::quit() {
+    clearFontCache();  // TTF_Quit 이후에는 TTF_CloseFont를 호출할 수 없음
     TTF_Quit();
 }
\ No newline at end of file
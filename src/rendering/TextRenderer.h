@@ -1,17 +1,76 @@
 #pragma once
 #include "../utils/sdl_includes.h"
+#include "GlyphAtlas.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 class TextRenderer {
 public:
+    // 거리장 글리프를 만드는 기준 크기 (이보다 크게 확대하면 경계가 조금씩 부드러워짐)
+    static constexpr int kDistanceFieldBaseSize = 64;
+
+    TextRenderer() = default;
+    ~TextRenderer();
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    // fontPath: 기본 폰트 (이름 "default", fontName을 비우면 사용)
     bool init(const std::string& fontPath);
+
+    // 이름 있는 폰트 등록 (resource.json "fonts"). 같은 이름이면 경로 교체
+    void registerFont(const std::string& fontName, const std::string& fontPath);
+    bool hasFont(const std::string& fontName) const;
+    // 지정 크기들을 미리 열어 둠 (씬 로드 중 첫 렌더에서 파일을 파싱하지 않도록). 연 개수 반환
+    int preloadFont(const std::string& fontName, const std::vector<int>& sizes);
+
+    // (폰트 파일, 크기)별로 한 번만 열고 캐시. 없는 이름이면 기본 폰트
+    TTF_Font* getFont(const std::string& fontName, int fontSize);
+    // 폰트 이름 → 파일 경로 (없는 이름이면 기본 폰트 경로). TextRasterQueue 워커가 자기 폰트를 열 때 사용
+    std::string getFontPath(const std::string& fontName) { return resolveFontPath(fontName); }
+
+    // 텍스트 → RGBA surface (wrapWidth > 0이면 줄바꿈, maxHeight > 0이면 아래를 잘라냄).
+    // 텍스처를 만들지 않으므로 font를 가진 스레드라면 어디서든 호출 가능
+    static SDL_Surface* renderSurface(TTF_Font* font, const std::string& text, SDL_Color color,
+                                      int wrapWidth = 0, int maxHeight = -1);
+    // TTF_OpenFont/TTF_CloseFont 직렬화 (FreeType 라이브러리 객체를 워커와 공유하므로)
+    static std::mutex& fontMutex();
+
     SDL_Texture* renderText(SDL_Renderer* renderer, const std::string& text,
-                            int fontSize, SDL_Color color, int wrapWidth = 0, int maxHeight = -1);
+                            int fontSize, SDL_Color color, int wrapWidth = 0, int maxHeight = -1,
+                            const std::string& fontName = "");
+    // 글리프 아틀라스 경로: 텍스처를 만들지 않고 쿼드 목록으로 레이아웃 (UIElement::setTextRun으로 그림).
+    // 색상은 쿼드에 들어가지 않으므로 UIElement tint로 지정.
+    // distanceField면 폰트당 기준 크기 한 벌의 거리장 글리프를 배율로 그림 (크기 변경/스케일 애니메이션에 래스터화 없음)
+    bool layoutText(SDL_Renderer* renderer, const std::string& text, int fontSize,
+                    int wrapWidth, int maxHeight, TextRun& outRun, const std::string& fontName = "",
+                    bool distanceField = false);
+    const GlyphAtlas* getGlyphAtlas() const { return glyphAtlas.get(); }
+    const GlyphAtlas* getDistanceFieldAtlas() const { return distanceFieldAtlas.get(); }
+
     // 텍스트 크기 조회 (렌더링 없이, 단일 라인 기준)
-    bool getTextSize(const std::string& text, int fontSize, int* outW, int* outH);
+    bool getTextSize(const std::string& text, int fontSize, int* outW, int* outH,
+                     const std::string& fontName = "");
+
+    size_t getCachedFontCount() const { return fontCache.size(); }
+    void clearFontCache();  // 열린 폰트와 글리프 아틀라스 모두 해제 (다음 요청 시 다시 열림, 기존 TextRun 무효)
 
     void quit();
 
 private:
-    std::string fontFile;
-};
\ No newline at end of file
+    std::string fontFile;  // 기본 폰트 경로
+    std::map<std::string, std::string> fontPaths;  // 폰트 이름 → 파일 경로
+    std::map<std::pair<std::string, int>, TTF_Font*> fontCache;  // (파일 경로, 크기) → 열린 폰트
+    std::set<std::string> missingFonts;  // 등록되지 않은 이름 (경고는 한 번만)
+    std::unique_ptr<GlyphAtlas> glyphAtlas;  // 첫 layoutText에서 생성
+    std::unique_ptr<GlyphAtlas> distanceFieldAtlas;  // 첫 distanceField layoutText에서 생성
+
+    bool layoutDistanceField(SDL_Renderer* renderer, const std::string& text, int fontSize,
+                             int wrapWidth, int maxHeight, TextRun& outRun, const std::string& fontName);
+
+    const std::string& resolveFontPath(const std::string& fontName);
+};
@@ -0,0 +1,177 @@
+#include "ImageDecodeQueue.h"
+#include "../utils/logger.h"
+#include "../utils/Profiler.h"
+#include <algorithm>
+
+ImageDecodeQueue::ImageDecodeQueue(int workerCount) {
+    workerCount = std::max(1, workerCount);
+    workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&ImageDecodeQueue::workerLoop, this);
+    }
+}
+
+ImageDecodeQueue::~ImageDecodeQueue() {
+    shutdown();
+}
+
+SDL_Surface* ImageDecodeQueue::decodeFile(const std::string& path) {
+    SDL_Surface* surface = IMG_Load(path.c_str());
+    if (!surface) {
+        Log::error("[ImageDecodeQueue] Unable to load image ", path, ", SDL_image Error: ", IMG_GetError());
+        return nullptr;
+    }
+    if (surface->format->format == SDL_PIXELFORMAT_RGBA32) {
+        return surface;
+    }
+    // 업로드/아틀라스 패킹 시 메인 스레드에서 변환하지 않도록 여기서 포맷 통일
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(surface);
+    if (!converted) {
+        Log::error("[ImageDecodeQueue] Failed to convert image ", path, ": ", SDL_GetError());
+    }
+    return converted;
+}
+
+bool ImageDecodeQueue::request(const std::string& name, const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping || jobs.count(name) > 0) {
+            return false;
+        }
+        Job job;
+        job.path = path;
+        jobs.emplace(name, std::move(job));
+        queue.push_back(name);
+    }
+    workAvailable.notify_one();
+    return true;
+}
+
+bool ImageDecodeQueue::take(const std::string& name, SDL_Surface*& outSurface) {
+    outSurface = nullptr;
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = jobs.find(name);
+    if (it == jobs.end()) {
+        return false;
+    }
+
+    if (it->second.state == State::Queued) {
+        // 워커가 집기 전이면 취소하고 호출자가 직접 로드 (대기 시간 없음)
+        jobs.erase(it);
+        return false;
+    }
+
+    if (it->second.state == State::Decoding) {
+        PROFILE_SCOPE("ImageDecodeQueue::waitDecode");
+        jobFinished.wait(lock, [&]() {
+            auto found = jobs.find(name);
+            return found == jobs.end() || found->second.state == State::Done;
+        });
+        it = jobs.find(name);
+        if (it == jobs.end()) {
+            return false;  // shutdown 중 정리됨
+        }
+    }
+
+    outSurface = it->second.surface;
+    jobs.erase(it);
+    completed.erase(std::remove(completed.begin(), completed.end(), name), completed.end());
+    return true;
+}
+
+bool ImageDecodeQueue::popCompleted(std::string& outName, SDL_Surface*& outSurface) {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (!completed.empty()) {
+        std::string name = completed.front();
+        completed.pop_front();
+        auto it = jobs.find(name);
+        if (it == jobs.end() || it->second.state != State::Done) {
+            continue;
+        }
+        outName = name;
+        outSurface = it->second.surface;
+        jobs.erase(it);
+        return true;
+    }
+    return false;
+}
+
+bool ImageDecodeQueue::isPending(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.count(name) > 0;
+}
+
+size_t ImageDecodeQueue::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.size();
+}
+
+void ImageDecodeQueue::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping && workers.empty()) {
+            return;
+        }
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& jobPair : jobs) {
+        if (jobPair.second.surface) {
+            SDL_FreeSurface(jobPair.second.surface);
+        }
+    }
+    jobs.clear();
+    queue.clear();
+    completed.clear();
+    jobFinished.notify_all();
+}
+
+void ImageDecodeQueue::workerLoop() {
+    while (true) {
+        std::string name;
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (stopping) {
+                return;
+            }
+            name = queue.front();
+            queue.pop_front();
+            auto it = jobs.find(name);
+            if (it == jobs.end() || it->second.state != State::Queued) {
+                continue;  // take로 취소됨
+            }
+            it->second.state = State::Decoding;
+            path = it->second.path;
+        }
+
+        SDL_Surface* surface = nullptr;
+        {
+            PROFILE_SCOPE("ImageDecodeQueue::decode");
+            surface = decodeFile(path);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = jobs.find(name);
+            if (it == jobs.end()) {
+                if (surface) SDL_FreeSurface(surface);
+                continue;
+            }
+            it->second.state = State::Done;
+            it->second.surface = surface;
+            completed.push_back(name);
+        }
+        jobFinished.notify_all();
+    }
+}
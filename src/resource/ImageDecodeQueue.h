@@ -0,0 +1,64 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * 워커 스레드 이미지 디코더.
+ * 파일 → SDL_Surface(RGBA32) 변환까지 워커에서 처리하고, 텍스처 업로드는 메인 스레드(ResourceManager)가 담당한다.
+ * (SDL_Texture 생성은 렌더러 스레드에서만 가능)
+ *
+ * 이미지 하나는 Queued → Decoding → Done 상태를 거치며, Done 결과는 take/popCompleted로 꺼내면 사라진다.
+ */
+class ImageDecodeQueue {
+public:
+    explicit ImageDecodeQueue(int workerCount);
+    ~ImageDecodeQueue();
+
+    ImageDecodeQueue(const ImageDecodeQueue&) = delete;
+    ImageDecodeQueue& operator=(const ImageDecodeQueue&) = delete;
+
+    // 디코드 요청. 이미 대기/디코딩/완료 상태면 무시하고 false
+    bool request(const std::string& name, const std::string& path);
+
+    // 메인 스레드에서 name 결과를 바로 필요로 할 때.
+    // 완료 → surface 반환, 디코딩 중 → 끝날 때까지 대기 후 반환, 대기 중 → 큐에서 빼고 false (호출자가 직접 로드)
+    // true인데 outSurface가 nullptr이면 디코딩 실패
+    bool take(const std::string& name, SDL_Surface*& outSurface);
+
+    // 완료 순서대로 하나 꺼내기 (없으면 false)
+    bool popCompleted(std::string& outName, SDL_Surface*& outSurface);
+
+    bool isPending(const std::string& name) const;  // 아직 take/pop되지 않은 요청이 있는지
+    size_t getPendingCount() const;
+
+    // 워커 종료 및 남은 결과 해제 (이후 request는 무시)
+    void shutdown();
+
+    // 파일 → RGBA32 surface (워커와 동기 로드 경로 공용)
+    static SDL_Surface* decodeFile(const std::string& path);
+
+private:
+    enum class State { Queued, Decoding, Done };
+    struct Job {
+        State state = State::Queued;
+        std::string path;
+        SDL_Surface* surface = nullptr;
+    };
+
+    mutable std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable jobFinished;
+    std::deque<std::string> queue;      // Queued 이름 (take로 취소된 항목은 꺼낼 때 건너뜀)
+    std::deque<std::string> completed;  // Done 이름 (완료 순서)
+    std::unordered_map<std::string, Job> jobs;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    void workerLoop();
+};
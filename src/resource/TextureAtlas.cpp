@@ -0,0 +1,241 @@
+#include "TextureAtlas.h"
+#include "../utils/logger.h"
+#include "../utils/Profiler.h"
+#include <algorithm>
+
+SkylinePacker::SkylinePacker(int w, int h)
+    : width(w), height(h) {
+    skyline.push_back({0, 0, w});
+}
+
+int SkylinePacker::fitAt(size_t index, int w, int h) const {
+    int x = skyline[index].x;
+    if (x + w > width) return -1;
+
+    int y = skyline[index].y;
+    int remaining = w;
+    size_t i = index;
+    while (remaining > 0) {
+        if (i >= skyline.size()) return -1;
+        y = std::max(y, skyline[i].y);
+        if (y + h > height) return -1;
+        remaining -= skyline[i].w;
+        i++;
+    }
+    return y;
+}
+
+void SkylinePacker::addSegment(size_t index, int x, int y, int w, int h) {
+    skyline.insert(skyline.begin() + index, Segment{x, y + h, w});
+
+    // 새 세그먼트에 가려진 뒤쪽 세그먼트 잘라내기
+    for (size_t i = index + 1; i < skyline.size();) {
+        Segment& prev = skyline[i - 1];
+        Segment& seg = skyline[i];
+        if (seg.x >= prev.x + prev.w) break;
+
+        int shrink = prev.x + prev.w - seg.x;
+        seg.x += shrink;
+        seg.w -= shrink;
+        if (seg.w <= 0) {
+            skyline.erase(skyline.begin() + i);
+        } else {
+            break;
+        }
+    }
+
+    // 같은 높이의 인접 세그먼트 병합
+    for (size_t i = 0; i + 1 < skyline.size();) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].w += skyline[i + 1].w;
+            skyline.erase(skyline.begin() + i + 1);
+        } else {
+            i++;
+        }
+    }
+}
+
+bool SkylinePacker::insert(int w, int h, SDL_Rect& outRect) {
+    if (w <= 0 || h <= 0) return false;
+
+    int bestY = height + 1;
+    int bestX = 0;
+    int bestWidth = width + 1;
+    size_t bestIndex = skyline.size();
+
+    for (size_t i = 0; i < skyline.size(); i++) {
+        int y = fitAt(i, w, h);
+        if (y < 0) continue;
+        // 가장 낮은 위치 우선, 같으면 시작 세그먼트가 더 좁은 쪽 (같은 너비면 먼저 찾은 왼쪽 유지)
+        if (y < bestY || (y == bestY && skyline[i].w < bestWidth)) {
+            bestY = y;
+            bestX = skyline[i].x;
+            bestWidth = skyline[i].w;
+            bestIndex = i;
+        }
+    }
+    if (bestIndex == skyline.size()) return false;
+
+    addSegment(bestIndex, bestX, bestY, w, h);
+    outRect = {bestX, bestY, w, h};
+    return true;
+}
+
+
+TextureAtlas::TextureAtlas(SDL_Renderer* sdlRenderer, const std::string& atlasName)
+    : renderer(sdlRenderer), name(atlasName) {}
+
+TextureAtlas::~TextureAtlas() {
+    for (Page& page : pages) {
+        if (page.surface) SDL_FreeSurface(page.surface);
+        if (page.texture) SDL_DestroyTexture(page.texture);
+    }
+}
+
+// 이미지를 (x + kPadding, y + kPadding)에 복사하고 가장자리 한 줄씩과 모서리 픽셀을 패딩 영역에 복제
+void TextureAtlas::blitWithExtrude(SDL_Surface* src, SDL_Surface* dst, int x, int y) {
+    int w = src->w;
+    int h = src->h;
+    int p = kPadding;
+
+    SDL_Rect body = {x + p, y + p, w, h};
+    SDL_BlitSurface(src, nullptr, dst, &body);
+
+    for (int i = 0; i < p; i++) {
+        SDL_Rect srcLeft = {0, 0, 1, h};
+        SDL_Rect dstLeft = {x + i, y + p, 1, h};
+        SDL_BlitSurface(src, &srcLeft, dst, &dstLeft);
+
+        SDL_Rect srcRight = {w - 1, 0, 1, h};
+        SDL_Rect dstRight = {x + p + w + i, y + p, 1, h};
+        SDL_BlitSurface(src, &srcRight, dst, &dstRight);
+
+        SDL_Rect srcTop = {0, 0, w, 1};
+        SDL_Rect dstTop = {x + p, y + i, w, 1};
+        SDL_BlitSurface(src, &srcTop, dst, &dstTop);
+
+        SDL_Rect srcBottom = {0, h - 1, w, 1};
+        SDL_Rect dstBottom = {x + p, y + p + h + i, w, 1};
+        SDL_BlitSurface(src, &srcBottom, dst, &dstBottom);
+    }
+
+    // 모서리 p x p 영역은 해당 꼭짓점 픽셀로 채움 (회전/확대 시 모서리 바깥 샘플도 이미지 색)
+    for (int i = 0; i < p; i++) {
+        for (int j = 0; j < p; j++) {
+            SDL_Rect srcTopLeft = {0, 0, 1, 1};
+            SDL_Rect dstTopLeft = {x + j, y + i, 1, 1};
+            SDL_BlitSurface(src, &srcTopLeft, dst, &dstTopLeft);
+
+            SDL_Rect srcTopRight = {w - 1, 0, 1, 1};
+            SDL_Rect dstTopRight = {x + p + w + j, y + i, 1, 1};
+            SDL_BlitSurface(src, &srcTopRight, dst, &dstTopRight);
+
+            SDL_Rect srcBottomLeft = {0, h - 1, 1, 1};
+            SDL_Rect dstBottomLeft = {x + j, y + p + h + i, 1, 1};
+            SDL_BlitSurface(src, &srcBottomLeft, dst, &dstBottomLeft);
+
+            SDL_Rect srcBottomRight = {w - 1, h - 1, 1, 1};
+            SDL_Rect dstBottomRight = {x + p + w + j, y + p + h + i, 1, 1};
+            SDL_BlitSurface(src, &srcBottomRight, dst, &dstBottomRight);
+        }
+    }
+}
+
+bool TextureAtlas::build(const std::vector<std::pair<std::string, SDL_Surface*>>& images) {
+    PROFILE_SCOPE("TextureAtlas::build");
+
+    struct Loaded {
+        std::string name;
+        SDL_Surface* surface;
+    };
+    std::vector<Loaded> loaded;
+    loaded.reserve(images.size());
+
+    for (const auto& image : images) {
+        SDL_Surface* surface = image.second;
+        if (!surface) continue;
+        // 픽셀 포맷 통일 (디코드 워커에서 이미 RGBA32면 변환 생략)
+        if (surface->format->format != SDL_PIXELFORMAT_RGBA32) {
+            SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+            SDL_FreeSurface(surface);
+            if (!converted) continue;
+            surface = converted;
+        }
+        // alpha를 섞지 않고 그대로 복사
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+        loaded.push_back({image.first, surface});
+    }
+
+    // 큰(높은) 이미지부터 넣어야 스카이라인 낭비가 적음
+    std::sort(loaded.begin(), loaded.end(), [](const Loaded& a, const Loaded& b) {
+        if (a.surface->h != b.surface->h) return a.surface->h > b.surface->h;
+        return a.surface->w > b.surface->w;
+    });
+
+    int packedCount = 0;
+    for (const Loaded& image : loaded) {
+        int paddedW = image.surface->w + kPadding * 2;
+        int paddedH = image.surface->h + kPadding * 2;
+        if (paddedW > kPageSize || paddedH > kPageSize) {
+            Log::info("[TextureAtlas] '", name, "': ", image.name, " is larger than a page, loading standalone");
+            SDL_FreeSurface(image.surface);
+            continue;
+        }
+
+        SDL_Rect placed;
+        int pageIndex = -1;
+        for (size_t i = 0; i < pages.size(); i++) {
+            if (pages[i].surface && pages[i].packer.insert(paddedW, paddedH, placed)) {
+                pageIndex = static_cast<int>(i);
+                break;
+            }
+        }
+        if (pageIndex < 0) {
+            Page page;
+            page.surface = SDL_CreateRGBSurfaceWithFormat(0, kPageSize, kPageSize, 32, SDL_PIXELFORMAT_RGBA32);
+            if (!page.surface) {
+                Log::error("[TextureAtlas] Failed to create page surface: ", SDL_GetError());
+                SDL_FreeSurface(image.surface);
+                continue;
+            }
+            SDL_FillRect(page.surface, nullptr, 0);
+            page.packer.insert(paddedW, paddedH, placed);
+            pages.push_back(page);
+            pageIndex = static_cast<int>(pages.size()) - 1;
+        }
+
+        blitWithExtrude(image.surface, pages[pageIndex].surface, placed.x, placed.y);
+        regions[image.name] = Entry{pageIndex, SDL_Rect{placed.x + kPadding, placed.y + kPadding,
+                                                       image.surface->w, image.surface->h}};
+        SDL_FreeSurface(image.surface);
+        packedCount++;
+    }
+
+    // 페이지 surface → 텍스처 (이후 surface는 불필요)
+    for (Page& page : pages) {
+        if (!page.surface) continue;
+        page.texture = SDL_CreateTextureFromSurface(renderer, page.surface);
+        SDL_FreeSurface(page.surface);
+        page.surface = nullptr;
+        if (!page.texture) {
+            Log::error("[TextureAtlas] Failed to create page texture: ", SDL_GetError());
+            continue;
+        }
+        SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+    }
+
+    Log::info("[TextureAtlas] '", name, "': packed ", packedCount, " images into ", pages.size(), " page(s)");
+    return packedCount > 0;
+}
+
+bool TextureAtlas::findRegion(const std::string& imageName, TextureRegion& outRegion) const {
+    auto it = regions.find(imageName);
+    if (it == regions.end()) return false;
+    const Page& page = pages[it->second.page];
+    if (!page.texture) return false;
+
+    outRegion.texture = page.texture;
+    outRegion.rect = it->second.rect;
+    outRegion.isSubRect = true;
+    return true;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "../utils/sdl_includes.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * 텍스처 + 텍스처 내 영역.
+ * 아틀라스에 들어간 이미지는 페이지 텍스처의 일부(isSubRect = true),
+ * 그 외 이미지는 텍스처 전체를 가리킨다.
+ */
+struct TextureRegion {
+    SDL_Texture* texture = nullptr;
+    SDL_Rect rect = {0, 0, 0, 0};
+    bool isSubRect = false;
+
+    explicit operator bool() const { return texture != nullptr; }
+};
+
+/**
+ * 스카이라인(bottom-left) 사각형 패커.
+ * 배치된 사각형들의 윗면 윤곽선만 유지하고, 새 사각형은 가장 낮게 놓이는 위치에 넣는다.
+ * 높이가 같으면 시작 세그먼트가 더 좁은 쪽, 그것도 같으면 더 왼쪽.
+ */
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height);
+
+    // 성공하면 outRect에 위치를 채우고 true
+    bool insert(int w, int h, SDL_Rect& outRect);
+
+private:
+    struct Segment {
+        int x, y, w;
+    };
+    int width;
+    int height;
+    std::vector<Segment> skyline;
+
+    // index 세그먼트부터 w 너비를 덮을 때 놓일 y (들어가지 않으면 -1)
+    int fitAt(size_t index, int w, int h) const;
+    void addSegment(size_t index, int x, int y, int w, int h);
+};
+
+/**
+ * 이미지 그룹을 kPageSize x kPageSize 페이지에 패킹한 런타임 아틀라스.
+ * 각 이미지는 가장자리(네 변과 네 모서리) 픽셀을 kPadding만큼 복제(extrude)해서 선형 필터링 시 이웃 이미지가 번지지 않게 한다.
+ * 페이지보다 큰 이미지는 패킹하지 않는다 (findRegion 실패 → 호출자가 단독 텍스처로 로드).
+ */
+class TextureAtlas {
+public:
+    static constexpr int kPageSize = 2048;
+    static constexpr int kPadding = 1;
+
+    TextureAtlas(SDL_Renderer* renderer, const std::string& name);
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // (이미지 이름, 디코딩된 surface) 목록을 패킹. surface 소유권을 가져가며 nullptr 항목은 건너뜀
+    bool build(const std::vector<std::pair<std::string, SDL_Surface*>>& images);
+
+    bool findRegion(const std::string& imageName, TextureRegion& outRegion) const;
+    bool contains(const std::string& imageName) const { return regions.count(imageName) > 0; }
+    int getPageCount() const { return static_cast<int>(pages.size()); }
+    size_t getTextureBytes() const { return pages.size() * static_cast<size_t>(kPageSize) * kPageSize * 4; }
+    const std::string& getName() const { return name; }
+
+private:
+    struct Page {
+        SDL_Surface* surface = nullptr;   // 패킹 중에만 사용, 텍스처 생성 후 해제
+        SDL_Texture* texture = nullptr;
+        SkylinePacker packer{kPageSize, kPageSize};
+    };
+    struct Entry {
+        int page;
+        SDL_Rect rect;
+    };
+
+    SDL_Renderer* renderer;
+    std::string name;
+    std::vector<Page> pages;
+    std::unordered_map<std::string, Entry> regions;
+
+    void blitWithExtrude(SDL_Surface* src, SDL_Surface* dst, int x, int y);
+};
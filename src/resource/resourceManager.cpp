@@ -1,9 +1,39 @@
 #include "resourceManager.h"
 #include "../utils/logger.h"
 #include "../utils/FileIO.h"
+#include "../utils/Profiler.h"
+#include "../utils/JobSystem.h"
+#include "../rendering/TextRenderer.h"
+#include "../animation/AnimationClip.h"
 
 #include <json/json.h>
 #include <sstream>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+// 매니페스트의 텍스트 계열 리소스 (파일 읽기와 씬 파싱은 잡 시스템에서 나눠 처리)
+struct PendingFile {
+    enum class Type { Scene, Json, Text };
+    Type type;
+    std::string name;
+    std::string path;
+    // 워커가 채우는 결과
+    std::string content;
+    nlohmann::json sceneJson;
+    std::string parseError;
+};
+
+// 미리 컴파일할 애니메이션 클립 하나 (워커가 파싱·컴파일)
+struct PendingClip {
+    std::string name;
+    const std::string* text = nullptr;
+    std::shared_ptr<const AnimationClip> clip;
+    std::string parseError;
+};
+
+}  // namespace
 
 ResourceManager::ResourceManager(SDL_Renderer* sdlRenderer) 
     : renderer(sdlRenderer) {}
@@ -54,6 +84,8 @@ void ResourceManager::loadResources(const std::string& resourceFilePath) {
     int sceneCount = 0;
     int jsonCount = 0;
     int textCount = 0;
+    int fontCount = 0;
+    std::vector<PendingFile> pendingFiles;
 
     for (const auto& res : root["resources"]) {
         std::string name = res["name"].asString();
@@ -68,43 +100,145 @@ void ResourceManager::loadResources(const std::string& resourceFilePath) {
             imagePaths[name] = fullPath;
             imagePathCount++;
         }
-        else if (type == "scene") {
-            std::string sceneContent = FileIO::readFileAsText(fullPath);
-            if (sceneContent.empty()) {
-                Log::error("[ResourceManager] Failed to open scene file: ", fullPath);
-                continue;
-            }
-            try {
-                nlohmann::json sceneJson = nlohmann::json::parse(sceneContent);
-                scenes[name] = sceneJson;
-                sceneCount++;
-            } catch (const std::exception& e) {
-                Log::error("[ResourceManager] Error parsing scene json: ", fullPath, " - ", e.what());
-            }
+        else if (type == "scene" || type == "json" || type == "text") {
+            PendingFile file;
+            file.type = type == "scene" ? PendingFile::Type::Scene
+                      : type == "json" ? PendingFile::Type::Json : PendingFile::Type::Text;
+            file.name = name;
+            file.path = fullPath;
+            pendingFiles.push_back(std::move(file));
         }
-        else if (type == "json") {
-            std::string jsonContent = FileIO::readFileAsText(fullPath);
-            if (!jsonContent.empty()) {
-                jsonTexts[name] = jsonContent;
-                jsonCount++;
-            } else {
-                Log::error("[ResourceManager] Failed to load json file: ", fullPath);
+        else if (type == "font") {
+            // 폰트는 TextRenderer가 (파일, 크기)별로 열어서 캐시. 여기서는 경로와 미리 열 크기만 기록
+            FontResource font;
+            font.path = fullPath;
+            for (const auto& size : res["preload"]) {
+                if (size.isInt()) {
+                    font.preloadSizes.push_back(size.asInt());
+                }
             }
+            fonts[name] = font;
+            fontCount++;
         }
-        else if (type == "text") {
-            std::string textContent = FileIO::readFileAsText(fullPath);
-            if (!textContent.empty()) {
-                texts[name] = textContent;
-                textCount++;
-            } else {
-                Log::error("[ResourceManager] Failed to load text: ", fullPath);
+    }
+
+    // 📂 파일 읽기와 씬 JSON 파싱은 워커와 나눠 처리하고, 맵 등록과 로그는 매니페스트 순서대로
+    {
+        PROFILE_SCOPE("ResourceManager::loadTextFiles");
+        JobSystem::parallelFor(pendingFiles.size(), 1, [&pendingFiles](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                PendingFile& file = pendingFiles[i];
+                file.content = FileIO::readFileAsText(file.path);
+                if (file.type != PendingFile::Type::Scene || file.content.empty()) {
+                    continue;
+                }
+                try {
+                    file.sceneJson = nlohmann::json::parse(file.content);
+                } catch (const std::exception& e) {
+                    file.parseError = e.what();
+                }
+                file.content.clear();
+                file.content.shrink_to_fit();
             }
+        });
+    }
+    for (PendingFile& file : pendingFiles) {
+        switch (file.type) {
+            case PendingFile::Type::Scene:
+                if (!file.parseError.empty()) {
+                    Log::error("[ResourceManager] Error parsing scene json: ", file.path, " - ", file.parseError);
+                } else if (file.sceneJson.is_null()) {
+                    Log::error("[ResourceManager] Failed to open scene file: ", file.path);
+                } else {
+                    scenes[file.name] = std::move(file.sceneJson);
+                    sceneCount++;
+                }
+                break;
+            case PendingFile::Type::Json:
+                if (!file.content.empty()) {
+                    jsonTexts[file.name] = std::move(file.content);
+                    jsonCount++;
+                } else {
+                    Log::error("[ResourceManager] Failed to load json file: ", file.path);
+                }
+                break;
+            case PendingFile::Type::Text:
+                if (!file.content.empty()) {
+                    texts[file.name] = std::move(file.content);
+                    textCount++;
+                } else {
+                    Log::error("[ResourceManager] Failed to load text: ", file.path);
+                }
+                break;
         }
     }
 
     Log::info("[ResourceManager] Registered ", imagePathCount, " image paths, ", 
-              sceneCount, " scenes, ", jsonCount, " json files, and ", 
-              textCount, " texts. (Images will be loaded on demand)");
+              sceneCount, " scenes, ", jsonCount, " json files, ", 
+              textCount, " texts, and ", fontCount, " fonts. (Images will be loaded on demand)");
+
+    // 아틀라스 그룹: 작은 이미지(아이콘/버튼/카드)를 공유 페이지 텍스처로 패킹
+    std::vector<std::string> preloadAtlases;
+    for (const auto& atlas : root["atlases"]) {
+        std::string groupName = atlas["name"].asString();
+        if (groupName.empty()) continue;
+        for (const auto& image : atlas["images"]) {
+            std::string imageName = image.asString();
+            if (imagePaths.find(imageName) == imagePaths.end()) {
+                Log::error("[ResourceManager] Atlas '", groupName, "' references unknown image: ", imageName);
+                continue;
+            }
+            atlasGroups[groupName].push_back(imageName);
+            imageAtlasGroup[imageName] = groupName;
+        }
+        if (atlas.isMember("preload") && atlas["preload"].asBool()) {
+            preloadAtlases.push_back(groupName);
+        }
+    }
+    for (const auto& groupName : preloadAtlases) {
+        getOrBuildAtlas(groupName);
+    }
+
+    // 미리 컴파일할 애니메이션 JSON (첫 재생에서 파싱하지 않도록). 파싱·컴파일은 워커와 나눠 처리
+    std::vector<PendingClip> pendingClips;
+    for (const auto& animation : root["animations"]) {
+        PendingClip pending;
+        pending.name = animation.asString();
+        if (animationClips.count(pending.name) > 0) continue;
+        auto textIt = jsonTexts.find(pending.name);
+        if (textIt == jsonTexts.end()) {
+            std::cerr << "[ResourceManager] Animation JSON not found: " << pending.name << std::endl;
+            continue;
+        }
+        pending.text = &textIt->second;
+        pendingClips.push_back(std::move(pending));
+    }
+    {
+        PROFILE_SCOPE("ResourceManager::compileAnimationClips");
+        JobSystem::parallelFor(pendingClips.size(), 1, [&pendingClips](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                PendingClip& pending = pendingClips[i];
+                try {
+                    pending.clip = AnimationClip::compile(pending.name, nlohmann::json::parse(*pending.text));
+                } catch (const std::exception& e) {
+                    pending.parseError = e.what();
+                }
+            }
+        });
+    }
+    int clipCount = 0;
+    for (PendingClip& pending : pendingClips) {
+        if (!pending.parseError.empty()) {
+            std::cerr << "[ResourceManager] Error parsing animation JSON: " << pending.name << " - " << pending.parseError << std::endl;
+        }
+        if (pending.clip) {
+            animationClips[pending.name] = std::move(pending.clip);
+            clipCount++;
+        }
+    }
+    if (clipCount > 0) {
+        Log::info("[ResourceManager] Precompiled ", clipCount, " animation clips");
+    }
 }
 
 
@@ -112,38 +246,463 @@ SDL_Texture* ResourceManager::getTexture(const std::string& textureName) {
     // 먼저 이미 로드된 텍스처 확인
     auto it = textures.find(textureName);
     if (it != textures.end()) {
+        if (residents.count(textureName) > 0) {
+            touchResident(textureName);
+        }
         return it->second;
     }
     
-    // 이미지 경로에서 찾아서 lazy loading
+    // 이미지 경로에서 찾아서 lazy loading (축출된 이미지도 여기서 다시 로드)
     auto pathIt = imagePaths.find(textureName);
     if (pathIt != imagePaths.end()) {
-        std::string path = pathIt->second;
-        
-        // 이미지 로드
-        SDL_Surface* surface = IMG_Load(path.c_str());
+        PROFILE_SCOPE("ResourceManager::loadImage");
+
+        // 아틀라스 그룹 이미지의 디코드 결과는 아틀라스용으로 남겨 두고 단독 텍스처는 따로 디코딩
+        SDL_Surface* surface = imageAtlasGroup.count(textureName) > 0
+            ? ImageDecodeQueue::decodeFile(pathIt->second)
+            : acquireSurface(textureName);
         if (!surface) {
-            Log::error("[ResourceManager] Error: Unable to load image ", path, 
-                      ", SDL_image Error: ", IMG_GetError());
             return nullptr;
         }
+        return uploadTexture(textureName, surface);
+    }
+    
+    // 찾을 수 없음
+    return nullptr;
+}
 
-        SDL_Texture* sdlTexture = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_FreeSurface(surface);
+SDL_Surface* ResourceManager::acquireSurface(const std::string& imageName) {
+    auto decodedIt = decodedAtlasSurfaces.find(imageName);
+    if (decodedIt != decodedAtlasSurfaces.end()) {
+        SDL_Surface* surface = decodedIt->second;
+        decodedAtlasSurfaces.erase(decodedIt);
+        return surface;
+    }
 
-        if (!sdlTexture) {
-            Log::error("[ResourceManager] Error: Unable to create texture for ", 
-                      textureName, ", SDL Error: ", SDL_GetError());
-            return nullptr;
+    // prefetch 중이면 워커 결과 사용 (디코딩 중이면 끝날 때까지 대기)
+    SDL_Surface* surface = nullptr;
+    if (decodeQueue && decodeQueue->take(imageName, surface)) {
+        return surface;
+    }
+
+    auto pathIt = imagePaths.find(imageName);
+    if (pathIt == imagePaths.end()) {
+        return nullptr;
+    }
+    return ImageDecodeQueue::decodeFile(pathIt->second);
+}
+
+SDL_Surface* ResourceManager::getSurface(const std::string& name) {
+    auto it = surfaces.find(name);
+    if (it != surfaces.end()) {
+        return it->second;
+    }
+    auto pathIt = imagePaths.find(name);
+    if (pathIt == imagePaths.end()) {
+        return nullptr;  // 텍스트 키는 keepSurface로 만든 것만 있음
+    }
+    // 텍스처 로드 경로(디코드 큐)는 건드리지 않고 파일에서 직접 디코딩 (이름당 한 번)
+    PROFILE_SCOPE("ResourceManager::decodeSurface");
+    SDL_Surface* surface = ImageDecodeQueue::decodeFile(pathIt->second);
+    storeSurface(name, surface);
+    return surface;
+}
+
+void ResourceManager::storeSurface(const std::string& key, SDL_Surface* surface) {
+    if (!surface) return;
+    releaseSurface(key);
+    surfaces[key] = surface;
+    surfaceBytes += static_cast<size_t>(surface->pitch) * surface->h;
+}
+
+void ResourceManager::releaseSurface(const std::string& key) {
+    auto it = surfaces.find(key);
+    if (it == surfaces.end()) return;
+    size_t bytes = static_cast<size_t>(it->second->pitch) * it->second->h;
+    surfaceBytes = bytes < surfaceBytes ? surfaceBytes - bytes : 0;
+    SDL_FreeSurface(it->second);
+    surfaces.erase(it);
+}
+
+SDL_Texture* ResourceManager::uploadTexture(const std::string& imageName, SDL_Surface* surface) {
+    SDL_Texture* sdlTexture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+
+    if (!sdlTexture) {
+        Log::error("[ResourceManager] Error: Unable to create texture for ", 
+                  imageName, ", SDL Error: ", SDL_GetError());
+        return nullptr;
+    }
+
+    // 텍스처 캐싱
+    textures[imageName] = sdlTexture;
+    trackResident(imageName, getTextureBytes(sdlTexture));
+    return sdlTexture;
+}
+
+void ResourceManager::prefetchImage(const std::string& imageName) {
+    if (decodeThreadCount <= 0) {
+        return;
+    }
+    auto pathIt = imagePaths.find(imageName);
+    if (pathIt == imagePaths.end()) {
+        return;
+    }
+
+    if (!decodeQueue) {
+        decodeQueue = std::make_unique<ImageDecodeQueue>(decodeThreadCount);
+    }
+
+    auto groupIt = imageAtlasGroup.find(imageName);
+    if (groupIt != imageAtlasGroup.end()) {
+        // 아틀라스는 그룹 단위로 만들어지므로 그룹 전체를 요청
+        if (atlases.count(groupIt->second) > 0) {
+            return;
+        }
+        for (const auto& member : atlasGroups[groupIt->second]) {
+            if (decodedAtlasSurfaces.count(member) == 0) {
+                decodeQueue->request(member, imagePaths[member]);
+            }
         }
+        return;
+    }
 
-        // 텍스처 캐싱
-        textures[textureName] = sdlTexture;
-        return sdlTexture;
+    if (textures.count(imageName) > 0) {
+        return;
+    }
+    decodeQueue->request(imageName, pathIt->second);
+}
+
+void ResourceManager::collectSceneImages(const nlohmann::json& node, std::vector<std::string>& outImages) {
+    if (node.is_string()) {
+        const std::string& value = node.get_ref<const std::string&>();
+        if (imagePaths.count(value) > 0) {
+            outImages.push_back(value);
+            return;
+        }
+        // 타일맵 등 json 리소스로 분리된 맵 파일 안의 타일셋
+        if (jsonTexts.count(value) > 0) {
+            nlohmann::json jsonData = getJson(value);
+            if (jsonData.is_object() && jsonData.value("type", "") == "map") {
+                collectSceneImages(jsonData, outImages);
+            }
+        }
+        return;
+    }
+    if (node.is_object() || node.is_array()) {
+        for (const auto& child : node) {
+            collectSceneImages(child, outImages);
+        }
+    }
+}
+
+// Scene::loadScene과 같은 규칙으로 include_layout을 펼쳐서 이미지 이름 수집
+bool ResourceManager::collectSceneImageNames(const std::string& sceneName, std::vector<std::string>& outImages) {
+    auto sceneIt = scenes.find(sceneName);
+    if (sceneIt == scenes.end()) {
+        return false;
+    }
+    const nlohmann::json& sceneData = sceneIt->second;
+    if (sceneData.contains("ui") && sceneData["ui"].is_array()) {
+        for (const auto& item : sceneData["ui"]) {
+            std::string type = item.contains("type") ? item["type"].get<std::string>() : "";
+            if (type == "include_layout" && item.contains("layout")) {
+                auto layoutIt = scenes.find(item["layout"].get<std::string>());
+                if (layoutIt != scenes.end() && layoutIt->second.contains("ui")) {
+                    collectSceneImages(layoutIt->second["ui"], outImages);
+                }
+            } else {
+                collectSceneImages(item, outImages);
+            }
+        }
+    }
+    return true;
+}
+
+int ResourceManager::prefetchScene(const std::string& sceneName) {
+    PROFILE_SCOPE("ResourceManager::prefetchScene");
+
+    std::vector<std::string> images;
+    if (!collectSceneImageNames(sceneName, images)) {
+        Log::error("[ResourceManager] prefetchScene: scene not found: ", sceneName);
+        return 0;
+    }
+    for (const auto& imageName : images) {
+        prefetchImage(imageName);
+    }
+    return static_cast<int>(images.size());
+}
+
+bool ResourceManager::isAtlasGroupDecoded(const std::string& groupName) const {
+    auto groupIt = atlasGroups.find(groupName);
+    if (groupIt == atlasGroups.end()) {
+        return false;
+    }
+    for (const auto& member : groupIt->second) {
+        if (decodedAtlasSurfaces.count(member) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ResourceManager::processUploads(float budgetMs) {
+    if (!decodeQueue && !textRasterQueue) {
+        return;
+    }
+    PROFILE_SCOPE("ResourceManager::processUploads");
+
+    auto start = std::chrono::steady_clock::now();
+    std::string imageName;
+    SDL_Surface* surface = nullptr;
+    while (decodeQueue && decodeQueue->popCompleted(imageName, surface)) {
+        auto groupIt = imageAtlasGroup.find(imageName);
+        if (groupIt != imageAtlasGroup.end()) {
+            const std::string& groupName = groupIt->second;
+            if (atlases.count(groupName) > 0) {
+                if (surface) SDL_FreeSurface(surface);  // 그 사이 동기 경로로 아틀라스가 만들어짐
+            } else {
+                // 디코딩 실패(nullptr)도 기록해야 그룹이 완료로 판정됨 (build가 nullptr 항목은 건너뜀)
+                decodedAtlasSurfaces[imageName] = surface;
+                if (isAtlasGroupDecoded(groupName)) {
+                    getOrBuildAtlas(groupName);
+                }
+            }
+        } else if (surface) {  // nullptr이면 디코딩 실패 (로그는 워커에서 남김)
+            if (textures.count(imageName) > 0) {
+                SDL_FreeSurface(surface);
+            } else {
+                uploadTexture(imageName, surface);
+            }
+        }
+
+        // 처리 후 검사하므로 예산이 작아도 프레임당 최소 1개는 진행됨
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMs) {
+            break;
+        }
+    }
+
+    // 텍스트: 이미지가 예산을 다 써도 프레임당 최소 1개는 업로드 (채팅 연속 입력 등에서 굶지 않도록)
+    std::string textKey;
+    bool uploadedText = false;
+    while (textRasterQueue && textRasterQueue->popCompleted(textKey, surface)) {
+        uploadTextSurface(textKey, surface);
+        uploadedText = true;
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetMs) {
+            break;
+        }
+    }
+    if (uploadedText) {
+        enforceTextureBudget();
+    }
+}
+
+bool ResourceManager::hasPendingPrefetch() const {
+    return (decodeQueue && decodeQueue->getPendingCount() > 0) || !decodedAtlasSurfaces.empty();
+}
+
+TextureAtlas* ResourceManager::getOrBuildAtlas(const std::string& groupName) {
+    auto it = atlases.find(groupName);
+    if (it != atlases.end()) {
+        return it->second.get();
+    }
+
+    auto groupIt = atlasGroups.find(groupName);
+    if (groupIt == atlasGroups.end()) {
+        return nullptr;
+    }
+
+    std::vector<std::pair<std::string, SDL_Surface*>> images;
+    for (const auto& imageName : groupIt->second) {
+        images.emplace_back(imageName, acquireSurface(imageName));
+    }
+
+    auto atlas = std::make_unique<TextureAtlas>(renderer, groupName);
+    atlas->build(images);
+    TextureAtlas* result = atlas.get();
+    size_t bytes = atlas->getTextureBytes();
+    atlases[groupName] = std::move(atlas);  // 실패해도 저장 (매 요청마다 재시도 방지)
+    trackResident("atlas:" + groupName, bytes);
+    return result;
+}
+
+TextureRegion ResourceManager::getTextureRegion(const std::string& textureName) {
+    TextureRegion region;
+
+    auto groupIt = imageAtlasGroup.find(textureName);
+    if (groupIt != imageAtlasGroup.end()) {
+        TextureAtlas* atlas = getOrBuildAtlas(groupIt->second);
+        if (atlas && atlas->findRegion(textureName, region)) {
+            touchResident("atlas:" + groupIt->second);
+            return region;
+        }
+    }
+
+    // 아틀라스 밖 이미지 / 동적 텍스처: 텍스처 전체
+    SDL_Texture* texture = getTexture(textureName);
+    if (!texture) {
+        return region;
+    }
+    int w = 0, h = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+    region.texture = texture;
+    region.rect = {0, 0, w, h};
+    region.isSubRect = false;
+    return region;
+}
+
+size_t ResourceManager::getTextureBytes(SDL_Texture* texture) {
+    Uint32 format = 0;
+    int w = 0, h = 0;
+    if (!texture || SDL_QueryTexture(texture, &format, nullptr, &w, &h) != 0) {
+        return 0;
+    }
+    int bytesPerPixel = SDL_BYTESPERPIXEL(format);
+    if (bytesPerPixel <= 0) bytesPerPixel = 4;
+    return static_cast<size_t>(w) * h * bytesPerPixel;
+}
+
+std::string ResourceManager::residencyKey(const std::string& imageName) const {
+    auto groupIt = imageAtlasGroup.find(imageName);
+    if (groupIt != imageAtlasGroup.end()) {
+        return "atlas:" + groupIt->second;
+    }
+    return imageName;
+}
+
+void ResourceManager::addSceneReference(const std::string& sceneName, const std::string& key) {
+    if (sceneReferences[sceneName].insert(key).second) {
+        sceneRefCounts[key]++;
+    }
+}
+
+void ResourceManager::releaseScene(const std::string& sceneName) {
+    auto sceneIt = sceneReferences.find(sceneName);
+    if (sceneIt == sceneReferences.end()) {
+        return;
+    }
+    for (const auto& key : sceneIt->second) {
+        auto refIt = sceneRefCounts.find(key);
+        if (refIt != sceneRefCounts.end() && --refIt->second <= 0) {
+            sceneRefCounts.erase(refIt);
+        }
+    }
+    sceneReferences.erase(sceneIt);
+}
+
+void ResourceManager::setActiveScene(const std::string& sceneName) {
+    if (sceneName == activeScene && sceneReferences.count(sceneName) > 0) {
+        return;
+    }
+    // 새 씬 참조를 먼저 잡아야 두 씬이 같이 쓰는 이미지가 해제됐다 다시 로드되지 않음
+    std::vector<std::string> images;
+    collectSceneImageNames(sceneName, images);
+    for (const auto& imageName : images) {
+        addSceneReference(sceneName, residencyKey(imageName));
+    }
+    if (activeScene != sceneName) {
+        releaseScene(activeScene);
+    }
+    activeScene = sceneName;
+    enforceTextureBudget();
+}
+
+void ResourceManager::trackResident(const std::string& key, size_t bytes) {
+    if (residents.count(key) > 0) {
+        touchResident(key);
+        return;
+    }
+    residentLru.push_back(key);
+    Resident resident;
+    resident.bytes = bytes;
+    resident.lruIt = std::prev(residentLru.end());
+    residents[key] = resident;
+    residentBytes += bytes;
+    // 로드 시점의 씬이 참조 (코드에서 동적으로 바꾸는 이미지 포함)
+    addSceneReference(activeScene, key);
+    enforceTextureBudget();
+}
+
+void ResourceManager::touchResident(const std::string& key) {
+    auto it = residents.find(key);
+    if (it == residents.end()) {
+        return;
+    }
+    residentLru.splice(residentLru.end(), residentLru, it->second.lruIt);
+    addSceneReference(activeScene, key);
+}
+
+void ResourceManager::evictResident(const std::string& key) {
+    auto it = residents.find(key);
+    if (it == residents.end()) {
+        return;
+    }
+    if (key.rfind("atlas:", 0) == 0) {
+        atlases.erase(key.substr(6));  // 다음 getTextureRegion에서 다시 패킹
+        auto groupIt = atlasGroups.find(key.substr(6));
+        if (groupIt != atlasGroups.end()) {
+            for (const auto& member : groupIt->second) {
+                releaseSurface(member);
+            }
+        }
+    } else {
+        releaseSurface(key);
+        auto texIt = textures.find(key);
+        if (texIt != textures.end()) {
+            SDL_DestroyTexture(texIt->second);
+            textures.erase(texIt);
+        }
+    }
+    residentBytes -= it->second.bytes;
+    residentLru.erase(it->second.lruIt);
+    residents.erase(it);
+    evictionCount++;
+}
+
+void ResourceManager::enforceTextureBudget() {
+    if (textureBudgetBytes == 0) {
+        return;
+    }
+    // 보관만 하고 있는 텍스트 텍스처를 먼저 비움
+    if (residentBytes + dynamicBytes > textureBudgetBytes) {
+        size_t over = residentBytes + dynamicBytes - textureBudgetBytes;
+        trimTextCache(over < idleTextBytes ? idleTextBytes - over : 0);
+    }
+    // 씬이 참조 중인 텍스처는 UIElement가 포인터를 들고 있으므로 건너뜀
+    auto it = residentLru.begin();
+    while (residentBytes + dynamicBytes > textureBudgetBytes && it != residentLru.end()) {
+        const std::string key = *it;
+        ++it;
+        if (sceneRefCounts.count(key) > 0) {
+            continue;
+        }
+        evictResident(key);
     }
-    
-    // 찾을 수 없음
-    return nullptr;
+}
+
+void ResourceManager::setTextureBudget(size_t bytes) {
+    textureBudgetBytes = bytes;
+    enforceTextureBudget();
+}
+
+TextureMemoryStats ResourceManager::getTextureMemoryStats() const {
+    TextureMemoryStats stats;
+    stats.residentBytes = residentBytes;
+    stats.dynamicBytes = dynamicBytes;
+    stats.budgetBytes = textureBudgetBytes;
+    stats.residentCount = static_cast<int>(residents.size());
+    stats.evictionCount = evictionCount;
+    stats.patchCacheHits = patchCacheHits;
+    stats.patchCacheMisses = patchCacheMisses;
+    stats.textCacheBytes = idleTextBytes;
+    stats.textCacheBudgetBytes = textCacheBudgetBytes;
+    stats.textCacheHits = textCacheHits;
+    stats.textCacheMisses = textCacheMisses;
+    stats.textRasterPending = static_cast<int>(pendingTextRefs.size());
+    stats.surfaceBytes = surfaceBytes;
+    return stats;
 }
 
 std::string ResourceManager::registerTexture(const std::string& textureName, SDL_Texture* texture) {
@@ -163,6 +722,7 @@ std::string ResourceManager::registerTexture(const std::string& textureName, SDL
     // 새로 등록
     textures[textureName] = texture;
     textureRefCount[textureName] = 1;
+    dynamicBytes += getTextureBytes(texture);
     return textureName;  // 지정한 이름을 ID로 반환
 }
 
@@ -184,6 +744,14 @@ std::string ResourceManager::registerTexture(SDL_Texture* texture) {
 void ResourceManager::unregisterTexture(const std::string& textureName) {
     auto refIt = textureRefCount.find(textureName);
     if (refIt == textureRefCount.end()) {
+        // 업로드 전인 비동기 텍스트 요청이면 참조만 줄이고, 아무도 기다리지 않으면 요청 취소
+        auto pendingIt = pendingTextRefs.find(textureName);
+        if (pendingIt != pendingTextRefs.end() && --pendingIt->second.refs <= 0) {
+            pendingTextRefs.erase(pendingIt);
+            if (textRasterQueue) {
+                textRasterQueue->cancel(textureName);
+            }
+        }
         // 참조 카운트가 없으면 정적 텍스처 (이미지)이므로 무시
         return;
     }
@@ -193,12 +761,239 @@ void ResourceManager::unregisterTexture(const std::string& textureName) {
     
     // 참조 카운트가 0이 되면 텍스처 삭제
     if (refIt->second <= 0) {
+        textureRefCount.erase(refIt);
         auto texIt = textures.find(textureName);
+        if (texIt == textures.end()) {
+            return;
+        }
+        // 텍스트 텍스처는 스크롤로 다시 보일 때를 위해 보관 (예산을 넘으면 오래된 것부터 해제)
+        if (textCacheBudgetBytes > 0 && textureName.compare(0, 5, "text:") == 0) {
+            parkIdleText(textureName, texIt->second);
+            return;
+        }
+        destroyDynamicTexture(textureName);
+    }
+}
+
+void ResourceManager::parkIdleText(const std::string& key, SDL_Texture* texture) {
+    idleTextEntries[key] = idleTextLru.insert(idleTextLru.end(), key);
+    idleTextBytes += getTextureBytes(texture);
+    trimTextCache(textCacheBudgetBytes);
+}
+
+void ResourceManager::destroyDynamicTexture(const std::string& textureName) {
+    releaseSurface(textureName);
+    textSurfaceKeys.erase(textureName);
+    auto texIt = textures.find(textureName);
+    if (texIt == textures.end()) return;
+    size_t bytes = getTextureBytes(texIt->second);
+    dynamicBytes = bytes < dynamicBytes ? dynamicBytes - bytes : 0;
+    SDL_DestroyTexture(texIt->second);
+    textures.erase(texIt);
+}
+
+void ResourceManager::trimTextCache(size_t maxIdleBytes) {
+    while (idleTextBytes > maxIdleBytes && !idleTextLru.empty()) {
+        std::string key = idleTextLru.front();
+        idleTextLru.pop_front();
+        idleTextEntries.erase(key);
+        auto texIt = textures.find(key);
         if (texIt != textures.end()) {
-            SDL_DestroyTexture(texIt->second);
-            textures.erase(texIt);
+            size_t bytes = getTextureBytes(texIt->second);
+            idleTextBytes = bytes < idleTextBytes ? idleTextBytes - bytes : 0;
         }
-        textureRefCount.erase(refIt);
+        destroyDynamicTexture(key);
+    }
+    if (idleTextLru.empty()) {
+        idleTextBytes = 0;
+    }
+}
+
+void ResourceManager::setTextCacheBudget(size_t bytes) {
+    textCacheBudgetBytes = bytes;
+    trimTextCache(bytes);
+}
+
+SDL_Texture* ResourceManager::acquireTextTexture(TextRenderer* textRenderer, const std::string& text, int fontSize,
+                                                 SDL_Color color, int wrapWidth, int maxHeight,
+                                                 const std::string& fontName, std::string& outTextureId,
+                                                 bool keepSurface) {
+    outTextureId.clear();
+    if (!textRenderer || text.empty()) {
+        return nullptr;
+    }
+
+    std::string key = makeTextKey(text, fontSize, color, wrapWidth, maxHeight, fontName);
+    if (keepSurface) {
+        textSurfaceKeys.insert(key);
+    }
+    if (SDL_Texture* cached = findTextTexture(key)) {
+        if (keepSurface && surfaces.count(key) == 0) {
+            // surface 없이 만들어진 항목: CPU 사본만 다시 그림
+            storeSurface(key, TextRenderer::renderSurface(textRenderer->getFont(fontName, fontSize), text, color,
+                                                          wrapWidth, maxHeight));
+        }
+        auto idleIt = idleTextEntries.find(key);
+        if (idleIt != idleTextEntries.end()) {
+            idleTextLru.erase(idleIt->second);
+            idleTextEntries.erase(idleIt);
+            size_t bytes = getTextureBytes(cached);
+            idleTextBytes = bytes < idleTextBytes ? idleTextBytes - bytes : 0;
+        }
+        outTextureId = registerTexture(key, cached);  // 참조 카운트 증가 (보관 중이었으면 0 → 1)
+        textCacheHits++;
+        return cached;
+    }
+
+    // 워커에서 래스터화 중이어도 지금 필요하면 동기로 그림 (대기 중이던 참조는 아래에서 이 텍스처로 옮김)
+    SDL_Surface* surface = TextRenderer::renderSurface(textRenderer->getFont(fontName, fontSize), text, color,
+                                                       wrapWidth, maxHeight);
+    if (!surface) {
+        return nullptr;
+    }
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        Log::error("[ResourceManager] Failed to create text texture: ", SDL_GetError());
+        SDL_FreeSurface(surface);
+        return nullptr;
+    }
+    if (textSurfaceKeys.count(key) > 0) {
+        storeSurface(key, surface);
+    } else {
+        SDL_FreeSurface(surface);
+    }
+    textCacheMisses++;
+    outTextureId = registerTexture(key, texture);
+
+    // 같은 키의 워커 요청을 기다리던 참조를 옮기고 요청 취소 (한 키의 참조는 textureRefCount 한 곳에만 있음)
+    auto pendingIt = pendingTextRefs.find(key);
+    if (pendingIt != pendingTextRefs.end()) {
+        textureRefCount[key] += pendingIt->second.refs;
+        pendingTextRefs.erase(pendingIt);
+        if (textRasterQueue) {
+            textRasterQueue->cancel(key);
+        }
+    }
+    return texture;
+}
+
+std::string ResourceManager::makeTextKey(const std::string& text, int fontSize, SDL_Color color,
+                                         int wrapWidth, int maxHeight, const std::string& fontName) const {
+    // 렌더 결과를 결정하는 값 전부를 키로 사용 (텍스트는 마지막에 두어 구분자와 섞이지 않게)
+    char style[64];
+    std::snprintf(style, sizeof(style), "%d:%02x%02x%02x%02x:%d:%d:", fontSize,
+                  color.r, color.g, color.b, color.a, wrapWidth, maxHeight);
+    return "text:" + fontName + ":" + style + text;
+}
+
+SDL_Texture* ResourceManager::findTextTexture(const std::string& textureId) const {
+    auto it = textures.find(textureId);
+    return it != textures.end() ? it->second : nullptr;
+}
+
+SDL_Texture* ResourceManager::requestTextTexture(TextRenderer* textRenderer, const std::string& text, int fontSize,
+                                                 SDL_Color color, int wrapWidth, int maxHeight,
+                                                 const std::string& fontName, std::string& outTextureId,
+                                                 bool keepSurface) {
+    outTextureId.clear();
+    if (!textRenderer || text.empty()) {
+        return nullptr;
+    }
+
+    std::string key = makeTextKey(text, fontSize, color, wrapWidth, maxHeight, fontName);
+    if (textRasterThreadCount <= 0 || findTextTexture(key)) {
+        return acquireTextTexture(textRenderer, text, fontSize, color, wrapWidth, maxHeight, fontName, outTextureId,
+                                  keepSurface);
+    }
+    if (keepSurface) {
+        textSurfaceKeys.insert(key);
+    }
+
+    // 이미 요청된 키면 참조만 추가 (같은 문구 여러 줄이 한 번만 래스터화됨)
+    auto pendingIt = pendingTextRefs.find(key);
+    if (pendingIt != pendingTextRefs.end()) {
+        pendingIt->second.refs++;
+        outTextureId = key;
+        return nullptr;
+    }
+
+    if (!textRasterQueue) {
+        textRasterQueue = std::make_unique<TextRasterQueue>(textRasterThreadCount);
+    }
+    TextRasterRequest rasterRequest;
+    rasterRequest.fontPath = textRenderer->getFontPath(fontName);
+    rasterRequest.fontSize = fontSize;
+    rasterRequest.text = text;
+    rasterRequest.color = color;
+    rasterRequest.wrapWidth = wrapWidth;
+    rasterRequest.maxHeight = maxHeight;
+    if (!textRasterQueue->request(key, rasterRequest)) {
+        // 종료 중 등 요청할 수 없으면 동기 경로
+        return acquireTextTexture(textRenderer, text, fontSize, color, wrapWidth, maxHeight, fontName, outTextureId,
+                                  keepSurface);
+    }
+    PendingText& pending = pendingTextRefs[key];
+    pending.refs = 1;
+    pending.textRenderer = textRenderer;
+    pending.fontName = fontName;
+    pending.request = std::move(rasterRequest);
+    textCacheMisses++;
+    outTextureId = key;
+    return nullptr;
+}
+
+void ResourceManager::uploadTextSurface(const std::string& key, SDL_Surface* surface) {
+    int refs = 0;
+    auto pendingIt = pendingTextRefs.find(key);
+    if (pendingIt != pendingTextRefs.end()) {
+        refs = pendingIt->second.refs;
+        if (!surface && refs > 0) {
+            // 워커 래스터화 실패 (워커 폰트 열기 실패 등): 메인 스레드 폰트로 동기 경로와 같이 다시 그림
+            const PendingText& pending = pendingIt->second;
+            const TextRasterRequest& request = pending.request;
+            surface = TextRenderer::renderSurface(pending.textRenderer->getFont(pending.fontName, request.fontSize),
+                                                  request.text, request.color, request.wrapWidth, request.maxHeight);
+        }
+        pendingTextRefs.erase(pendingIt);
+    }
+    if (!surface) {
+        // 동기로도 그릴 수 없음: 잡혀 있던 참조는 텍스처 없는 ID가 되고 반납 시 무시됨
+        // (위젯은 isTextPending이 false가 된 것으로 대기를 끝냄)
+        Log::error("[ResourceManager] Failed to rasterize text: ", key);
+        return;
+    }
+
+    if (textures.count(key) > 0) {
+        // 그 사이 동기 경로(acquireTextTexture)로 만들어짐. 대기 참조는 그때 옮겨졌으므로 결과만 버림
+        if (textSurfaceKeys.count(key) > 0 && surfaces.count(key) == 0) {
+            storeSurface(key, surface);
+        } else {
+            SDL_FreeSurface(surface);
+        }
+        return;
+    }
+    if (refs == 0 && textCacheBudgetBytes == 0) {
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (!texture) {
+        Log::error("[ResourceManager] Failed to upload text texture: ", SDL_GetError());
+        SDL_FreeSurface(surface);
+        return;
+    }
+    if (textSurfaceKeys.count(key) > 0) {
+        storeSurface(key, surface);
+    } else {
+        SDL_FreeSurface(surface);
+    }
+    textures[key] = texture;
+    dynamicBytes += getTextureBytes(texture);
+    if (refs > 0) {
+        textureRefCount[key] = refs;
+    } else {
+        parkIdleText(key, texture);  // 기다리던 위젯이 떠났어도 다시 나타날 수 있으므로 캐시에 보관
     }
 }
 
@@ -265,237 +1060,162 @@ nlohmann::json ResourceManager::getAnimationJson(const std::string& animName) {
     }
 }
 
+std::shared_ptr<const AnimationClip> ResourceManager::getAnimationClip(const std::string& animName) {
+    auto it = animationClips.find(animName);
+    if (it != animationClips.end()) {
+        return it->second;
+    }
+
+    PROFILE_SCOPE("ResourceManager::compileAnimationClip");
+    nlohmann::json animJson = getAnimationJson(animName);
+    if (animJson.is_null()) {
+        return nullptr;
+    }
+    std::shared_ptr<const AnimationClip> clip = AnimationClip::compile(animName, animJson);
+    if (clip) {
+        animationClips[animName] = clip;
+    }
+    return clip;
+}
+
 std::string ResourceManager::getText(const std::string& name) {
     auto it = texts.find(name);
     return (it != texts.end()) ? it->second : "";
 }
 
 SDL_Texture* ResourceManager::createNinePatchTexture(SDL_Texture* sourceTexture, int width, int height) {
-    if (!sourceTexture || !renderer || width <= 0 || height <= 0) {
+    if (!sourceTexture) {
         return nullptr;
     }
-    
-    // 원본 텍스처 크기 가져오기
-    int srcW, srcH;
-    SDL_QueryTexture(sourceTexture, nullptr, nullptr, &srcW, &srcH);
-    
-    if (srcW <= 0 || srcH <= 0) {
+    TextureRegion source;
+    source.texture = sourceTexture;
+    SDL_QueryTexture(sourceTexture, nullptr, nullptr, &source.rect.w, &source.rect.h);
+    return createNinePatchTexture(source, width, height);
+}
+
+SDL_Texture* ResourceManager::createNinePatchTexture(const TextureRegion& source, int width, int height) {
+    PROFILE_SCOPE("ResourceManager::createNinePatchTexture");
+    return createPatchTexture(source, width, height, PatchMode::Nine);
+}
+
+SDL_Texture* ResourceManager::createThreePatchTexture(SDL_Texture* sourceTexture, int width, int height) {
+    if (!sourceTexture) {
         return nullptr;
     }
-    
-    // 원본 크기 기준으로 9등분 계산 (스케일 다운 전 원본 크기 사용)
-    int thirdW = srcW / 3;
-    int thirdH = srcH / 3;
-    
-    Log::info("[ResourceManager] Creating nine-patch: src=", srcW, "x", srcH, 
-              ", dst=", width, "x", height, ", third=", thirdW, "x", thirdH);
-    
+    TextureRegion source;
+    source.texture = sourceTexture;
+    SDL_QueryTexture(sourceTexture, nullptr, nullptr, &source.rect.w, &source.rect.h);
+    return createThreePatchTexture(source, width, height);
+}
+
+SDL_Texture* ResourceManager::createThreePatchTexture(const TextureRegion& source, int width, int height) {
+    PROFILE_SCOPE("ResourceManager::createThreePatchTexture");
+    return createPatchTexture(source, width, height, PatchMode::Three);
+}
+
+SDL_Texture* ResourceManager::createPatchTexture(const TextureRegion& source, int width, int height, PatchMode mode) {
+    if (!source.texture || !renderer || width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    SDL_Texture* sourceTexture = source.texture;
+
+    // 조각 계산 (원본 영역이 아틀라스면 페이지 내 좌표)
+    SDL_Rect srcRects[PatchSlices::kMaxSlices];
+    SDL_Rect dstRects[PatchSlices::kMaxSlices];
+    int sliceCount = PatchSlices::compute(mode, source.rect, width, height, srcRects, dstRects);
+    if (sliceCount == 0) {
+        return nullptr;
+    }
+
+    Log::info("[ResourceManager] Creating ", (mode == PatchMode::Nine ? "nine" : "three"), "-patch: src=",
+              source.rect.w, "x", source.rect.h, ", dst=", width, "x", height);
+
     // 목적지 텍스처 생성
     SDL_Texture* dstTexture = SDL_CreateTexture(renderer, 
                                                 SDL_PIXELFORMAT_RGBA32,
                                                 SDL_TEXTUREACCESS_TARGET,
                                                 width, height);
     if (!dstTexture) {
-        Log::error("[ResourceManager] Failed to create nine-patch destination texture");
+        Log::error("[ResourceManager] Failed to create patch destination texture");
         return nullptr;
     }
     
     // 투명도 유지를 위한 블렌딩 모드 설정
     SDL_SetTextureBlendMode(dstTexture, SDL_BLENDMODE_BLEND);
     
-    // 렌더 타겟 설정
+    // 렌더 타겟 설정 후 투명색으로 클리어
     SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
     SDL_SetRenderTarget(renderer, dstTexture);
-    
-    // 투명색으로 클리어 (투명도 유지)
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
     SDL_RenderClear(renderer);
     
-    // 소스 영역 9개 정의 (정확한 9등분)
-    int srcLeftW = thirdW;
-    int srcCenterW = thirdW;
-    int srcRightW = srcW - thirdW * 2;  // 나머지
-    int srcTopH = thirdH;
-    int srcCenterH = thirdH;
-    int srcBottomH = srcH - thirdH * 2;  // 나머지
-    
-    SDL_Rect srcRects[9] = {
-        {0, 0, srcLeftW, srcTopH},                                    // 좌상
-        {srcLeftW, 0, srcCenterW, srcTopH},                         // 상중
-        {srcLeftW + srcCenterW, 0, srcRightW, srcTopH},             // 우상
-        {0, srcTopH, srcLeftW, srcCenterH},                         // 좌중
-        {srcLeftW, srcTopH, srcCenterW, srcCenterH},                // 중앙
-        {srcLeftW + srcCenterW, srcTopH, srcRightW, srcCenterH},   // 우중
-        {0, srcTopH + srcCenterH, srcLeftW, srcBottomH},            // 좌하
-        {srcLeftW, srcTopH + srcCenterH, srcCenterW, srcBottomH},   // 하중
-        {srcLeftW + srcCenterW, srcTopH + srcCenterH, srcRightW, srcBottomH} // 우하
-    };
-    
-    // 목적지 영역 9개 계산
-    // 모서리는 원본 크기를 유지하되, 목표가 모서리보다 작으면 비율에 맞게 축소
-    // 단, 모서리가 너무 작아지지 않도록 최소값 보장
-    
-    // 모서리 크기 계산: 원본 크기와 목표 크기 중 작은 값 사용
-    // 하지만 모서리가 너무 작아지지 않도록 최소값 보장
-    int dstLeftW = srcLeftW;
-    int dstRightW = srcRightW;
-    int dstTopH = srcTopH;
-    int dstBottomH = srcBottomH;
-    
-    // 목표 크기가 모서리보다 작으면 비율에 맞게 축소
-    // 하지만 모서리 합이 목표 크기를 넘지 않도록 조정
-    if (dstLeftW + dstRightW > width) {
-        float scale = static_cast<float>(width) / static_cast<float>(dstLeftW + dstRightW);
-        dstLeftW = static_cast<int>(dstLeftW * scale);
-        dstRightW = static_cast<int>(dstRightW * scale);
-        // 최소값 보장 (최소 1픽셀)
-        if (dstLeftW < 1) dstLeftW = 1;
-        if (dstRightW < 1) dstRightW = 1;
-    }
-    
-    if (dstTopH + dstBottomH > height) {
-        float scale = static_cast<float>(height) / static_cast<float>(dstTopH + dstBottomH);
-        dstTopH = static_cast<int>(dstTopH * scale);
-        dstBottomH = static_cast<int>(dstBottomH * scale);
-        // 최소값 보장 (최소 1픽셀)
-        if (dstTopH < 1) dstTopH = 1;
-        if (dstBottomH < 1) dstBottomH = 1;
-    }
-    
-    int dstCenterW = width - dstLeftW - dstRightW;  // 중앙 너비: 남은 공간
-    int dstCenterH = height - dstTopH - dstBottomH; // 중앙 높이: 남은 공간
-    
-    // 중앙 영역이 음수가 되지 않도록 조정
-    if (dstCenterW < 0) {
-        dstCenterW = 0;
-        // 모서리 크기 재조정
-        dstLeftW = width / 2;
-        dstRightW = width - dstLeftW;
-    }
-    if (dstCenterH < 0) {
-        dstCenterH = 0;
-        // 모서리 크기 재조정
-        dstTopH = height / 2;
-        dstBottomH = height - dstTopH;
-    }
-    
-    SDL_Rect dstRects[9] = {
-        {0, 0, dstLeftW, dstTopH},                                    // 좌상: 원본 크기
-        {dstLeftW, 0, dstCenterW, dstTopH},                         // 상중: 너비만 늘림
-        {dstLeftW + dstCenterW, 0, dstRightW, dstTopH},              // 우상: 원본 크기
-        {0, dstTopH, dstLeftW, dstCenterH},                         // 좌중: 높이만 늘림
-        {dstLeftW, dstTopH, dstCenterW, dstCenterH},                // 중앙: 양방향 늘림
-        {dstLeftW + dstCenterW, dstTopH, dstRightW, dstCenterH},    // 우중: 높이만 늘림
-        {0, dstTopH + dstCenterH, dstLeftW, dstBottomH},             // 좌하: 원본 크기
-        {dstLeftW, dstTopH + dstCenterH, dstCenterW, dstBottomH},   // 하중: 너비만 늘림
-        {dstLeftW + dstCenterW, dstTopH + dstCenterH, dstRightW, dstBottomH} // 우하: 원본 크기
-    };
-    
     // 원본 텍스처의 블렌딩 모드 저장 및 설정 (투명도 유지)
     SDL_BlendMode oldBlendMode;
     SDL_GetTextureBlendMode(sourceTexture, &oldBlendMode);
     SDL_SetTextureBlendMode(sourceTexture, SDL_BLENDMODE_BLEND);
     
-    // 9개 영역 렌더링 (원본 텍스처에서 직접)
-    int renderedCount = 0;
-    for (int i = 0; i < 9; i++) {
+    for (int i = 0; i < sliceCount; i++) {
         if (srcRects[i].w > 0 && srcRects[i].h > 0 && 
             dstRects[i].w > 0 && dstRects[i].h > 0) {
             SDL_RenderCopy(renderer, sourceTexture, &srcRects[i], &dstRects[i]);
-            renderedCount++;
         }
     }
     
-    // 원본 텍스처의 블렌딩 모드 복원
+    // 원본 텍스처의 블렌딩 모드 및 렌더 타겟 복원
     SDL_SetTextureBlendMode(sourceTexture, oldBlendMode);
-    Log::info("[ResourceManager] Rendered ", renderedCount, " patches");
-    
-    // 렌더 타겟 복원
     SDL_SetRenderTarget(renderer, oldTarget);
     
     return dstTexture;
 }
 
-SDL_Texture* ResourceManager::createThreePatchTexture(SDL_Texture* sourceTexture, int width, int height) {
-    if (!sourceTexture || !renderer || width <= 0 || height <= 0) {
+SDL_Texture* ResourceManager::acquirePatchTexture(const std::string& imageName, int width, int height,
+                                                  PatchMode mode, std::string& outTextureId) {
+    outTextureId.clear();
+    if (mode == PatchMode::None || width <= 0 || height <= 0) {
         return nullptr;
     }
 
-    int srcW, srcH;
-    SDL_QueryTexture(sourceTexture, nullptr, nullptr, &srcW, &srcH);
-    if (srcW <= 0 || srcH <= 0) {
-        return nullptr;
+    // (원본 이미지, 크기, 모드)가 같으면 구운 텍스처 하나를 참조 카운트로 공유
+    std::string key = std::string(mode == PatchMode::Nine ? "patch9:" : "patch3:") +
+                      std::to_string(width) + "x" + std::to_string(height) + ":" + imageName;
+    auto it = textures.find(key);
+    if (it != textures.end()) {
+        outTextureId = registerTexture(key, it->second);  // 참조 카운트 증가
+        patchCacheHits++;
+        return it->second;
     }
 
-    // 가로 3등분: 좌(1/3), 중(1/3), 우(1/3)
-    int thirdW = srcW / 3;
-    int srcLeftW = thirdW;
-    int srcCenterW = thirdW;
-    int srcRightW = srcW - thirdW * 2;
-
-    Log::info("[ResourceManager] Creating three-patch (horizontal): src=", srcW, "x", srcH,
-              ", dst=", width, "x", height);
-
-    SDL_Texture* dstTexture = SDL_CreateTexture(renderer,
-                                                SDL_PIXELFORMAT_RGBA32,
-                                                SDL_TEXTUREACCESS_TARGET,
-                                                width, height);
-    if (!dstTexture) {
-        Log::error("[ResourceManager] Failed to create three-patch destination texture");
+    TextureRegion source = getTextureRegion(imageName);
+    SDL_Texture* texture = createPatchTexture(source, width, height, mode);
+    if (!texture) {
         return nullptr;
     }
+    patchCacheMisses++;
+    outTextureId = registerTexture(key, texture);
+    return texture;
+}
 
-    SDL_SetTextureBlendMode(dstTexture, SDL_BLENDMODE_BLEND);
-
-    SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-    SDL_SetRenderTarget(renderer, dstTexture);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-    SDL_RenderClear(renderer);
-
-    // 좌/우: 원본 비율 유지하며 높이(height)에 맞춰 확대·축소. 가운데만 가변으로 나머지 너비 채움.
-    float scaleH = static_cast<float>(height) / static_cast<float>(srcH);
-    int dstLeftW = static_cast<int>(srcLeftW * scaleH + 0.5f);
-    int dstRightW = static_cast<int>(srcRightW * scaleH + 0.5f);
-    if (dstLeftW < 1) dstLeftW = 1;
-    if (dstRightW < 1) dstRightW = 1;
-    if (dstLeftW + dstRightW > width) {
-        float scaleW = static_cast<float>(width) / static_cast<float>(dstLeftW + dstRightW);
-        dstLeftW = static_cast<int>(dstLeftW * scaleW + 0.5f);
-        dstRightW = static_cast<int>(dstRightW * scaleW + 0.5f);
-        if (dstLeftW < 1) dstLeftW = 1;
-        if (dstRightW < 1) dstRightW = 1;
-    }
-    int dstCenterW = width - dstLeftW - dstRightW;
-    if (dstCenterW < 0) dstCenterW = 0;
-
-    SDL_Rect srcRects[3] = {
-        {0, 0, srcLeftW, srcH},
-        {srcLeftW, 0, srcCenterW, srcH},
-        {srcLeftW + srcCenterW, 0, srcRightW, srcH}
-    };
-    SDL_Rect dstRects[3] = {
-        {0, 0, dstLeftW, height},
-        {dstLeftW, 0, dstCenterW, height},
-        {dstLeftW + dstCenterW, 0, dstRightW, height}
-    };
-
-    SDL_BlendMode oldBlendMode;
-    SDL_GetTextureBlendMode(sourceTexture, &oldBlendMode);
-    SDL_SetTextureBlendMode(sourceTexture, SDL_BLENDMODE_BLEND);
-
-    for (int i = 0; i < 3; i++) {
-        if (srcRects[i].w > 0 && srcRects[i].h > 0 &&
-            dstRects[i].w > 0 && dstRects[i].h > 0) {
-            SDL_RenderCopy(renderer, sourceTexture, &srcRects[i], &dstRects[i]);
-        }
-    }
-
-    SDL_SetTextureBlendMode(sourceTexture, oldBlendMode);
-    SDL_SetRenderTarget(renderer, oldTarget);
-    return dstTexture;
+void ResourceManager::shutdownWorkers() {
+    // 워커가 SDL_image/SDL_ttf를 쓰므로 SDL 종료 전에 정지 (남은 surface는 큐가 해제)
+    decodeQueue.reset();
+    textRasterQueue.reset();
+    pendingTextRefs.clear();
 }
 
 void ResourceManager::cleanup() {
+    // 디코드/텍스트 워커 먼저 정지
+    shutdownWorkers();
+    for (auto& surfacePair : surfaces) {
+        SDL_FreeSurface(surfacePair.second);
+    }
+    surfaces.clear();
+    textSurfaceKeys.clear();
+    surfaceBytes = 0;
+    for (auto& surfacePair : decodedAtlasSurfaces) {
+        if (surfacePair.second) SDL_FreeSurface(surfacePair.second);
+    }
+    decodedAtlasSurfaces.clear();
+
     // 모든 텍스처 정리
     for (auto& texturePair : textures) {
         SDL_DestroyTexture(texturePair.second);
@@ -503,8 +1223,21 @@ void ResourceManager::cleanup() {
     textures.clear();
     imagePaths.clear();
     textureRefCount.clear();
+    idleTextLru.clear();
+    idleTextEntries.clear();
+    idleTextBytes = 0;
+    residents.clear();
+    residentLru.clear();
+    sceneRefCounts.clear();
+    sceneReferences.clear();
+    residentBytes = 0;
+    dynamicBytes = 0;
+    atlases.clear();
+    atlasGroups.clear();
+    imageAtlasGroup.clear();
     
     scenes.clear();
     jsonTexts.clear();
+    animationClips.clear();
     texts.clear();
 }
\ No newline at end of file
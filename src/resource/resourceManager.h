@@ -5,7 +5,41 @@
 #include <string>
 #include <map>
 #include <unordered_map>
+#include <memory>
+#include <vector>
+#include <list>
+#include <unordered_set>
 #include <nlohmann/json.hpp>
+#include "TextureAtlas.h"
+#include "ImageDecodeQueue.h"
+#include "../rendering/PatchSlices.h"
+#include "../rendering/TextRasterQueue.h"
+
+class TextRenderer;
+class AnimationClip;
+
+// 텍스처 메모리 현황 (바이트 = 가로 x 세로 x 픽셀당 바이트, GPU 쪽 실제 사용량의 근사치)
+struct TextureMemoryStats {
+    size_t residentBytes = 0;  // 이미지 텍스처 + 아틀라스 페이지 (축출 대상)
+    size_t dynamicBytes = 0;   // registerTexture로 등록된 동적 텍스처 (참조 카운트로 해제, 축출 안 함)
+    size_t budgetBytes = 0;    // 0이면 무제한
+    int residentCount = 0;     // 올라와 있는 이미지/아틀라스 그룹 수
+    int evictionCount = 0;     // 누적 축출 횟수
+    int patchCacheHits = 0;    // acquirePatchTexture가 기존 패치 텍스처를 공유한 횟수
+    int patchCacheMisses = 0;  // 새로 구운 횟수
+    size_t textCacheBytes = 0;  // 참조가 0인 채로 보관 중인 텍스트 텍스처 (dynamicBytes에 포함)
+    size_t textCacheBudgetBytes = 0;
+    int textCacheHits = 0;      // acquireTextTexture가 기존 텍스트 텍스처를 재사용한 횟수
+    int textCacheMisses = 0;    // 새로 래스터화한 횟수
+    int textRasterPending = 0;  // 워커에서 래스터화/업로드 대기 중인 텍스트 수
+    size_t surfaceBytes = 0;    // getSurface용으로 보관 중인 CPU 쪽 surface (텍스처 예산과 별도)
+};
+
+// resource.json의 "font" 리소스 (TextRenderer가 이름으로 등록)
+struct FontResource {
+    std::string path;
+    std::vector<int> preloadSizes;  // 씬 생성 시 미리 열어 둘 크기
+};
 
 class ResourceManager {
 private:
@@ -15,23 +49,128 @@ private:
     std::map<std::string, int> textureRefCount;     // 참조 카운팅 (동적 텍스처용)
     std::unordered_map<std::string, nlohmann::json> scenes;  // 씬 데이터 (중요하므로 즉시 파싱)
     std::map<std::string, std::string> jsonTexts;   // JSON 파일 텍스트 (lazy loading용)
+    std::unordered_map<std::string, std::shared_ptr<const AnimationClip>> animationClips;  // 컴파일된 애니메이션 JSON
     std::map<std::string, std::string> texts;       // 일반 텍스트 파일
+    std::map<std::string, FontResource> fonts;      // 폰트 이름 → 경로/미리 열 크기
     std::string initialScene;                        // 초기 씬 이름
     std::string resourceFolder;                     // 리소스 기본 폴더
     int dynamicTextureIdCounter = 0;                 // 동적 텍스처 ID 생성용 카운터
 
+    // 아틀라스 그룹 (resource.json의 "atlases"). 그룹 이미지가 처음 요청될 때 그룹 전체를 패킹
+    std::map<std::string, std::vector<std::string>> atlasGroups;   // 그룹 이름 → 이미지 이름들
+    std::map<std::string, std::string> imageAtlasGroup;             // 이미지 이름 → 그룹 이름
+    std::map<std::string, std::unique_ptr<TextureAtlas>> atlases;   // 패킹 완료된 그룹
+
+    TextureAtlas* getOrBuildAtlas(const std::string& groupName);
+
+    // 비동기 디코딩 (prefetch). 첫 요청 시 워커 생성
+    std::unique_ptr<ImageDecodeQueue> decodeQueue;
+    int decodeThreadCount = 2;                                          // 0이면 prefetch 비활성
+    std::unordered_map<std::string, SDL_Surface*> decodedAtlasSurfaces;  // 그룹 전체가 디코딩될 때까지 보관
+
+    SDL_Surface* acquireSurface(const std::string& imageName);  // 디코드 결과가 있으면 사용, 없으면 동기 디코딩
+    SDL_Texture* uploadTexture(const std::string& imageName, SDL_Surface* surface);  // surface 해제 포함
+    bool isAtlasGroupDecoded(const std::string& groupName) const;
+    void collectSceneImages(const nlohmann::json& node, std::vector<std::string>& outImages);
+    bool collectSceneImageNames(const std::string& sceneName, std::vector<std::string>& outImages);
+
+    // 상주(residency) 관리: 이미지 텍스처와 아틀라스 그룹("atlas:<그룹>")을 키로 추적
+    // 씬 참조가 0인 항목만 LRU 순서로 축출하고, 다음 getTexture에서 다시 로드
+    struct Resident {
+        size_t bytes = 0;
+        std::list<std::string>::iterator lruIt;
+    };
+    std::unordered_map<std::string, Resident> residents;
+    std::list<std::string> residentLru;                 // 앞쪽이 가장 오래전에 쓰인 항목
+    std::unordered_map<std::string, int> sceneRefCounts;  // 키 → 참조 중인 씬 수
+    std::unordered_map<std::string, std::unordered_set<std::string>> sceneReferences;  // 씬 → 참조 키
+    std::string activeScene;
+    size_t residentBytes = 0;
+    size_t dynamicBytes = 0;
+    size_t textureBudgetBytes = 0;
+    int evictionCount = 0;
+    int patchCacheHits = 0;
+    int patchCacheMisses = 0;
+
+    // 텍스트 텍스처 캐시 ("text:" 키): 참조가 0이 돼도 바로 지우지 않고 LRU로 보관했다가 예산을 넘으면 오래된 것부터 해제
+    std::list<std::string> idleTextLru;  // 앞쪽이 가장 오래전에 놓인 항목
+    std::unordered_map<std::string, std::list<std::string>::iterator> idleTextEntries;
+    size_t idleTextBytes = 0;
+    size_t textCacheBudgetBytes = 16 * 1024 * 1024;
+    int textCacheHits = 0;
+    int textCacheMisses = 0;
+
+    // 비동기 텍스트 래스터화 (requestTextTexture). 첫 요청 시 워커 생성
+    std::unique_ptr<TextRasterQueue> textRasterQueue;
+    int textRasterThreadCount = 1;                          // 0이면 동기 (acquireTextTexture와 같음)
+    // 업로드 전인 키 → 요청한 참조 수 + 워커가 실패했을 때 메인 스레드에서 다시 그릴 요청 내용
+    struct PendingText {
+        int refs = 0;
+        TextRenderer* textRenderer = nullptr;
+        std::string fontName;
+        TextRasterRequest request;
+    };
+    std::unordered_map<std::string, PendingText> pendingTextRefs;
+
+    // CPU 쪽 surface 사본 (getSurface). 이미지는 처음 요청될 때 디코딩, 텍스트는 keepSurface로 요청된 키만 보관.
+    // 텍스처와 함께 해제됨 (이미지 축출, 텍스트 텍스처 삭제)
+    std::unordered_map<std::string, SDL_Surface*> surfaces;
+    std::unordered_set<std::string> textSurfaceKeys;  // surface를 보관할 텍스트 키
+    size_t surfaceBytes = 0;
+    void storeSurface(const std::string& key, SDL_Surface* surface);
+    void releaseSurface(const std::string& key);
+
+    std::string residencyKey(const std::string& imageName) const;  // 아틀라스 그룹 이미지면 그룹 키
+    void addSceneReference(const std::string& sceneName, const std::string& key);
+    void releaseScene(const std::string& sceneName);
+    void trackResident(const std::string& key, size_t bytes);
+    void touchResident(const std::string& key);
+    void evictResident(const std::string& key);
+    void enforceTextureBudget();
+    void trimTextCache(size_t maxIdleBytes);  // 보관 중인 텍스트 텍스처를 maxIdleBytes 이하로
+    void destroyDynamicTexture(const std::string& textureName);
+    void parkIdleText(const std::string& key, SDL_Texture* texture);  // 참조 0인 텍스트 텍스처를 유휴 LRU로
+    std::string makeTextKey(const std::string& text, int fontSize, SDL_Color color,
+                            int wrapWidth, int maxHeight, const std::string& fontName) const;
+    void uploadTextSurface(const std::string& key, SDL_Surface* surface);  // surface 해제 포함
+    static size_t getTextureBytes(SDL_Texture* texture);
+
 public:
     ResourceManager(SDL_Renderer* sdlRenderer);
     ~ResourceManager();
 
     void loadResources(const std::string& resourceFilePath);
-    SDL_Texture* getTexture(const std::string& textureName);
+    SDL_Texture* getTexture(const std::string& textureName);  // 항상 이미지 전체 크기의 단독 텍스처
+    // CPU 합성용 RGBA32 surface (ImageRenderer). 이미지 이름이면 처음 호출 시 디코딩해 보관,
+    // 텍스트 텍스처 ID면 keepSurface로 만든 경우에만. GPU 읽기 없이 텍스처와 같은 픽셀을 얻음. 소유권은 ResourceManager
+    SDL_Surface* getSurface(const std::string& name);
+    // 텍스처 + 영역. 아틀라스 그룹 이미지면 페이지 텍스처의 일부, 아니면 getTexture 결과 전체
+    TextureRegion getTextureRegion(const std::string& textureName);
     nlohmann::json getSceneJson(const std::string& resourceName);
     nlohmann::json getMapJson(const std::string& mapName);  // 요청 시 파싱
     nlohmann::json getJson(const std::string& jsonName);    // 범용 JSON 로더
     nlohmann::json getAnimationJson(const std::string& animName);  // 애니메이션 JSON 로더 (배열 형태)
+    // 애니메이션 JSON을 처음 요청 시 한 번 파싱/컴파일해 캐시한 불변 클립 (없거나 잘못된 JSON이면 nullptr)
+    std::shared_ptr<const AnimationClip> getAnimationClip(const std::string& animName);
     std::string getText(const std::string& name);
     std::string getInitialScene() const { return initialScene; }  // 초기 씬 이름 반환
+    const std::map<std::string, FontResource>& getFonts() const { return fonts; }
+
+    // 워커 스레드 디코딩 + 메인 스레드 업로드
+    void setDecodeThreadCount(int count) { decodeThreadCount = count; }  // 첫 prefetch 전에 설정
+    void prefetchImage(const std::string& imageName);  // 아틀라스 그룹 이미지면 그룹 전체를 요청
+    // 씬 ui 배열(include_layout 포함)이 참조하는 이미지를 모두 디코드 요청. 요청한 이미지 수 반환
+    int prefetchScene(const std::string& sceneName);
+    // 디코딩 끝난 이미지와 래스터화 끝난 텍스트를 budgetMs 안에서 텍스처로 업로드 (매 프레임 메인 스레드에서 호출, 최소 1개는 처리)
+    void processUploads(float budgetMs);
+    bool hasPendingPrefetch() const;  // 디코딩/업로드 대기 중인 이미지가 있는지
+
+    // 텍스처 메모리 예산. 넘으면 현재 씬이 참조하지 않는 이미지/아틀라스를 오래된 순으로 해제
+    void setTextureBudget(size_t bytes);  // 0이면 무제한
+    // 씬 전환 시 Scene이 호출: 새 씬이 참조하는 이미지를 잡고, 이전 씬 참조를 놓은 뒤 예산 적용
+    void setActiveScene(const std::string& sceneName);
+    size_t getTextureBytes() const { return residentBytes + dynamicBytes; }
+    TextureMemoryStats getTextureMemoryStats() const;
     
     // 텍스처 등록/해제 (동적 텍스처용 - 텍스트 등)
     // 이름을 지정한 경우: 지정한 이름이 ID가 되어 반환됨
@@ -41,12 +180,41 @@ public:
     // 이름 없이 등록: 자동으로 고유 ID 생성하여 반환 (권장)
     std::string registerTexture(SDL_Texture* texture);
     void unregisterTexture(const std::string& textureId);
+
+    // 텍스트 텍스처를 (텍스트, 폰트, 크기, 색, wrapWidth, maxHeight) 키로 공유.
+    // 같은 내용이면 래스터화 없이 참조 카운트만 올리고, 반납(unregisterTexture) 후에도 캐시 예산 안에서 보관
+    // keepSurface면 getSurface(outTextureId)로 CPU 사본도 얻을 수 있음 (이미지에 구워 넣는 버튼 텍스트 등)
+    SDL_Texture* acquireTextTexture(TextRenderer* textRenderer, const std::string& text, int fontSize, SDL_Color color,
+                                    int wrapWidth, int maxHeight, const std::string& fontName, std::string& outTextureId,
+                                    bool keepSurface = false);
+    void setTextCacheBudget(size_t bytes);  // 0이면 보관하지 않음 (반납 즉시 해제)
+
+    // 비동기 버전: 캐시에 있으면 바로 반환, 없으면 워커에 래스터화를 맡기고 nullptr.
+    // 어느 쪽이든 outTextureId에 참조를 하나 잡으므로 반납은 unregisterTexture (업로드 전에 반납하면 요청 취소).
+    // 업로드는 processUploads에서 예산 안에서 처리되고, 그때까지 위젯은 이전 텍스처/빈 자리를 보여 주면 됨
+    SDL_Texture* requestTextTexture(TextRenderer* textRenderer, const std::string& text, int fontSize, SDL_Color color,
+                                    int wrapWidth, int maxHeight, const std::string& fontName, std::string& outTextureId,
+                                    bool keepSurface = false);
+    SDL_Texture* findTextTexture(const std::string& textureId) const;  // 업로드가 끝났으면 텍스처, 아니면 nullptr
+    // 아직 래스터화/업로드를 기다리는 중인지. findTextTexture도 nullptr이고 이것도 false면 그릴 수 없는 텍스트 (대기 중단)
+    bool isTextPending(const std::string& textureId) const { return pendingTextRefs.count(textureId) > 0; }
+    void setTextRasterThreadCount(int count) { textRasterThreadCount = count; }  // 첫 요청 전에 설정
+    // 디코드/텍스트 워커 정지 (남은 결과 해제). SDL/SDL_ttf 종료 전에 main에서 호출, cleanup()에서도 호출
+    void shutdownWorkers();
     
     // 9패치 텍스처 생성 (원본 텍스처를 9등분해서 목적지 크기로 확장)
     SDL_Texture* createNinePatchTexture(SDL_Texture* sourceTexture, int width, int height);
+    SDL_Texture* createNinePatchTexture(const TextureRegion& source, int width, int height);
 
     // 3패치 텍스처 생성 (원본을 가로 3등분, 좌/우는 고정·중앙만 가로로 늘림, 세로는 전체 늘림)
     SDL_Texture* createThreePatchTexture(SDL_Texture* sourceTexture, int width, int height);
+    SDL_Texture* createThreePatchTexture(const TextureRegion& source, int width, int height);
+    SDL_Texture* createPatchTexture(const TextureRegion& source, int width, int height, PatchMode mode);
+
+    // 공유 패치 텍스처: (이미지 이름, 크기, 모드)가 같으면 구운 텍스처 하나를 참조 카운트로 공유
+    // outTextureId로 등록되며, 다 쓰면 unregisterTexture(outTextureId)로 반환 (마지막 참조에서 삭제)
+    SDL_Texture* acquirePatchTexture(const std::string& imageName, int width, int height,
+                                     PatchMode mode, std::string& outTextureId);
     
     void cleanup();
 };
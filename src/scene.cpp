@@ -1,5 +1,7 @@
 #include "scene.h"
 #include "utils/logger.h"
+#include "utils/Profiler.h"
+#include "utils/FrameArena.h"
 #include <nlohmann/json.hpp>
 #include <memory>
 
@@ -15,10 +17,21 @@ Scene::Scene(SDL_Renderer* sdlRenderer, ResourceManager* resourceMgr)
         uiManager.setResourceManager(resourceManager);
         animationManager.setUiManager(&uiManager);
         textRenderer.init("data/Jalnan2.otf");
+        // resource.json "font" 리소스 등록 ("default"면 기본 폰트 교체) 및 지정 크기 미리 열기
+        for (const auto& fontPair : resourceManager->getFonts()) {
+            textRenderer.registerFont(fontPair.first, fontPair.second.path);
+            if (!fontPair.second.preloadSizes.empty()) {
+                int opened = textRenderer.preloadFont(fontPair.first, fontPair.second.preloadSizes);
+                Log::info("[Scene] Preloaded font '", fontPair.first, "' (", opened, " sizes)");
+            }
+        }
         
         scriptManager.setLoadScene([this](const std::string& name) {
             requestSceneChange(name);  // 즉시 전환하지 않고 요청만 저장
         });
+        scriptManager.setQuit([this]() {
+            requestQuit();
+        });
         scriptManager.setUiManager(&uiManager);
         scriptManager.setWidgetManager(&widgetManager);
         scriptManager.setAnimationManager(&animationManager);
@@ -55,6 +68,9 @@ void Scene::loadScene(const std::string& sceneName) {
         
         // 5. Texture 제거는 위젯 소멸자에서 처리됨
         // (ResourceManager 참조 카운팅으로 자동 해제)
+
+        // 6. 이미지 상주 참조를 새 씬으로 옮김 (이전 씬만 쓰던 이미지는 예산 초과 시 해제 대상)
+        resourceManager->setActiveScene(sceneName);
     
         // ui 배열을 순회하며, include_layout 타입이 있으면 그 자리에서 레이아웃 ui를 끼워 넣은 리스트 구성
         json uiList = json::array();
@@ -121,12 +137,26 @@ void Scene::loadScene(const std::string& sceneName) {
 
 void Scene::requestSceneChange(const std::string& sceneName) {
     // 즉시 전환하지 않고 다음 프레임에 전환하도록 저장
+    // 그동안 워커에서 새 씬 이미지를 디코딩해 두어 loadScene에서 멈추지 않게 함
     pendingSceneName = sceneName;
-    Log::info("[Scene] Scene change requested: ", sceneName, " (will load next frame)");
+    pendingSceneWaitMs = 0.0f;
+    int imageCount = resourceManager->prefetchScene(sceneName);
+    Log::info("[Scene] Scene change requested: ", sceneName, " (will load next frame, prefetching ",
+              imageCount, " images)");
 }
 
-void Scene::processPendingSceneChange() {
+void Scene::requestQuit() {
+    quitRequested = true;
+    Log::info("[Scene] Quit requested");
+}
+
+void Scene::processPendingSceneChange(float deltaTime) {
     if (!pendingSceneName.empty()) {
+        // 디코딩이 남아 있으면 한도 안에서 기다림 (그동안 메인 루프가 업로드 진행)
+        if (resourceManager->hasPendingPrefetch() && pendingSceneWaitMs < prefetchWaitLimitMs) {
+            pendingSceneWaitMs += deltaTime;
+            return;
+        }
         std::string sceneToLoad = pendingSceneName;
         pendingSceneName = "";  // 초기화 (재귀 호출 방지)
         Log::info("[Scene] Processing pending scene change: ", sceneToLoad);
@@ -142,7 +172,9 @@ int mouseDownX = 0, mouseDownY = 0;
 // SDL_USER 이벤트 타입 등록 (mouse_click용)
 Uint32 MOUSE_CLICK_EVENT = 0;
 
-void Scene::keyPressed(const std::vector<SDL_Event>& events) {
+void Scene::keyPressed(const std::pmr::vector<SDL_Event>& events) {
+    PROFILE_SCOPE("Scene::keyPressed");
+
     // SDL_USER 이벤트 타입 등록 (한 번만)
     if (MOUSE_CLICK_EVENT == 0) {
         MOUSE_CLICK_EVENT = SDL_RegisterEvents(1);
@@ -151,8 +183,9 @@ void Scene::keyPressed(const std::vector<SDL_Event>& events) {
         }
     }
     
-    // 1단계: click 감지 및 SDL_USER 이벤트 생성
-    std::vector<SDL_Event> eventsForWidget;
+    // 1단계: click 감지 및 SDL_USER 이벤트 생성 (목록과 좌표는 프레임 아레나에 두므로 해제하지 않음)
+    std::pmr::vector<SDL_Event> eventsForWidget(FrameArena::resource());
+    eventsForWidget.reserve(events.size() + 1);
     
     for (const auto& event : events) {
         eventsForWidget.push_back(event);
@@ -173,8 +206,8 @@ void Scene::keyPressed(const std::vector<SDL_Event>& events) {
                 clickEvent.user.timestamp = event.button.timestamp;
                 clickEvent.user.windowID = event.button.windowID;
                 clickEvent.user.code = event.button.button;  // 버튼 번호
-                // 좌표를 data1, data2에 저장 (포인터로)
-                int* coords = new int[2];
+                // 좌표를 data1, data2에 저장 (포인터로, 다음 프레임 시작까지 유효)
+                int* coords = FrameArena::allocateArray<int>(2);
                 coords[0] = x;
                 coords[1] = y;
                 clickEvent.user.data1 = coords;
@@ -209,10 +242,6 @@ void Scene::keyPressed(const std::vector<SDL_Event>& events) {
         
         // 마우스/키 이벤트가 아니면 Lua로 전달하지 않음
         if (!isMouseEvent && !isKeyEvent) {
-            // SDL_USER 이벤트의 메모리 해제
-            if (event.type == MOUSE_CLICK_EVENT && event.user.data1) {
-                delete[] static_cast<int*>(event.user.data1);
-            }
             continue;
         }
         
@@ -224,10 +253,6 @@ void Scene::keyPressed(const std::vector<SDL_Event>& events) {
             // Ctrl/Cmd/Alt 조합이 있으면 단축키로 전달
             if (!(mod & (KMOD_CTRL | KMOD_GUI | KMOD_ALT))) {
                 // 일반 키는 위젯이 처리했을 수 있으므로 제외
-                // SDL_USER 이벤트의 메모리 해제
-                if (event.type == MOUSE_CLICK_EVENT && event.user.data1) {
-                    delete[] static_cast<int*>(event.user.data1);
-                }
                 continue;
             }
         }
@@ -239,18 +264,35 @@ void Scene::keyPressed(const std::vector<SDL_Event>& events) {
 
 void Scene::update(float deltaTime) {
     // 대기 중인 씬 전환 처리 (다른 업데이트보다 먼저)
-    processPendingSceneChange();
-    
-    widgetManager.update(deltaTime);  // 위젯 업데이트
-    animationManager.update(deltaTime);
-    scriptManager.call("update");
+    {
+        PROFILE_SCOPE("Scene::processPendingSceneChange");
+        processPendingSceneChange(deltaTime);
+    }
+    {
+        PROFILE_SCOPE("WidgetManager::update");
+        widgetManager.update(deltaTime);  // 위젯 업데이트
+    }
+    {
+        PROFILE_SCOPE("AnimationManager::update");
+        animationManager.update(deltaTime);
+    }
+    {
+        PROFILE_SCOPE("Lua update");
+        scriptManager.call("update");
+    }
 }
 
 
 void Scene::render() {
     // UIElement 렌더링 (UiManager에서 처리, 자식은 부모 영역으로 클리핑됨)
-    uiManager.render(renderer);
+    {
+        PROFILE_SCOPE("UiManager::render");
+        uiManager.render(renderer);
+    }
     
     // 위젯 특수 렌더링 (필요시만)
-    widgetManager.render(renderer);
+    {
+        PROFILE_SCOPE("WidgetManager::render");
+        widgetManager.render(renderer);
+    }
 }
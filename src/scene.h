@@ -4,6 +4,7 @@
 #include "utils/sdl_includes.h"
 #include <string>
 #include <vector>
+#include <memory_resource>
 #include <utility>
 #include "resource/resourceManager.h"
 #include "scripting/scriptManager.h"
@@ -29,18 +30,25 @@ private:
     UserDataManager userDataManager;
     
     std::string pendingSceneName;  // 다음 프레임에 로드할 씬 이름
+    float pendingSceneWaitMs = 0.0f;   // 전환 요청 후 prefetch를 기다린 시간
+    float prefetchWaitLimitMs = 250.0f;  // prefetch 완료를 기다리는 최대 시간 (0이면 바로 전환)
+    bool quitRequested = false;    // Lua Scene.quit() 호출 여부 (메인 루프가 확인 후 종료)
 
     // std::vector<std::pair<SDL_Texture*, SDL_Rect>> drawList;
     
-    void processPendingSceneChange();  // 대기 중인 씬 전환 처리
+    void processPendingSceneChange(float deltaTime);  // 대기 중인 씬 전환 처리 (prefetch 완료 또는 대기 한도 후)
 
 public:
     Scene(SDL_Renderer* sdlRenderer, ResourceManager* resourceMgr);
     void loadScene(const std::string& sceneName);
-    void requestSceneChange(const std::string& sceneName);  // 씬 전환 요청 (다음 프레임에 처리)
-    void keyPressed(const std::vector<SDL_Event>& events);
+    void requestSceneChange(const std::string& sceneName);  // 씬 전환 요청 (이미지 prefetch 후 다음 프레임 이후에 처리)
+    void setPrefetchWaitLimit(float ms) { prefetchWaitLimitMs = ms; }
+    void requestQuit();  // 종료 요청 (현재 프레임 종료 후 메인 루프 탈출)
+    bool isQuitRequested() const { return quitRequested; }
+    void keyPressed(const std::pmr::vector<SDL_Event>& events);
     void update(float deltaTime);
     void render();
+    const SpriteBatch::Stats& getRenderStats() const { return uiManager.getRenderStats(); }
 };
 
 #endif
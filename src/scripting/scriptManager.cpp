@@ -14,11 +14,13 @@
 #include "../widgets/dialog/StandardDialogWidget.h"
 #include "../widgets/dialog/CustomDialogWidget.h"
 #include "../widgets/dialog/ToastWidget.h"
+#include "../widgets/effect/ParticleWidget.h"
 #include "../animation/Animator.h"
 #include "../data/userDataManager.h"
 #include "../resource/resourceManager.h"
 #include "../ads/StubAdProvider.h"
 #include "../utils/logger.h"
+#include "../utils/Profiler.h"
 #include <nlohmann/json.hpp>
 #include <chrono>
 #include <ctime>
@@ -62,8 +64,61 @@ void ScriptManager::setCommonApi() {
         this->loadScene(name);
     });
 
+    uiTable.set_function("quit", [this]() {
+        if (quitFn) {
+            quitFn();
+        } else {
+            Log::error("Quit function not set!");
+        }
+    });
+
+    // 씬 이미지를 미리 디코딩 (전환 직전이 아니라 여유 있을 때 호출). 요청한 이미지 수 반환
+    uiTable.set_function("prefetch", [this](const std::string& name) {
+        if (!resourceManager) {
+            Log::error("ResourceManager not set!");
+            return 0;
+        }
+        return resourceManager->prefetchScene(name);
+    });
+
     lua["Scene"] = uiTable;
 
+    // Profiler: 프레임 프로파일 트레이스 덤프
+    sol::table profilerTable = lua.create_table();
+    profilerTable.set_function("dump", [](const std::string& path) {
+        return Profiler::dumpChromeTrace(path);
+    });
+    profilerTable.set_function("setEnabled", [](bool enabled) {
+        Profiler::setEnabled(enabled);
+    });
+    profilerTable.set_function("lastFrameMs", []() {
+        return Profiler::getLastFrameMs();
+    });
+    lua["Profiler"] = profilerTable;
+
+    // Resource: 텍스처 메모리 현황 (setting.json의 texture_budget_mb 참고)
+    sol::table resourceTable = lua.create_table();
+    resourceTable.set_function("getTextureBytes", [this]() -> double {
+        return resourceManager ? static_cast<double>(resourceManager->getTextureBytes()) : 0.0;
+    });
+    resourceTable.set_function("getTextureStats", [this]() {
+        sol::table t = executor.getState().create_table();
+        if (!resourceManager) return t;
+        TextureMemoryStats stats = resourceManager->getTextureMemoryStats();
+        t["residentBytes"] = static_cast<double>(stats.residentBytes);
+        t["dynamicBytes"] = static_cast<double>(stats.dynamicBytes);
+        t["budgetBytes"] = static_cast<double>(stats.budgetBytes);
+        t["residentCount"] = stats.residentCount;
+        t["evictionCount"] = stats.evictionCount;
+        t["textCacheBytes"] = static_cast<double>(stats.textCacheBytes);
+        t["textCacheHits"] = stats.textCacheHits;
+        t["textCacheMisses"] = stats.textCacheMisses;
+        t["textRasterPending"] = stats.textRasterPending;
+        t["surfaceBytes"] = static_cast<double>(stats.surfaceBytes);
+        return t;
+    });
+    lua["Resource"] = resourceTable;
+
     // GlobalData: Lua에서 어디서든 접근 가능한 키-값 저장소
     sol::table globalTable = lua.create_table();
     globalTable.set_function("set", [this](const std::string& key, sol::object value) {
@@ -225,84 +280,134 @@ void ScriptManager::setUiManager(UiManager* ui) {
     sol::table uiTable = lua.create_table();
 
 
+    // 대상은 요소 이름(문자열) 또는 ui.getHandle()이 돌려준 핸들(정수) 모두 허용
+    auto resolve = [ui](const sol::object& target) -> ElementHandle {
+        if (target.get_type() == sol::type::string) {
+            return ui->findHandleByName(target.as<std::string>());
+        }
+        if (target.get_type() == sol::type::number) {
+            return ElementHandle::unpack(static_cast<uint64_t>(target.as<int64_t>()));
+        }
+        return ElementHandle{};
+    };
+
+    // 핸들 함수들 (이름 조회 없이 반복 접근, 요소가 제거되면 무효)
+    uiTable.set_function("getHandle", [ui](const std::string& name) {
+        return static_cast<int64_t>(ui->findHandleByName(name).pack());
+    });
+
+    uiTable.set_function("isValid", [ui, resolve](const sol::object& target) {
+        return ui->isValid(resolve(target));
+    });
+
+    uiTable.set_function("remove", [ui, resolve](const sol::object& target) {
+        return ui->removeUI(resolve(target));
+    });
+
+    // 직전 프레임 UI 렌더 통계 (draw call / 배치 / 쿼드 수)
+    uiTable.set_function("getRenderStats", [ui, this]() {
+        const SpriteBatch::Stats& stats = ui->getRenderStats();
+        sol::table t = executor.getState().create_table();
+        t["drawCalls"] = stats.drawCalls;
+        t["batches"] = stats.batches;
+        t["quads"] = stats.quads;
+        return t;
+    });
+
+
     // UI 함수들
-    uiTable.set_function("changeImage", [ui](const std::string& name, const std::string& image) {
-        ui->changeTexture(name, image);
+    uiTable.set_function("changeImage", [ui, resolve](const sol::object& target, const std::string& image) {
+        ui->changeTexture(resolve(target), image);
     });
 
 
     // Setter 함수들
-    uiTable.set_function("move", [ui](const std::string& name, int x, int y) {
-        ui->move(name, x, y);
+    uiTable.set_function("move", [ui, resolve](const sol::object& target, int x, int y) {
+        if (UIElement* e = ui->getElement(resolve(target))) {
+            e->rect.x += x;
+            e->rect.y += y;
+        }
     });
 
-    uiTable.set_function("resize", [ui](const std::string& name, int w, int h) {
-        ui->resize(name, w, h);
+    uiTable.set_function("resize", [ui, resolve](const sol::object& target, int w, int h) {
+        ui->resize(resolve(target), w, h);
     });
 
-    uiTable.set_function("setRect", [ui](const std::string& name, int x, int y, int w, int h) {
-        ui->setRect(name, x, y, w, h);
+    uiTable.set_function("setRect", [ui, resolve](const sol::object& target, int x, int y, int w, int h) {
+        if (UIElement* e = ui->getElement(resolve(target))) {
+            e->rect = {x, y, w, h};
+        }
     });
 
-    uiTable.set_function("moveto", [ui](const std::string& name, int x, int y) {
-        ui->moveTo(name, x, y);
+    uiTable.set_function("moveto", [ui, resolve](const sol::object& target, int x, int y) {
+        ui->moveTo(resolve(target), x, y);
     });
 
-    uiTable.set_function("setAlpha", [ui](const std::string& name, float alpha) {
-        ui->setAlpha(name, alpha);
+    uiTable.set_function("setAlpha", [ui, resolve](const sol::object& target, float alpha) {
+        ui->setAlpha(resolve(target), alpha);
     });
-    uiTable.set_function("setVisible", [ui](const std::string& name, bool visible) {
-        ui->setVisible(name, visible);
+    uiTable.set_function("setVisible", [ui, resolve](const sol::object& target, bool visible) {
+        ui->setVisible(resolve(target), visible);
     });
 
-    uiTable.set_function("setRotate", [ui](const std::string& name, float angle) {
-        ui->setRotate(name, angle);
+    uiTable.set_function("setRotate", [ui, resolve](const sol::object& target, float angle) {
+        ui->setRotate(resolve(target), angle);
     });
 
-    uiTable.set_function("setScale", [ui](const std::string& name, float scale) {
-        ui->setScale(name, scale);
+    uiTable.set_function("setScale", [ui, resolve](const sol::object& target, float scale) {
+        ui->setScale(resolve(target), scale);
     });
 
 
-    // Getter 함수들
-    uiTable.set_function("getAlpha", [ui](const std::string& name) {
-        return ui->getAlpha(name);
+    // Getter 함수들 (요소가 없으면 기존 이름 기반 getter와 같은 기본값)
+    uiTable.set_function("getAlpha", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->alpha : 1.0f;
     });
 
-    uiTable.set_function("getScale", [ui](const std::string& name) {
-        return ui->getScale(name);
+    uiTable.set_function("getScale", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->scale : 1.0f;
     });
 
-    uiTable.set_function("getRotate", [ui](const std::string& name) {
-        return ui->getRotate(name);
+    uiTable.set_function("getRotate", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rotation : 0.0f;
     });
 
-    uiTable.set_function("getLeft", [ui](const std::string& name) {
-        return ui->getLeft(name);
+    uiTable.set_function("getLeft", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rect.x : 0;
     });
 
-    uiTable.set_function("getTop", [ui](const std::string& name) {
-        return ui->getTop(name);
+    uiTable.set_function("getTop", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rect.y : 0;
     });
 
-    uiTable.set_function("getRight", [ui](const std::string& name) {
-        return ui->getRight(name);
+    uiTable.set_function("getRight", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rect.x + e->rect.w : 0;
     });
 
-    uiTable.set_function("getBottom", [ui](const std::string& name) {
-        return ui->getBottom(name);
+    uiTable.set_function("getBottom", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rect.y + e->rect.h : 0;
     });
 
-    uiTable.set_function("getWidth", [ui](const std::string& name) {
-        return ui->getWidth(name);
+    uiTable.set_function("getWidth", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rect.w : 0;
     });
 
-    uiTable.set_function("getHeight", [ui](const std::string& name) {
-        return ui->getHeight(name);
+    uiTable.set_function("getHeight", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->rect.h : 0;
     });
 
-    uiTable.set_function("isVisible", [ui](const std::string& name) {
-        return ui->isVisible(name);
+    uiTable.set_function("isVisible", [ui, resolve](const sol::object& target) {
+        const UIElement* e = ui->getElement(resolve(target));
+        return e ? e->visible : false;
     });
     
 
@@ -765,6 +870,36 @@ void ScriptManager::setWidgetManager(WidgetManager* wm) {
         }
     });
     
+    // 파티클 위젯 관련 (emitterIndex 생략 시 모든 이미터)
+    widgetTable.set_function("burstParticles", [wm](const std::string& name, int count, sol::optional<int> emitterIndex) {
+        if (!wm) return;
+        if (auto* widget = wm->getWidget(name)) {
+            if (auto* particleWidget = dynamic_cast<ParticleWidget*>(widget)) {
+                particleWidget->burst(count, emitterIndex.value_or(-1));
+            } else {
+                std::cerr << "[Lua] burstParticles: Widget is not a ParticleWidget: " << name << std::endl;
+            }
+        }
+    });
+
+    widgetTable.set_function("setParticlesEmitting", [wm](const std::string& name, bool emitting) {
+        if (!wm) return;
+        if (auto* widget = wm->getWidget(name)) {
+            if (auto* particleWidget = dynamic_cast<ParticleWidget*>(widget)) {
+                particleWidget->setEmitting(emitting);
+            }
+        }
+    });
+
+    widgetTable.set_function("clearParticles", [wm](const std::string& name) {
+        if (!wm) return;
+        if (auto* widget = wm->getWidget(name)) {
+            if (auto* particleWidget = dynamic_cast<ParticleWidget*>(widget)) {
+                particleWidget->clearParticles();
+            }
+        }
+    });
+    
     // 위젯 공통 메서드 (필요시 확장)
     widgetTable.set_function("getWidget", [wm](const std::string& name) {
         if (!wm) return false;
@@ -847,6 +982,17 @@ class AnimatorWrapper {
             return this;
         }
 
+        // flipbook(시트, 프레임 너비, 높이, 프레임 수, fps [, "loop"|"pingPong" [, 바퀴 수]])
+        AnimatorWrapper* flipbook(const std::string& sheetImage, int frameWidth, int frameHeight, int frameCount,
+                                  float fps, sol::optional<std::string> modeName, sol::optional<int> loops) {
+            Animator::FlipbookMode mode = Animator::FlipbookMode::Loop;
+            if (modeName && !Animator::flipbookModeFromName(*modeName, mode)) {
+                std::cerr << "[ERROR] Animator:flipbook(): Unknown mode '" << *modeName << "'" << std::endl;
+            }
+            impl->flipbook(sheetImage, frameWidth, frameHeight, frameCount, fps, mode, loops.value_or(1));
+            return this;
+        }
+
         AnimatorWrapper* delay(int dur) {
             impl->delay(dur);
             return this;
@@ -863,6 +1009,31 @@ class AnimatorWrapper {
             });
             return this;
         }
+
+        AnimatorWrapper* group() {
+            impl->group();
+            return this;
+        }
+
+        AnimatorWrapper* endGroup() {
+            impl->endGroup();
+            return this;
+        }
+
+        AnimatorWrapper* at(int offsetMs) {
+            impl->at(offsetMs);
+            return this;
+        }
+
+        AnimatorWrapper* ease(const std::string& easeName) {
+            Easing::Type type;
+            if (Easing::fromName(easeName, type)) {
+                impl->ease(type);
+            } else {
+                std::cerr << "[ERROR] Animator:ease(): Unknown ease '" << easeName << "'" << std::endl;
+            }
+            return this;
+        }
     
         std::shared_ptr<Animator> get() const {
             return impl;
@@ -898,9 +1069,14 @@ void ScriptManager::setAnimationManager(AnimationManager* am) {
         ),
         "changeTexture", &AnimatorWrapper::changeTexture,
         "setVisible", &AnimatorWrapper::setVisible,
+        "flipbook", &AnimatorWrapper::flipbook,
         "delay", &AnimatorWrapper::delay,
         "repeat_anim", &AnimatorWrapper::repeat_anim,
         "callback", &AnimatorWrapper::callback,
+        "group", &AnimatorWrapper::group,
+        "endGroup", &AnimatorWrapper::endGroup,
+        "at", &AnimatorWrapper::at,
+        "ease", &AnimatorWrapper::ease,
         "get", &AnimatorWrapper::get
     );
 
@@ -951,6 +1127,23 @@ void ScriptManager::setAnimationManager(AnimationManager* am) {
         }
     };
 
+    // 재생 제어 (UI 요소 이름에 걸린 모든 애니메이션)
+    lua["animation"]["pause"] = [this](const std::string& uiElementName) {
+        if (animationManager) animationManager->pause(uiElementName);
+    };
+    lua["animation"]["resume"] = [this](const std::string& uiElementName) {
+        if (animationManager) animationManager->resume(uiElementName);
+    };
+    lua["animation"]["seek"] = [this](const std::string& uiElementName, float timeMs) {
+        if (animationManager) animationManager->seek(uiElementName, timeMs);
+    };
+    lua["animation"]["setSpeed"] = [this](const std::string& uiElementName, float speed) {
+        if (animationManager) animationManager->setSpeed(uiElementName, speed);
+    };
+    lua["animation"]["setTimeScale"] = [this](float scale) {
+        if (animationManager) animationManager->setTimeScale(scale);
+    };
+
     // Ads API (배너 on/off, 전면, 리워드 비디오 - 리워드는 콜백으로 성공/실패 전달)
     sol::table adsTable = lua.create_table();
     adsTable.set_function("setBannerVisible", [this](bool visible) {
@@ -979,6 +1172,10 @@ void ScriptManager::setLoadScene(LoadSceneFn fn) {
     loadSceneFn = std::move(fn);
 }
 
+void ScriptManager::setQuit(QuitFn fn) {
+    quitFn = std::move(fn);
+}
+
 void ScriptManager::loadScene(const std::string name) {
     if (loadSceneFn) {
         loadSceneFn(name);
@@ -1111,11 +1308,7 @@ void ScriptManager::handleEvent(const SDL_Event& event, Uint32 mouseClickEvent)
 
     // 마우스/키 이벤트만 전달
     call("keyPressed", clickedElementName, typeStr, keycode, x, y);
-    
-    // SDL_USER 이벤트의 메모리 해제
-    if (event.type == mouseClickEvent && event.user.data1) {
-        delete[] static_cast<int*>(event.user.data1);
-    }
+    // 클릭 좌표(data1)는 프레임 아레나 메모리라 해제하지 않음
 }
 
 void ScriptManager::setUserDataManager(UserDataManager* udm) {
@@ -37,6 +37,10 @@ public:
     void setLoadScene(LoadSceneFn fn);
     void loadScene(const std::string name);
 
+    // quit from scene.h (헤드리스 실행 종료 신호 등)
+    using QuitFn = std::function<void()>;
+    void setQuit(QuitFn fn);
+
     
     // SDL 이벤트를 받아서 Lua로 전달 (이미 필터링된 이벤트만 전달됨)
     void handleEvent(const SDL_Event& event, Uint32 mouseClickEvent);
@@ -53,6 +57,7 @@ private:
     ResourceManager* resourceManager = nullptr;
 
     LoadSceneFn loadSceneFn;
+    QuitFn quitFn;
 
     std::map<std::string, std::string> globalData;  // Lua에서 어디서든 접근 가능한 키-값 저장소
 
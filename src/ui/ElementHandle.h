@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+/**
+ * UiManager 슬롯 맵의 요소 핸들 (슬롯 인덱스 + 세대 번호).
+ * 요소가 제거되면 슬롯의 세대가 증가하므로, 이전 핸들은 재사용된 슬롯을 가리키지 않고 무효로 판정된다.
+ * 기본 생성 핸들은 항상 무효.
+ */
+struct ElementHandle {
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool isNull() const { return index == kInvalidIndex; }
+
+    // Lua 등 정수 하나로 넘겨야 할 때 사용 (상위 32비트: 세대, 하위 32비트: 인덱스)
+    uint64_t pack() const {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+    static ElementHandle unpack(uint64_t value) {
+        ElementHandle handle;
+        handle.index = static_cast<uint32_t>(value & 0xFFFFFFFFu);
+        handle.generation = static_cast<uint32_t>(value >> 32);
+        return handle;
+    }
+
+    bool operator==(const ElementHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const ElementHandle& other) const { return !(*this == other); }
+};
+
+namespace std {
+template <>
+struct hash<ElementHandle> {
+    size_t operator()(const ElementHandle& handle) const {
+        return std::hash<uint64_t>()(handle.pack());
+    }
+};
+}
@@ -1,6 +1,7 @@
 #include "uiManager.h"
 #include "../utils/logger.h"
 #include "../rendering/ImageRenderer.h"
+#include <algorithm>
 #include <cmath>
 
 #ifndef M_PI
@@ -14,32 +15,103 @@ void UiManager::setResourceManager(ResourceManager* resourceManager) {
 }
 
 UIElement* UiManager::findElementByName(const std::string& name) {
-    for (auto& element : elements) {
-        if (element.name == name) {
-            return &element;
-        }
-    }
-    return nullptr;
+    return getElement(findHandleByName(name));
 }
 
 UIElement* UiManager::findElementByPosition(int x, int y) {
     SDL_Point p{ x, y };
     // 나중에 추가된 요소가 위에 있다고 가정 → 역순 순회
-    for (auto it = elements.rbegin(); it != elements.rend(); ++it) {
-        if (!it->visible || !it->clickable) continue; // 보이지 않으면 스킵 (원하면 제거 가능)
-        if (SDL_PointInRect(&p, &it->rect)) {
-            return &(*it);
+    for (uint32_t i = tailSlot; i != ElementHandle::kInvalidIndex; i = slots[i].prev) {
+        UIElement& element = slots[i].element;
+        if (!element.visible || !element.clickable) continue; // 보이지 않으면 스킵 (원하면 제거 가능)
+        if (SDL_PointInRect(&p, &element.rect)) {
+            return &element;
         }
     }
     return nullptr;
 }
 
-void UiManager::addUI(const UIElement& element) {
-    nameIndexMap[element.name] = elements.size();
-    elements.push_back(element);
+ElementHandle UiManager::findHandleByName(const std::string& name) const {
+    auto it = nameHandleMap.find(name);
+    if (it == nameHandleMap.end()) return ElementHandle{};
+    return it->second.first;
+}
+
+bool UiManager::isValid(ElementHandle handle) const {
+    return handle.index < slots.size() &&
+           slots[handle.index].alive &&
+           slots[handle.index].generation == handle.generation;
+}
+
+UIElement* UiManager::getElement(ElementHandle handle) {
+    if (!isValid(handle)) return nullptr;
+    return &slots[handle.index].element;
+}
+
+const UIElement* UiManager::getElement(ElementHandle handle) const {
+    if (!isValid(handle)) return nullptr;
+    return &slots[handle.index].element;
+}
+
+void UiManager::linkSlot(uint32_t index) {
+    ElementSlot& slot = slots[index];
+    slot.prev = tailSlot;
+    slot.next = ElementHandle::kInvalidIndex;
+    if (tailSlot != ElementHandle::kInvalidIndex) {
+        slots[tailSlot].next = index;
+    } else {
+        headSlot = index;
+    }
+    tailSlot = index;
+}
+
+void UiManager::unlinkSlot(uint32_t index) {
+    ElementSlot& slot = slots[index];
+    if (slot.prev != ElementHandle::kInvalidIndex) slots[slot.prev].next = slot.next;
+    else headSlot = slot.next;
+    if (slot.next != ElementHandle::kInvalidIndex) slots[slot.next].prev = slot.prev;
+    else tailSlot = slot.prev;
+    slot.prev = slot.next = ElementHandle::kInvalidIndex;
+}
+
+ElementHandle UiManager::addUI(const UIElement& element) {
+    uint32_t index;
+    if (!freeSlots.empty()) {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    ElementSlot& slot = slots[index];
+    slot.element = element;
+    slot.alive = true;
+    linkSlot(index);
+    elementCount++;
+
+    ElementHandle handle{index, slot.generation};
+    // 같은 이름이 이미 있으면 이름 조회는 계속 먼저 추가된 요소를 가리킨다
+    auto [nameIt, inserted] = nameHandleMap.try_emplace(element.name);
+    if (inserted) {
+        nameIt->second.first = handle;
+    } else {
+        nameIt->second.rest.push_back(handle);
+    }
+
+    attachSlot(index);
+    if (inserted && !unresolvedSlots.empty()) {
+        resolveWaitingChildren(element.name);  // 이 이름을 부모로 기다리던 요소 연결
+    }
+    return handle;
 }
 
 std::string UiManager::addUIAndGetId(const UIElement& element) {
+    ElementHandle handle = addUIAndGetHandle(element);
+    return slots[handle.index].element.name;
+}
+
+ElementHandle UiManager::addUIAndGetHandle(const UIElement& element) {
     UIElement newElement = element;
     
     // name이 비어있으면 자동 ID 생성
@@ -49,94 +121,159 @@ std::string UiManager::addUIAndGetId(const UIElement& element) {
         newElement.name = "element_" + std::to_string(elementIdCounter);
     }
     
-    addUI(newElement);
-    return newElement.name;
+    return addUI(newElement);
 }
 
 bool UiManager::removeUI(const std::string& name) {
-    // nameIndexMap에서 찾기
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) {
-        return false;  // 요소를 찾을 수 없음
-    }
-    
-    size_t index = it->second;
-    
-    // elements에서 제거
-    if (index < elements.size()) {
-        elements.erase(elements.begin() + index);
-        
-        // nameIndexMap 재구성 (제거된 요소 이후의 인덱스들을 1씩 감소)
-        nameIndexMap.clear();
-        for (size_t i = 0; i < elements.size(); i++) {
-            nameIndexMap[elements[i].name] = i;
+    // 같은 이름이 여럿이면 가장 나중에 추가된 요소부터 제거
+    auto it = nameHandleMap.find(name);
+    if (it == nameHandleMap.end()) return false;
+    const NameEntry& entry = it->second;
+    return removeUI(entry.rest.empty() ? entry.first : entry.rest.back());
+}
+
+void UiManager::unregisterName(const std::string& name, ElementHandle handle) {
+    auto it = nameHandleMap.find(name);
+    if (it == nameHandleMap.end()) return;
+    NameEntry& entry = it->second;
+    if (entry.first == handle) {
+        if (entry.rest.empty()) {
+            nameHandleMap.erase(it);
+            return;
         }
-        
-        return true;
+        entry.first = entry.rest.front();
+        entry.rest.erase(entry.rest.begin());
+        return;
+    }
+    auto restIt = std::find(entry.rest.begin(), entry.rest.end(), handle);
+    if (restIt != entry.rest.end()) {
+        entry.rest.erase(restIt);
     }
-    
-    return false;
 }
 
+bool UiManager::removeUI(ElementHandle handle) {
+    if (!isValid(handle)) {
+        return false;  // 요소를 찾을 수 없음 (이미 제거된 핸들 포함)
+    }
+
+    ElementSlot& slot = slots[handle.index];
+    unregisterName(slot.element.name, handle);
 
-// 베이스 텍스처 + 크기 + 9/3패치 여부 → 사용할 텍스처 생성 (등록 시 outTextureId 설정, 미등록이면 빈 문자열)
-SDL_Texture* UiManager::createTextureForImage(SDL_Texture* baseTexture, int width, int height,
-                                               bool useNinePatch, bool useThreePatch,
-                                               std::string& outTextureId) {
+    // 자식은 같은 이름의 다른 요소가 있으면 그쪽에 다시 붙고, 없으면 부모를 기다림
+    detachSlot(handle.index);
+    while (!slot.children.empty()) {
+        const uint32_t child = slot.children.back();
+        detachSlot(child);
+        attachSlot(child);
+    }
+
+    unlinkSlot(handle.index);
+    releaseOwnedTexture(slot.element);
+    slot.element = UIElement{};  // 문자열 등 해제
+    slot.alive = false;
+    slot.generation++;
+    freeSlots.push_back(handle.index);
+    elementCount--;
+    return true;
+}
+
+
+// 베이스 영역 + 크기 + 9/3패치 여부 → 사용할 텍스처 영역 (등록 시 outTextureId 설정, 미등록이면 빈 문자열)
+// 구운 패치는 공유 텍스처 전체, 패치가 아니면 베이스 영역(아틀라스 영역일 수 있음) 그대로
+TextureRegion UiManager::createTextureForImage(const std::string& imageName, const TextureRegion& baseRegion,
+                                                int width, int height, PatchMode mode, bool directPatch,
+                                                std::string& outTextureId) {
     outTextureId.clear();
-    if (!baseTexture || width <= 0 || height <= 0) return baseTexture;
+    if (!baseRegion.texture || width <= 0 || height <= 0 || mode == PatchMode::None) return baseRegion;
 
-    if (useNinePatch) {
-        SDL_Texture* tex = resourceManager->createNinePatchTexture(baseTexture, width, height);
-        if (tex) {
-            outTextureId = resourceManager->registerTexture(tex);
-            return tex;
-        }
-        return baseTexture;
+    if (directPatch) {
+        // 렌더 시 조각을 잘라 그리려면 원본 영역이 항상 필요
+        TextureRegion source = baseRegion;
+        source.isSubRect = true;
+        return source;
     }
-    if (useThreePatch) {
-        SDL_Texture* tex = resourceManager->createThreePatchTexture(baseTexture, width, height);
-        if (tex) {
-            outTextureId = resourceManager->registerTexture(tex);
-            return tex;
-        }
-        return baseTexture;
+
+    SDL_Texture* tex = resourceManager->acquirePatchTexture(imageName, width, height, mode, outTextureId);
+    if (!tex) return baseRegion;
+
+    TextureRegion patched;
+    patched.texture = tex;
+    patched.rect = {0, 0, width, height};
+    return patched;
+}
+
+void UiManager::releaseOwnedTexture(UIElement& element) {
+    if (element.ownsTexture && !element.textureId.empty() && resourceManager) {
+        resourceManager->unregisterTexture(element.textureId);
     }
-    return baseTexture;
+    element.ownsTexture = false;
 }
 
 // use by script
 void UiManager::changeTexture(const std::string& elementName, const std::string& imageName) {
-    UIElement* element = findElementByName(elementName);
-    if (!element) {
+    ElementHandle handle = findHandleByName(elementName);
+    if (!isValid(handle)) {
         Log::error("[UI] Element not found: ", elementName);
         return;
     }
+    changeTexture(handle, imageName);
+}
+
+void UiManager::changeTexture(ElementHandle handle, const std::string& imageName) {
+    UIElement* element = getElement(handle);
+    if (!element) {
+        Log::error("[UI] Element not found for handle: ", handle.index, "/", handle.generation);
+        return;
+    }
 
-    SDL_Texture* baseTexture = resourceManager->getTexture(imageName);
-    if (!baseTexture) {
+    TextureRegion baseRegion = resourceManager->getTextureRegion(imageName);
+    if (!baseRegion) {
         Log::error("[UI] Texture not found for image: ", imageName);
         return;
     }
 
     int w = element->rect.w;
     int h = element->rect.h;
-    bool usePatch = element->useNinePatch || element->useThreePatch;
+    PatchMode mode = element->getPatchMode();
 
-    if (usePatch && w > 0 && h > 0) {
-        if (!element->textureId.empty() && element->textureId.substr(0, 8) == "dynamic_") {
-            resourceManager->unregisterTexture(element->textureId);
-        }
+    if (mode != PatchMode::None && w > 0 && h > 0) {
+        // 새 패치를 먼저 받고 이전 것을 반환해야 같은 키일 때 다시 굽지 않음
         std::string newId;
-        SDL_Texture* tex = createTextureForImage(baseTexture, w, h, element->useNinePatch, element->useThreePatch, newId);
-        element->texture = tex;
+        TextureRegion region = createTextureForImage(imageName, baseRegion, w, h, mode, element->directPatch, newId);
+        releaseOwnedTexture(*element);
+        element->setTextureRegion(region);
         element->textureId = newId.empty() ? imageName : newId;
+        element->ownsTexture = !newId.empty();
     } else {
-        element->texture = baseTexture;
+        releaseOwnedTexture(*element);
+        element->setTextureRegion(baseRegion);
         element->textureId = imageName;
     }
 }
 
+TextureRegion UiManager::changeTextureFrame(ElementHandle handle, const std::string& imageName, const SDL_Rect& frame) {
+    UIElement* element = getElement(handle);
+    if (!element) {
+        Log::error("[UI] Element not found for handle: ", handle.index, "/", handle.generation);
+        return {};
+    }
+
+    TextureRegion sheet = resourceManager->getTextureRegion(imageName);
+    if (!sheet) {
+        Log::error("[UI] Texture not found for image: ", imageName);
+        return {};
+    }
+
+    // 아틀라스 안의 시트면 시트 영역 기준으로 옮김
+    TextureRegion region = sheet;
+    region.rect = {sheet.rect.x + frame.x, sheet.rect.y + frame.y, frame.w, frame.h};
+    region.isSubRect = true;
+    releaseOwnedTexture(*element);
+    element->setTextureRegion(region);
+    element->textureId = imageName;
+    return sheet;
+}
+
 // 텍스처 ID로 변경
 void UiManager::changeTextureById(const std::string& elementName, const std::string& textureId) {
     UIElement* element = findElementByName(elementName);
@@ -150,13 +287,18 @@ void UiManager::changeTextureById(const std::string& elementName, const std::str
         return;
     }
     
-    SDL_Texture* texture = resourceManager->getTexture(textureId);
-    if (!texture) {
+    TextureRegion region = resourceManager->getTextureRegion(textureId);
+    if (!region) {
         Log::error("[UiManager] Texture not found for ID: ", textureId);
         return;
     }
+    if (element->ownsTexture && element->textureId == textureId) {
+        return;  // 이미 같은 텍스처 (반환하면 마지막 참조에서 삭제되므로 그대로 둠)
+    }
     
-    element->texture = texture;
+    // 구운 패치 텍스처를 들고 있었으면 반환 (새 ID는 호출자 소유이므로 ownsTexture는 false)
+    releaseOwnedTexture(*element);
+    element->setTextureRegion(region);
     element->textureId = textureId;
 }
 
@@ -171,40 +313,56 @@ std::string UiManager::getTextureId(const std::string& elementName) const {
 
 
 void UiManager::move(const std::string& name, int dx, int dy) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    auto& rect = elements[nameIndexMap[name]].rect;
-    rect.x += dx;
-    rect.y += dy;
+    UIElement* element = findElementByName(name);
+    if (!element) return;
+    element->rect.x += dx;
+    element->rect.y += dy;
 }
 
 void UiManager::moveTo(const std::string& name, int x, int y) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    auto& rect = elements[nameIndexMap[name]].rect;
-    rect.x = x;
-    rect.y = y;
+    moveTo(findHandleByName(name), x, y);
+}
+
+void UiManager::moveTo(ElementHandle handle, int x, int y) {
+    UIElement* element = getElement(handle);
+    if (!element) return;
+    element->rect.x = x;
+    element->rect.y = y;
 }
 
 void UiManager::resize(const std::string& name, int w, int h) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    auto& rect = elements[nameIndexMap[name]].rect;
-    rect.w = w;
-    rect.h = h;
+    resize(findHandleByName(name), w, h);
+}
+
+void UiManager::resize(ElementHandle handle, int w, int h) {
+    UIElement* element = getElement(handle);
+    if (!element) return;
+    element->rect.w = w;
+    element->rect.h = h;
 }
 
 void UiManager::setRect(const std::string& name, int x, int y, int w, int h) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    auto& rect = elements[nameIndexMap[name]].rect;
-    rect = {x, y, w, h};
+    UIElement* element = findElementByName(name);
+    if (!element) return;
+    element->rect = {x, y, w, h};
 }
 
 void UiManager::setAlpha(const std::string& name, float alpha) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    elements[nameIndexMap[name]].alpha = alpha;
+    setAlpha(findHandleByName(name), alpha);
+}
+
+void UiManager::setAlpha(ElementHandle handle, float alpha) {
+    UIElement* element = getElement(handle);
+    if (element) element->alpha = alpha;
 }
 
 void UiManager::setVisible(const std::string& name, bool visible) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    elements[nameIndexMap[name]].visible = visible;
+    setVisible(findHandleByName(name), visible);
+}
+
+void UiManager::setVisible(ElementHandle handle, bool visible) {
+    UIElement* element = getElement(handle);
+    if (element) element->visible = visible;
 }
 
 void UiManager::setAlwaysOnTop(const std::string& name, bool onTop) {
@@ -213,89 +371,86 @@ void UiManager::setAlwaysOnTop(const std::string& name, bool onTop) {
 }
 
 void UiManager::setRotate(const std::string& name, float angle) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    elements[nameIndexMap[name]].rotation = angle;
+    setRotate(findHandleByName(name), angle);
+}
+
+void UiManager::setRotate(ElementHandle handle, float angle) {
+    UIElement* element = getElement(handle);
+    if (element) element->rotation = angle;
 }
 
 void UiManager::setScale(const std::string& name, float scale) {
-    if (nameIndexMap.find(name) == nameIndexMap.end()) return;
-    elements[nameIndexMap[name]].scale = scale;
+    setScale(findHandleByName(name), scale);
+}
+
+void UiManager::setScale(ElementHandle handle, float scale) {
+    UIElement* element = getElement(handle);
+    if (element) element->scale = scale;
 }
 
 
 // getter
 int UiManager::getLeft(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0;
-    return elements[it->second].rect.x;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0;
+    return element->rect.x;
 }
 
 int UiManager::getTop(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0;
-    return elements[it->second].rect.y;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0;
+    return element->rect.y;
 }
 
 int UiManager::getRight(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0;
-    const auto& rect = elements[it->second].rect;
-    return rect.x + rect.w;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0;
+    return element->rect.x + element->rect.w;
 }
 
 int UiManager::getBottom(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0;
-    const auto& rect = elements[it->second].rect;
-    return rect.y + rect.h;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0;
+    return element->rect.y + element->rect.h;
 }
 
 int UiManager::getWidth(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0;
-    return elements[it->second].rect.w;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0;
+    return element->rect.w;
 }
 
 int UiManager::getHeight(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0;
-    return elements[it->second].rect.h;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0;
+    return element->rect.h;
 }
 
 float UiManager::getAlpha(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 1.0f;
-    return elements[it->second].alpha;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 1.0f;
+    return element->alpha;
 }
 
 float UiManager::getScale(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 1.0f;
-    return elements[it->second].scale;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 1.0f;
+    return element->scale;
 }
 
 float UiManager::getRotate(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return 0.0f;
-    return elements[it->second].rotation;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return 0.0f;
+    return element->rotation;
 }
 
 bool UiManager::isVisible(const std::string& name) const {
-    auto it = nameIndexMap.find(name);
-    if (it == nameIndexMap.end()) return false;
-    return elements[it->second].visible;
+    const UIElement* element = getElement(findHandleByName(name));
+    if (!element) return false;
+    return element->visible;
 }
 
 
-
-std::vector<UIElement>& UiManager::getElements() {
-    return elements;
-}
-
-const std::vector<UIElement>& UiManager::getElements() const {
-    return elements;
-}
- 
 // 순환 참조 체크: childName이 parentName의 조상인지 확인
 bool UiManager::wouldCreateCycle(const std::string& childName, const std::string& parentName) const {
     if (childName == parentName) {
@@ -324,15 +479,24 @@ bool UiManager::wouldCreateCycle(const std::string& childName, const std::string
 
 // 부모-자식 관계 관리 (다단계: 위치/스케일/회전 상속)
 void UiManager::setParent(const std::string& childName, const std::string& parentName) {
-    UIElement* child = findElementByName(childName);
-    if (!child) {
+    ElementHandle handle = findHandleByName(childName);
+    if (!isValid(handle)) {
         Log::error("[UI] Child element not found: ", childName);
         return;
     }
+    setParent(handle, parentName);
+}
+
+void UiManager::setParent(ElementHandle childHandle, const std::string& parentName) {
+    UIElement* child = getElement(childHandle);
+    if (!child) {
+        Log::error("[UI] Child element not found for handle: ", childHandle.index, "/", childHandle.generation);
+        return;
+    }
     
     // 순환 참조 체크
-    if (wouldCreateCycle(childName, parentName)) {
-        Log::error("[UI] Cannot set parent: would create cycle. Child: ", childName, 
+    if (wouldCreateCycle(child->name, parentName)) {
+        Log::error("[UI] Cannot set parent: would create cycle. Child: ", child->name, 
                   ", Parent: ", parentName);
         return;
     }
@@ -346,13 +510,11 @@ void UiManager::setParent(const std::string& childName, const std::string& paren
         }
     }
     
-    // 기존 부모 제거
-    if (!child->parentName.empty()) {
-        removeParent(childName);
-    }
-    
-    // 새 부모 설정
+    // 새 부모 설정 (이 요소만 목록을 옮기고 하위 트리를 재계산 대상으로 표시)
+    const uint32_t index = childHandle.index;
     child->parentName = parentName;
+    detachSlot(index);
+    attachSlot(index);
 }
 
 void UiManager::removeParent(const std::string& childName) {
@@ -361,7 +523,10 @@ void UiManager::removeParent(const std::string& childName) {
         return;
     }
     
+    const uint32_t index = findHandleByName(childName).index;
     child->parentName = "";
+    detachSlot(index);
+    attachSlot(index);
 }
 
 // 월드 위치 계산 (원본 위치, 스케일 미적용)
@@ -445,6 +610,14 @@ float UiManager::getWorldRotation(const std::string& elementName) const {
     return worldRotation;
 }
 
+const UiManager::WorldTransform* UiManager::getWorldTransform(const std::string& elementName) const {
+    ElementHandle handle = findHandleByName(elementName);
+    if (!isValid(handle)) {
+        return nullptr;
+    }
+    return &slots[handle.index].world;
+}
+
 // 스케일 적용된 렌더링 위치와 크기 계산 (중심 기준, 부모 회전 고려)
 void UiManager::getScaledRect(const std::string& elementName, SDL_Rect& scaledRect) const {
     UIElement* element = const_cast<UiManager*>(this)->findElementByName(elementName);
@@ -530,8 +703,23 @@ void UiManager::getScaledRect(const std::string& elementName, SDL_Rect& scaledRe
 }
 
 void UiManager::clear() {
-    elements.clear();
-    nameIndexMap.clear();
+    // 슬롯은 유지하고 세대만 올려서, 씬 전환 전에 받은 핸들이 새 요소를 가리키지 않도록 한다
+    freeSlots.clear();
+    for (uint32_t i = static_cast<uint32_t>(slots.size()); i-- > 0;) {
+        ElementSlot& slot = slots[i];
+        if (slot.alive) {
+            releaseOwnedTexture(slot.element);
+            slot.element = UIElement{};
+            slot.alive = false;
+            slot.generation++;
+        }
+        slot.prev = slot.next = ElementHandle::kInvalidIndex;
+        freeSlots.push_back(i);
+    }
+    headSlot = tailSlot = ElementHandle::kInvalidIndex;
+    elementCount = 0;
+    nameHandleMap.clear();
+    rebuildHierarchy();
 }
 
 bool UiManager::loadUIFromJson(const nlohmann::json& uiElement,
@@ -541,10 +729,12 @@ bool UiManager::loadUIFromJson(const nlohmann::json& uiElement,
     std::string uiName = uiElement["name"].get<std::string>();
     std::vector<int> loc = uiElement["loc"].get<std::vector<int>>();
     
-    SDL_Texture* texture = nullptr;
+    TextureRegion region;
     std::string imageName;
     bool useNinePatch = false;
     bool useThreePatch = false;
+    bool directPatch = false;
+    bool ownsTexture = false;
 
     if (type == "image") {
         int elementWidth = loc[2] - loc[0];
@@ -555,8 +745,8 @@ bool UiManager::loadUIFromJson(const nlohmann::json& uiElement,
         }
 
         imageName = uiElement["image"].get<std::string>();
-        SDL_Texture* baseTexture = resourceManager->getTexture(imageName);
-        if (!baseTexture) {
+        TextureRegion baseRegion = resourceManager->getTextureRegion(imageName);
+        if (!baseRegion) {
             Log::error("Texture not found: ", imageName);
             return false;
         }
@@ -574,10 +764,16 @@ bool UiManager::loadUIFromJson(const nlohmann::json& uiElement,
             useThreePatch = false;  // 9패치 우선
         }
 
+        if (uiElement.contains("directPatch")) {
+            directPatch = uiElement["directPatch"].get<bool>();
+        }
+
+        PatchMode mode = useNinePatch ? PatchMode::Nine : (useThreePatch ? PatchMode::Three : PatchMode::None);
         std::string patchTextureId;
-        texture = createTextureForImage(baseTexture, elementWidth, elementHeight, useNinePatch, useThreePatch, patchTextureId);
+        region = createTextureForImage(imageName, baseRegion, elementWidth, elementHeight, mode, directPatch, patchTextureId);
         if (!patchTextureId.empty()) {
             imageName = patchTextureId;
+            ownsTexture = true;
         }
     }
     else {
@@ -588,11 +784,13 @@ bool UiManager::loadUIFromJson(const nlohmann::json& uiElement,
     // UIElement 구조체 생성
     UIElement element;
     element.name = uiName;
-    element.texture = texture;
+    element.setTextureRegion(region);
     element.textureId = imageName;  // 이미지 이름 또는 텍스처 ID
     element.rect = SDL_Rect{loc[0], loc[1], loc[2] - loc[0], loc[3] - loc[1]};
     element.useNinePatch = useNinePatch;
     element.useThreePatch = useThreePatch;
+    element.directPatch = directPatch;
+    element.ownsTexture = ownsTexture;
     
     // 선택적 필드 처리 (기본값 있음)
     if (uiElement.contains("scale")) {
@@ -626,95 +824,309 @@ bool UiManager::loadUIFromJson(const nlohmann::json& uiElement,
     return true;
 }
 
-void UiManager::renderElement(SDL_Renderer* renderer, const UIElement& element) {
-    if (!element.visible || !element.texture) return;
+// parentName으로 찾은 부모 슬롯. 부모가 없거나 자기 자신/자손이면(순환) kInvalidIndex
+uint32_t UiManager::resolveParentSlot(uint32_t index) const {
+    ElementHandle parent = findHandleByName(slots[index].element.parentName);
+    if (!isValid(parent)) {
+        return ElementHandle::kInvalidIndex;
+    }
+    for (uint32_t i = parent.index; i != ElementHandle::kInvalidIndex; i = slots[i].parentSlot) {
+        if (i == index) {
+            return ElementHandle::kInvalidIndex;
+        }
+    }
+    return parent.index;
+}
 
-    bool allParentsVisible = true;
-    std::string currentParent = element.parentName;
-    while (!currentParent.empty()) {
-        UIElement* parent = findElementByName(currentParent);
-        if (!parent || !parent->visible) {
-            allParentsVisible = false;
-            break;
+// 슬롯을 parentName에 맞는 목록(루트/부모의 자식/대기) 끝에 넣음
+void UiManager::attachSlot(uint32_t index) {
+    ElementSlot& slot = slots[index];
+    std::vector<uint32_t>* list = &rootSlots;
+    slot.list = HierarchyList::Root;
+    slot.parentSlot = ElementHandle::kInvalidIndex;
+    if (!slot.element.parentName.empty()) {
+        const uint32_t parent = resolveParentSlot(index);
+        if (parent != ElementHandle::kInvalidIndex) {
+            slot.parentSlot = parent;
+            slot.list = HierarchyList::Child;
+            list = &slots[parent].children;
+        } else {
+            slot.list = HierarchyList::Unresolved;
+            list = &unresolvedSlots;
         }
-        currentParent = parent->parentName;
     }
-    if (!allParentsVisible) return;
+    slot.listPosition = static_cast<uint32_t>(list->size());
+    list->push_back(index);
 
-    SDL_Rect dst;
-    getScaledRect(element.name, dst);
-    float worldRotation = getWorldRotation(element.name);
-    float worldScale = element.scale;
-    bool hasParentScaleOrRotation = false;
-    if (!element.parentName.empty()) {
-        UIElement* parentElement = findElementByName(element.parentName);
-        if (parentElement) {
-            worldScale *= parentElement->scale;
-            if (parentElement->scale != 1.0f || parentElement->rotation != 0.0f) {
-                hasParentScaleOrRotation = true;
-            }
+    if (slot.list == HierarchyList::Unresolved) {
+        hideSubtree(index);  // 루트에서 도달하지 못하므로 렌더하지 않음
+    } else {
+        slot.worldDirty = true;
+    }
+}
+
+// 슬롯을 들어 있던 목록에서 빼냄 (마지막 원소와 자리 바꿈, 자식 목록은 그대로 둠)
+void UiManager::detachSlot(uint32_t index) {
+    ElementSlot& slot = slots[index];
+    std::vector<uint32_t>* list = nullptr;
+    switch (slot.list) {
+        case HierarchyList::Root: list = &rootSlots; break;
+        case HierarchyList::Child: list = &slots[slot.parentSlot].children; break;
+        case HierarchyList::Unresolved: list = &unresolvedSlots; break;
+        case HierarchyList::None: return;
+    }
+    const uint32_t moved = list->back();
+    (*list)[slot.listPosition] = moved;
+    slots[moved].listPosition = slot.listPosition;
+    list->pop_back();
+    slot.list = HierarchyList::None;
+    slot.parentSlot = ElementHandle::kInvalidIndex;
+}
+
+void UiManager::resolveWaitingChildren(const std::string& parentName) {
+    for (size_t i = 0; i < unresolvedSlots.size();) {
+        const uint32_t waiting = unresolvedSlots[i];
+        if (slots[waiting].element.parentName == parentName &&
+            resolveParentSlot(waiting) != ElementHandle::kInvalidIndex) {
+            detachSlot(waiting);  // 마지막 원소가 i로 옮겨 오므로 i는 그대로
+            attachSlot(waiting);
+        } else {
+            i++;
         }
     }
-    bool shouldClip = !(element.scale != 1.0f || element.rotation != 0.0f || hasParentScaleOrRotation);
-    bool wasClipped = false;
-    if (!element.parentName.empty() && shouldClip) {
-        SDL_Rect clipRect = {0, 0, 0, 0};
-        bool hasClipRect = false;
-        std::string currentParent = element.parentName;
-        while (!currentParent.empty()) {
-            UIElement* parentElement = findElementByName(currentParent);
-            if (!parentElement || !parentElement->visible) break;
-            SDL_Rect parentRect;
-            getScaledRect(currentParent, parentRect);
-            if (!hasClipRect) {
-                clipRect = parentRect;
-                hasClipRect = true;
-            } else {
-                SDL_Rect intersection;
-                if (SDL_IntersectRect(&clipRect, &parentRect, &intersection)) {
-                    clipRect = intersection;
-                } else {
-                    hasClipRect = false;
-                    break;
-                }
-            }
-            currentParent = parentElement->parentName;
+}
+
+void UiManager::hideSubtree(uint32_t index) {
+    transformStack.clear();
+    transformStack.emplace_back(index, false);
+    while (!transformStack.empty()) {
+        ElementSlot& slot = slots[transformStack.back().first];
+        transformStack.pop_back();
+        slot.world.visible = false;
+        for (uint32_t child : slot.children) {
+            transformStack.emplace_back(child, false);
         }
-        if (hasClipRect) {
-            SDL_Rect elementIntersection;
-            if (!SDL_IntersectRect(&dst, &clipRect, &elementIntersection)) return;
-            SDL_RenderSetClipRect(renderer, &clipRect);
-            wasClipped = true;
-        } else {
-            return;
+    }
+}
+
+// parentName으로 모든 계층 목록을 다시 구성 (clear()에서만 사용)
+void UiManager::rebuildHierarchy() {
+    rootSlots.clear();
+    unresolvedSlots.clear();
+    for (ElementSlot& slot : slots) {
+        slot.parentSlot = ElementHandle::kInvalidIndex;
+        slot.children.clear();
+        slot.list = HierarchyList::None;
+        slot.world.visible = false;
+    }
+    for (uint32_t i = headSlot; i != ElementHandle::kInvalidIndex; i = slots[i].next) {
+        attachSlot(i);
+    }
+}
+
+void UiManager::updateWorldTransforms() {
+    // (슬롯, 부모가 이번에 재계산되었는지)
+    transformStack.clear();
+    for (uint32_t root : rootSlots) {
+        transformStack.emplace_back(root, false);
+    }
+    while (!transformStack.empty()) {
+        auto [index, parentChanged] = transformStack.back();
+        transformStack.pop_back();
+
+        ElementSlot& slot = slots[index];
+        const UIElement& e = slot.element;
+        LocalState local{e.rect, e.scale, e.rotation, e.alpha, e.visible};
+        bool changed = parentChanged || slot.worldDirty || !(local == slot.lastLocal);
+        if (changed) {
+            slot.worldDirty = false;
+            slot.lastLocal = local;
+            const ElementSlot* parent = slot.parentSlot != ElementHandle::kInvalidIndex ? &slots[slot.parentSlot] : nullptr;
+            computeWorldTransform(slot, parent);
+        }
+        for (uint32_t child : slot.children) {
+            transformStack.emplace_back(child, changed);
+        }
+    }
+}
+
+// getWorldPosition / getWorldRotation / getScaledRect와 같은 식을 부모 캐시 기준으로 계산
+void UiManager::computeWorldTransform(ElementSlot& slot, const ElementSlot* parent) {
+    const UIElement& element = slot.element;
+    WorldTransform& world = slot.world;
+
+    float worldScale = element.scale;
+    int centerX, centerY;
+
+    if (parent) {
+        const UIElement& parentElement = parent->element;
+        const WorldTransform& parentWorld = parent->world;
+
+        world.worldX = parentWorld.worldX + element.rect.x;
+        world.worldY = parentWorld.worldY + element.rect.y;
+        world.rotation = element.rotation + parentWorld.rotation;
+        world.alpha = element.alpha * parentWorld.alpha;
+        world.visible = element.visible && parentWorld.visible;
+
+        // 월드 스케일 (자신의 scale * 부모의 scale)
+        float parentScale = parentElement.scale;
+        worldScale *= parentScale;
+
+        // 부모 중심(스케일 무관) + 부모 스케일/회전이 적용된 자식 중심 오프셋
+        int parentCenterX = parentWorld.worldX + parentElement.rect.w / 2;
+        int parentCenterY = parentWorld.worldY + parentElement.rect.h / 2;
+        int offsetX = (element.rect.x + element.rect.w / 2) - parentElement.rect.w / 2;
+        int offsetY = (element.rect.y + element.rect.h / 2) - parentElement.rect.h / 2;
+        float scaledOffsetX = offsetX * parentScale;
+        float scaledOffsetY = offsetY * parentScale;
+        if (parentWorld.rotation != 0.0f) {
+            float rad = parentWorld.rotation * M_PI / 180.0f;
+            float cosR = std::cos(rad);
+            float sinR = std::sin(rad);
+            float rotatedX = scaledOffsetX * cosR - scaledOffsetY * sinR;
+            float rotatedY = scaledOffsetX * sinR + scaledOffsetY * cosR;
+            scaledOffsetX = rotatedX;
+            scaledOffsetY = rotatedY;
         }
+        centerX = parentCenterX + static_cast<int>(scaledOffsetX);
+        centerY = parentCenterY + static_cast<int>(scaledOffsetY);
+
+        world.shouldClip = !(element.scale != 1.0f || element.rotation != 0.0f ||
+                             parentElement.scale != 1.0f || parentElement.rotation != 0.0f);
+        world.hasAncestorClip = parentWorld.hasChildClip;
+        world.ancestorClip = parentWorld.childClip;
+    } else {
+        world.worldX = element.rect.x;
+        world.worldY = element.rect.y;
+        world.rotation = element.rotation;
+        world.alpha = element.alpha;
+        world.visible = element.visible;
+        centerX = world.worldX + element.rect.w / 2;
+        centerY = world.worldY + element.rect.h / 2;
+        world.shouldClip = false;
+        world.hasAncestorClip = false;
+    }
+
+    int scaledWidth = static_cast<int>(element.rect.w * worldScale);
+    int scaledHeight = static_cast<int>(element.rect.h * worldScale);
+    world.scale = worldScale;
+    world.dst = {centerX - scaledWidth / 2, centerY - scaledHeight / 2, scaledWidth, scaledHeight};
+
+    // 자식 클리핑 영역: 루트는 자기 rect, 그 아래는 조상 교집합과 자기 rect의 교집합 (비면 자식 렌더 생략)
+    if (!parent) {
+        world.hasChildClip = true;
+        world.childClip = world.dst;
+    } else if (world.hasAncestorClip) {
+        world.hasChildClip = SDL_IntersectRect(&world.ancestorClip, &world.dst, &world.childClip);
+    } else {
+        world.hasChildClip = false;
+    }
+}
+
+void UiManager::renderElement(SDL_Renderer* renderer, const ElementSlot& slot) {
+    const UIElement& element = slot.element;
+    const WorldTransform& world = slot.world;
+    if (!world.visible || (!element.texture && element.glyphs.empty())) return;
+
+    const SDL_Rect& dst = world.dst;
+    const SDL_Rect* clip = nullptr;
+    if (slot.parentSlot != ElementHandle::kInvalidIndex && world.shouldClip) {
+        if (!world.hasAncestorClip) return;
+        SDL_Rect elementIntersection;
+        if (!SDL_IntersectRect(&dst, &world.ancestorClip, &elementIntersection)) return;
+        clip = &world.ancestorClip;
     }
-    float effectiveAlpha = element.alpha;
-    std::string alphaParent = element.parentName;
-    while (!alphaParent.empty()) {
-        UIElement* p = findElementByName(alphaParent);
-        if (p) effectiveAlpha *= p->alpha;
-        else break;
-        alphaParent = p->parentName;
+    if (!element.glyphs.empty()) {
+        renderGlyphs(element, world, clip);
+        return;
+    }
+    if (element.directPatch && element.hasSrcRect() && element.getPatchMode() != PatchMode::None) {
+        renderPatchSlices(element, world, clip);
+        return;
+    }
+    spriteBatch.draw(element.texture, element.hasSrcRect() ? &element.srcRect : nullptr, dst, world.rotation,
+                     static_cast<Uint8>(world.alpha * element.tint.a), clip, nullptr, element.tint);
+}
+
+// 글리프 텍스트: 레이아웃 좌표(rect 크기 × glyphUnitScale 기준)를 월드 dst에 맞춰 스케일하고 요소 중심 기준으로 회전.
+// 같은 글리프 페이지의 글자는 한 배치로 합쳐진다
+void UiManager::renderGlyphs(const UIElement& element, const WorldTransform& world, const SDL_Rect* clip) {
+    if (element.rect.w <= 0 || element.rect.h <= 0) return;
+
+    const SDL_Rect& dst = world.dst;
+    float sx = static_cast<float>(dst.w) / element.rect.w * element.glyphUnitScale;
+    float sy = static_cast<float>(dst.h) / element.rect.h * element.glyphUnitScale;
+    int pivotX = dst.x + dst.w / 2;
+    int pivotY = dst.y + dst.h / 2;
+    Uint8 alpha = static_cast<Uint8>(world.alpha * element.tint.a);
+    // 거리장 글리프: 현재 배율(텍셀당 화면 픽셀)의 임계값 페이지로 그림. 같은 페이지가 이어지면 다시 찾지 않음
+    SDL_Texture* lastPage = nullptr;
+    SDL_Texture* drawTexture = nullptr;
+
+    for (const GlyphQuad& glyph : element.glyphs) {
+        int x0 = dst.x + static_cast<int>(std::lround(glyph.dst.x * sx));
+        int y0 = dst.y + static_cast<int>(std::lround(glyph.dst.y * sy));
+        int x1 = dst.x + static_cast<int>(std::lround((glyph.dst.x + glyph.dst.w) * sx));
+        int y1 = dst.y + static_cast<int>(std::lround((glyph.dst.y + glyph.dst.h) * sy));
+        if (x1 <= x0 || y1 <= y0) continue;
+
+        SDL_Rect glyphDst = {x0, y0, x1 - x0, y1 - y0};
+        SDL_Point center = {pivotX - x0, pivotY - y0};
+        if (glyph.texture != lastPage) {
+            lastPage = glyph.texture;
+            drawTexture = element.glyphAtlas ? element.glyphAtlas->getDrawTexture(glyph.texture, std::min(sx, sy))
+                                             : glyph.texture;
+        }
+        spriteBatch.draw(drawTexture, &glyph.src, glyphDst, world.rotation, alpha, clip, &center, element.tint);
     }
-    SDL_SetTextureAlphaMod(element.texture, static_cast<Uint8>(effectiveAlpha * 255));
-    SDL_RenderCopyEx(renderer, element.texture, nullptr, &dst, worldRotation, nullptr, SDL_FLIP_NONE);
-    if (wasClipped) {
-        SDL_RenderSetClipRect(renderer, nullptr);
+}
+
+// 9/3패치 직접 그리기: 조각을 요소 원래 크기 기준으로 계산한 뒤 월드 dst에 맞춰 스케일.
+// 조각 경계는 누적 좌표를 반올림해서 이어 붙이므로 틈이 생기지 않고, 같은 텍스처라 한 배치로 합쳐진다
+void UiManager::renderPatchSlices(const UIElement& element, const WorldTransform& world, const SDL_Rect* clip) {
+    SDL_Rect srcRects[PatchSlices::kMaxSlices];
+    SDL_Rect dstRects[PatchSlices::kMaxSlices];
+    int sliceCount = PatchSlices::compute(element.getPatchMode(), element.srcRect,
+                                          element.rect.w, element.rect.h, srcRects, dstRects);
+    if (sliceCount == 0) return;
+
+    const SDL_Rect& dst = world.dst;
+    float sx = static_cast<float>(dst.w) / element.rect.w;
+    float sy = static_cast<float>(dst.h) / element.rect.h;
+    int pivotX = dst.x + dst.w / 2;
+    int pivotY = dst.y + dst.h / 2;
+    Uint8 alpha = static_cast<Uint8>(world.alpha * element.tint.a);
+
+    for (int i = 0; i < sliceCount; i++) {
+        const SDL_Rect& src = srcRects[i];
+        const SDL_Rect& local = dstRects[i];
+        if (src.w <= 0 || src.h <= 0 || local.w <= 0 || local.h <= 0) continue;
+
+        int x0 = dst.x + static_cast<int>(std::lround(local.x * sx));
+        int y0 = dst.y + static_cast<int>(std::lround(local.y * sy));
+        int x1 = dst.x + static_cast<int>(std::lround((local.x + local.w) * sx));
+        int y1 = dst.y + static_cast<int>(std::lround((local.y + local.h) * sy));
+        if (x1 <= x0 || y1 <= y0) continue;
+
+        SDL_Rect sliceDst = {x0, y0, x1 - x0, y1 - y0};
+        SDL_Point center = {pivotX - x0, pivotY - y0};  // 요소 중심 기준으로 함께 회전
+        spriteBatch.draw(element.texture, &src, sliceDst, world.rotation, alpha, clip, &center, element.tint);
     }
 }
 
 void UiManager::render(SDL_Renderer* renderer) {
+    updateWorldTransforms();
+    spriteBatch.begin(renderer);
+
     // 1패스: alwaysOnTop 아닌 요소
-    for (const auto& element : elements) {
-        if (element.alwaysOnTop) continue;
-        renderElement(renderer, element);
+    for (uint32_t i = headSlot; i != ElementHandle::kInvalidIndex; i = slots[i].next) {
+        if (slots[i].element.alwaysOnTop) continue;
+        renderElement(renderer, slots[i]);
     }
     // 2패스: alwaysOnTop 요소 (토스트 등 최상위)
-    for (const auto& element : elements) {
-        if (!element.alwaysOnTop) continue;
-        renderElement(renderer, element);
+    for (uint32_t i = headSlot; i != ElementHandle::kInvalidIndex; i = slots[i].next) {
+        if (!slots[i].element.alwaysOnTop) continue;
+        renderElement(renderer, slots[i]);
     }
+    spriteBatch.end();
 }
-
-
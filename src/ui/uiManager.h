@@ -2,11 +2,15 @@
 #include "../utils/sdl_includes.h"
 #include <string>
 #include <vector>
+#include <deque>
 #include <unordered_map>
 #include <iostream>
 
+#include "ElementHandle.h"
+
 #include "../resource/resourceManager.h"
 #include "../rendering/TextRenderer.h"
+#include "../rendering/SpriteBatch.h"
 #include <nlohmann/json.hpp>
 
 struct UIElement {
@@ -22,22 +26,143 @@ struct UIElement {
     bool useNinePatch = false;   // true면 changeTexture 시에도 9패치로 생성
     bool useThreePatch = false;  // true면 changeTexture 시에도 3패치로 생성
     bool alwaysOnTop = false;    // true면 렌더 2패스에서 맨 나중에 그려져 최상위 표시
+    bool directPatch = false;    // true면 9/3패치를 굽지 않고 렌더 시 원본 영역에서 조각을 직접 그림
+    bool ownsTexture = false;    // textureId가 UiManager가 받은 공유 패치 텍스처 (교체/제거 시 반환)
+
+    // 아틀라스 영역: srcRectTexture가 현재 texture와 같을 때만 srcRect로 그림
+    // (위젯이 texture를 직접 바꾸면 자동으로 전체 텍스처 렌더로 돌아감)
+    SDL_Rect srcRect = {0, 0, 0, 0};
+    SDL_Texture* srcRectTexture = nullptr;
+
+    // 글리프 아틀라스 텍스트: 비어 있지 않으면 texture 대신 쿼드들을 그림 (rect 크기 기준으로 스케일)
+    std::vector<GlyphQuad> glyphs;
+    float glyphUnitScale = 1.0f;  // 글리프 쿼드 좌표 → rect 좌표 배율 (TextRun::unitScale)
+    GlyphAtlas* glyphAtlas = nullptr;  // 거리장 글리프면 그릴 때 배율별 임계값 페이지를 고르는 아틀라스
+    SDL_Color tint = {255, 255, 255, 255};  // 그릴 때 곱하는 색 (글리프는 흰색이므로 글자색)
+
+    void setTextureRegion(const TextureRegion& region) {
+        texture = region.texture;
+        srcRect = region.rect;
+        srcRectTexture = region.isSubRect ? region.texture : nullptr;
+        glyphs.clear();
+    }
+    bool hasSrcRect() const { return srcRectTexture != nullptr && srcRectTexture == texture; }
+    PatchMode getPatchMode() const {
+        return useNinePatch ? PatchMode::Nine : (useThreePatch ? PatchMode::Three : PatchMode::None);
+    }
+    // TextRenderer::layoutText 결과로 교체 (텍스처 없이 글리프만 그림, 크기는 레이아웃 크기)
+    void setTextRun(TextRun&& run, SDL_Color color) {
+        texture = nullptr;
+        srcRectTexture = nullptr;
+        glyphs = std::move(run.quads);
+        glyphUnitScale = run.unitScale;
+        glyphAtlas = run.distanceFieldAtlas;
+        rect.w = run.width;
+        rect.h = run.height;
+        tint = color;
+    }
 
     // 부모-자식 관계 (다단계: 위치/스케일/회전 상속)
     std::string parentName;  // 부모 이름 (빈 문자열이면 루트)
 };
 
 class UiManager {
+public:
+    // 렌더용 월드 변환 캐시 (getScaledRect / getWorldRotation 등과 같은 계산 결과, render()에서 갱신)
+    struct WorldTransform {
+        int worldX = 0, worldY = 0;  // 원본 월드 위치 (스케일 미적용)
+        SDL_Rect dst = {0, 0, 0, 0}; // 스케일/부모 회전 적용된 렌더 rect
+        float scale = 1.0f;          // 월드 스케일 (자신 × 부모, dst 크기 / rect 크기)
+        float rotation = 0.0f;       // 월드 회전 (부모 회전 누적)
+        float alpha = 1.0f;          // 조상 alpha 누적
+        bool visible = false;        // 자신과 모든 조상이 visible (부모를 못 찾으면 false)
+        bool shouldClip = false;     // 자신/부모에 스케일·회전이 없으면 조상 영역으로 클리핑
+        bool hasAncestorClip = false;
+        SDL_Rect ancestorClip = {0, 0, 0, 0};  // 모든 조상 rect의 교집합
+        bool hasChildClip = false;
+        SDL_Rect childClip = {0, 0, 0, 0};     // 자식에게 넘길 교집합 (ancestorClip ∩ dst)
+    };
+
 private:
-    std::vector<UIElement> elements;
-    std::unordered_map<std::string, size_t> nameIndexMap;
+    // 변경 감지용 로컬 상태 (위젯이 UIElement를 직접 수정하므로 setter 대신 비교로 감지)
+    struct LocalState {
+        SDL_Rect rect = {0, 0, 0, 0};
+        float scale = 1.0f;
+        float rotation = 0.0f;
+        float alpha = 1.0f;
+        bool visible = true;
+
+        bool operator==(const LocalState& o) const {
+            return rect.x == o.rect.x && rect.y == o.rect.y && rect.w == o.rect.w && rect.h == o.rect.h &&
+                   scale == o.scale && rotation == o.rotation && alpha == o.alpha && visible == o.visible;
+        }
+    };
+
+    // 슬롯이 들어 있는 계층 목록 (rootSlots / 부모의 children / unresolvedSlots)
+    enum class HierarchyList : uint8_t { None, Root, Child, Unresolved };
+
+    // 슬롯 맵: 제거된 슬롯은 freeSlots로 재사용하고 세대를 올려 기존 핸들을 무효화한다.
+    // deque이므로 요소를 추가해도 기존 UIElement 포인터는 유지된다.
+    struct ElementSlot {
+        UIElement element;
+        uint32_t generation = 0;
+        bool alive = false;
+        // 렌더 순서(추가 순서) 이중 연결 리스트
+        uint32_t prev = ElementHandle::kInvalidIndex;
+        uint32_t next = ElementHandle::kInvalidIndex;
+        // 변환 계층 (parentName 기준, 추가/제거/부모 변경 때 그 자리에서 갱신)
+        uint32_t parentSlot = ElementHandle::kInvalidIndex;
+        std::vector<uint32_t> children;
+        HierarchyList list = HierarchyList::None;  // 자신이 들어 있는 목록
+        uint32_t listPosition = 0;                 // 그 목록 안의 위치 (swap-remove용)
+        bool worldDirty = false;                   // 다음 updateWorldTransforms에서 하위 트리까지 재계산
+        LocalState lastLocal;
+        WorldTransform world;
+    };
+    std::deque<ElementSlot> slots;
+    std::vector<uint32_t> freeSlots;
+    uint32_t headSlot = ElementHandle::kInvalidIndex;
+    uint32_t tailSlot = ElementHandle::kInvalidIndex;
+    size_t elementCount = 0;
+    // 같은 이름의 요소들 (추가 순서). 이름 조회는 가장 먼저 추가된 요소, removeUI(이름)은 가장 나중 요소
+    // (이전 vector 구현과 같은 의미). 대부분 이름이 하나뿐이라 첫 핸들은 따로 두어 할당을 피함
+    struct NameEntry {
+        ElementHandle first;
+        std::vector<ElementHandle> rest;
+    };
+    std::unordered_map<std::string, NameEntry> nameHandleMap;
+    void unregisterName(const std::string& name, ElementHandle handle);
     ResourceManager* resourceManager = nullptr;
 
-    // 베이스 텍스처 + 크기 + 9/3패치 여부 → 사용할 텍스처 생성 (loadUIFromJson / changeTexture 공용)
-    SDL_Texture* createTextureForImage(SDL_Texture* baseTexture, int width, int height,
-                                        bool useNinePatch, bool useThreePatch,
-                                        std::string& outTextureId);
-    void renderElement(SDL_Renderer* renderer, const UIElement& element);
+    std::vector<uint32_t> rootSlots;
+    std::vector<uint32_t> unresolvedSlots;  // 부모 이름의 요소가 아직 없는 요소 (그 하위 트리는 렌더하지 않음)
+    std::vector<std::pair<uint32_t, bool>> transformStack;  // updateWorldTransforms 순회용 (재할당 방지)
+
+    SpriteBatch spriteBatch;  // 같은 텍스처/클립이 연속되는 요소를 한 번의 draw call로 묶음
+
+    void linkSlot(uint32_t index);    // 렌더 순서 맨 뒤에 연결
+    void unlinkSlot(uint32_t index);
+
+    // 계층 목록 갱신: 추가/제거/부모 변경은 해당 슬롯만 옮기고 그 하위 트리만 재계산 대상으로 표시
+    uint32_t resolveParentSlot(uint32_t index) const;  // 못 찾거나 순환이면 kInvalidIndex
+    void attachSlot(uint32_t index);
+    void detachSlot(uint32_t index);
+    void resolveWaitingChildren(const std::string& parentName);
+    void hideSubtree(uint32_t index);
+    void rebuildHierarchy();  // clear() 전용 전체 재구성
+    // 루트부터 한 번 순회하며 로컬 상태가 바뀐 노드와 그 하위 트리만 월드 변환 재계산
+    void updateWorldTransforms();
+    void computeWorldTransform(ElementSlot& slot, const ElementSlot* parent);
+
+    // 베이스 영역 + 크기 + 9/3패치 여부 → 사용할 텍스처 영역 (loadUIFromJson / changeTexture 공용)
+    // 패치면 공유 패치 텍스처를 받아 outTextureId에 설정, directPatch면 굽지 않고 원본 영역 그대로
+    TextureRegion createTextureForImage(const std::string& imageName, const TextureRegion& baseRegion,
+                                         int width, int height, PatchMode mode, bool directPatch,
+                                         std::string& outTextureId);
+    void releaseOwnedTexture(UIElement& element);
+    void renderElement(SDL_Renderer* renderer, const ElementSlot& slot);
+    void renderPatchSlices(const UIElement& element, const WorldTransform& world, const SDL_Rect* clip);
+    void renderGlyphs(const UIElement& element, const WorldTransform& world, const SDL_Rect* clip);
 
 public:
     void setResourceManager(ResourceManager* resourceManager);
@@ -45,23 +170,40 @@ public:
     UIElement* findElementByName(const std::string& name);
     UIElement* findElementByPosition(int x, int y);
 
-    void addUI(const UIElement& element);
+    // 핸들 기반 접근 (O(1), 제거/재사용된 슬롯의 핸들이면 nullptr / false)
+    ElementHandle findHandleByName(const std::string& name) const;
+    UIElement* getElement(ElementHandle handle);
+    const UIElement* getElement(ElementHandle handle) const;
+    bool isValid(ElementHandle handle) const;
+
+    ElementHandle addUI(const UIElement& element);
     std::string addUIAndGetId(const UIElement& element);  // name이 비어있으면 자동 ID 생성하여 반환
+    ElementHandle addUIAndGetHandle(const UIElement& element);  // addUIAndGetId와 같되 핸들 반환
     bool removeUI(const std::string& name);  // UIElement 제거
+    bool removeUI(ElementHandle handle);
     void changeTexture(const std::string& name, const std::string& texture);
+    void changeTexture(ElementHandle handle, const std::string& texture);
     void changeTextureById(const std::string& elementName, const std::string& textureId);
+    // 이미지(스프라이트 시트) 안의 frame 영역만 그리도록 교체 (패치 없이). 성공하면 시트 전체 영역, 실패하면 빈 영역
+    TextureRegion changeTextureFrame(ElementHandle handle, const std::string& imageName, const SDL_Rect& frame);
     std::string getTextureId(const std::string& elementName) const;
 
     void move(const std::string& name, int dx, int dy);
     void moveTo(const std::string& name, int x, int y);
     void resize(const std::string& name, int w, int h);
     void setRect(const std::string& name, int x, int y, int w, int h);
+    void moveTo(ElementHandle handle, int x, int y);
+    void resize(ElementHandle handle, int w, int h);
 
     void setAlpha(const std::string& name, float alpha);
     void setVisible(const std::string& name, bool visible);
     void setAlwaysOnTop(const std::string& name, bool onTop);
     void setRotate(const std::string& name, float angle);
     void setScale(const std::string& name, float scale);
+    void setAlpha(ElementHandle handle, float alpha);
+    void setVisible(ElementHandle handle, bool visible);
+    void setRotate(ElementHandle handle, float angle);
+    void setScale(ElementHandle handle, float scale);
 
     // getter
     int getLeft(const std::string& name) const;
@@ -79,6 +221,7 @@ public:
     
     // 부모-자식 관계 관리 (다단계: 위치/스케일/회전 상속)
     void setParent(const std::string& childName, const std::string& parentName);
+    void setParent(ElementHandle childHandle, const std::string& parentName);  // 핸들을 이미 가진 호출자용 (이름 조회 없음)
     void removeParent(const std::string& childName);
     
     // 순환 참조 체크: childName이 parentName의 조상인지 확인
@@ -95,13 +238,30 @@ public:
     
     // 월드 회전 계산 (부모 회전 누적)
     float getWorldRotation(const std::string& elementName) const;
+
+    // 렌더용 월드 변환 캐시 조회 (이번 프레임 render()의 결과, 없는 이름이면 nullptr).
+    // 직접 그리는 위젯(ParticleWidget 등)이 UIElement와 같은 위치/스케일/회전/alpha로 그릴 때 사용
+    const WorldTransform* getWorldTransform(const std::string& elementName) const;
     
-    std::vector<UIElement>& getElements();
-    const std::vector<UIElement>& getElements() const;
+    // 살아 있는 요소를 렌더 순서(추가 순서)대로 순회
+    template <typename Fn>
+    void forEachElement(Fn&& fn) {
+        for (uint32_t i = headSlot; i != ElementHandle::kInvalidIndex; i = slots[i].next) {
+            fn(slots[i].element);
+        }
+    }
+    template <typename Fn>
+    void forEachElement(Fn&& fn) const {
+        for (uint32_t i = headSlot; i != ElementHandle::kInvalidIndex; i = slots[i].next) {
+            fn(static_cast<const UIElement&>(slots[i].element));
+        }
+    }
+    size_t getElementCount() const { return elementCount; }
     void clear();
     
     // 렌더링
     void render(SDL_Renderer* renderer);
+    const SpriteBatch::Stats& getRenderStats() const { return spriteBatch.getStats(); }  // 직전 render()의 draw call/배치 수
     
     // JSON에서 UI 요소 로딩
     bool loadUIFromJson(const nlohmann::json& uiElement, 
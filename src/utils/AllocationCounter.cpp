@@ -0,0 +1,96 @@
+#include "AllocationCounter.h"
+
+#ifdef ENGINE_COUNT_ALLOCATIONS
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::atomic<uint64_t> allocationCount{0};
+
+void* allocateCounted(std::size_t size, std::size_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    void* pointer = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        pointer = std::malloc(size);
+    } else {
+#ifdef _WIN32
+        pointer = _aligned_malloc(size, alignment);
+#else
+        // aligned_alloc은 크기가 정렬의 배수여야 함
+        pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+    }
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void freeCounted(void* pointer, std::size_t alignment) {
+    if (!pointer) return;
+#ifdef _WIN32
+    if (alignment > alignof(std::max_align_t)) {
+        _aligned_free(pointer);
+        return;
+    }
+#else
+    (void)alignment;
+#endif
+    std::free(pointer);
+}
+
+}  // namespace
+
+// 배열/nothrow 형태는 표준 라이브러리 기본 구현이 아래 함수들을 호출함
+void* operator new(std::size_t size) {
+    return allocateCounted(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateCounted(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    freeCounted(pointer, alignof(std::max_align_t));
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    freeCounted(pointer, alignof(std::max_align_t));
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+    freeCounted(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept {
+    freeCounted(pointer, static_cast<std::size_t>(alignment));
+}
+
+bool AllocationCounter::isEnabled() {
+    return true;
+}
+
+uint64_t AllocationCounter::getCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+#else
+
+bool AllocationCounter::isEnabled() {
+    return false;
+}
+
+uint64_t AllocationCounter::getCount() {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * 전역 operator new 호출 횟수 카운터.
+ * ENABLE_ALLOCATION_COUNTER(CMake 옵션)로 빌드하면 AllocationCounter.cpp가 전역 new/delete를 교체해
+ * 할당마다 카운터를 올린다. 끄면 교체하지 않고 isEnabled()가 false, getCount()는 항상 0.
+ *
+ * 프레임 앞뒤의 getCount() 차이로 "한 프레임의 C++ 힙 할당 수"를 잰다 (헤드리스 요약 로그 참고).
+ * 세는 것은 전역 operator new/delete를 거치는 할당뿐이다. Lua, SDL, stb 등 C 라이브러리가 malloc으로 직접 하는
+ * 할당은 포함되지 않으므로 0이어도 프로세스 전체에 힙 할당이 없다는 뜻은 아니다.
+ */
+class AllocationCounter {
+public:
+    static bool isEnabled();
+    static uint64_t getCount();  // 프로세스 시작 후 누적 (모든 스레드)
+};
@@ -0,0 +1,125 @@
+#include "FrameArena.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+
+// 버퍼 앞에서부터 밀어 가며 할당. 해제는 무시하고 reset()에서 한꺼번에
+class BumpResource : public std::pmr::memory_resource {
+public:
+    BumpResource() { grow(FrameArena::kInitialCapacity); }
+
+    ~BumpResource() override { releaseOverflow(); }
+
+    void reset() {
+        const size_t used = getUsedBytes();
+        peakBytes = std::max(peakBytes, used);
+        releaseOverflow();
+        offset = 0;
+        // 넘친 프레임이 있었으면 다음 프레임부터는 버퍼 하나로 충분하도록 키움
+        if (used > capacity) {
+            size_t newCapacity = capacity;
+            while (newCapacity < used) {
+                newCapacity *= 2;
+            }
+            grow(newCapacity);
+            Log::info("[FrameArena] Grew buffer to ", newCapacity / 1024, "KB");
+        }
+    }
+
+    size_t getUsedBytes() const { return offset + overflowBytes; }
+    size_t getPeakBytes() const { return std::max(peakBytes, getUsedBytes()); }
+    size_t getCapacity() const { return capacity; }
+    size_t getOverflowCount() const { return overflowCount; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.get());
+        const uintptr_t aligned = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        const size_t end = static_cast<size_t>(aligned - base) + bytes;
+        if (end <= capacity) {
+            offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // 버퍼 부족: 이번 프레임에만 힙에서 받음
+        void* block = ::operator new(bytes, std::align_val_t(alignment));
+        overflow.push_back({block, alignment});
+        overflowBytes += bytes;
+        overflowCount++;
+        return block;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    struct OverflowBlock {
+        void* pointer;
+        size_t alignment;
+    };
+
+    void grow(size_t newCapacity) {
+        buffer = std::make_unique<std::byte[]>(newCapacity);
+        capacity = newCapacity;
+    }
+
+    void releaseOverflow() {
+        for (const OverflowBlock& block : overflow) {
+            ::operator delete(block.pointer, std::align_val_t(block.alignment));
+        }
+        overflow.clear();
+        overflowBytes = 0;
+    }
+
+    std::unique_ptr<std::byte[]> buffer;
+    size_t capacity = 0;
+    size_t offset = 0;
+    std::vector<OverflowBlock> overflow;
+    size_t overflowBytes = 0;
+    size_t overflowCount = 0;
+    size_t peakBytes = 0;
+};
+
+BumpResource& arena() {
+    static BumpResource instance;
+    return instance;
+}
+
+}  // namespace
+
+std::pmr::memory_resource* FrameArena::resource() {
+    return &arena();
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    return arena().allocate(bytes, alignment);
+}
+
+void FrameArena::reset() {
+    arena().reset();
+}
+
+size_t FrameArena::getUsedBytes() {
+    return arena().getUsedBytes();
+}
+
+size_t FrameArena::getPeakBytes() {
+    return arena().getPeakBytes();
+}
+
+size_t FrameArena::getCapacity() {
+    return arena().getCapacity();
+}
+
+size_t FrameArena::getOverflowCount() {
+    return arena().getOverflowCount();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * 프레임 단위 범프(bump) 할당기.
+ * 한 프레임 안에서만 쓰는 임시 데이터(이벤트 목록, 클릭 좌표, 임시 집합 등)를 미리 잡아 둔 버퍼에서
+ * 포인터만 밀어 가며 할당하고, 프레임 경계의 reset()에서 한 번에 버린다 (개별 해제 없음).
+ *
+ * - std::pmr 컨테이너는 resource()를 넘겨 만든다: std::pmr::vector<SDL_Event> events(FrameArena::resource());
+ * - 버퍼가 모자라면 그 프레임에만 힙에서 추가로 받고, reset() 때 버퍼를 그 프레임 사용량 이상으로 키운다.
+ *   따라서 사용량이 안정된 뒤의 프레임은 힙 할당이 없다.
+ * - 메인 스레드 전용 (잡 시스템 워커에서 쓰지 않는다). reset() 이후에는 이전 프레임의 포인터를 쓰면 안 된다.
+ */
+class FrameArena {
+public:
+    static constexpr size_t kInitialCapacity = 64 * 1024;
+
+    static std::pmr::memory_resource* resource();
+    static void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    static T* allocateArray(size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // 프레임 경계 (메인 루프에서 호출). 이번 프레임에 할당한 메모리를 모두 버림
+    static void reset();
+
+    static size_t getUsedBytes();       // 이번 프레임 사용량 (버퍼 + 추가 할당)
+    static size_t getPeakBytes();       // 지금까지 한 프레임 최대 사용량
+    static size_t getCapacity();        // 현재 버퍼 크기
+    static size_t getOverflowCount();   // 버퍼가 모자라 힙에서 받은 누적 횟수
+};
@@ -0,0 +1,329 @@
+#include "JobSystem.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class JobSystem::Job {
+public:
+    std::function<void()> fn;
+    std::atomic<int> pendingDependencies{1};  // 1은 submit이 쥐고 있다가 등록을 마치면 놓음
+    std::mutex mutex;
+    bool done = false;                        // mutex로 보호 (doneFlag는 잠금 없이 보는 용도)
+    std::atomic<bool> doneFlag{false};
+    std::vector<JobHandle> continuations;     // 이 잡이 끝나야 시작할 수 있는 잡
+    JobHandle self;                           // 큐에 들어가 있는 동안 핸들이 모두 버려져도 살아 있도록
+};
+
+namespace {
+
+// 큐 원소: 함수 포인터 + 문맥 (parallelFor 구간은 할당 없이 넣기 위해 std::function 대신 사용)
+struct Task {
+    void (*run)(void* context) = nullptr;
+    void* context = nullptr;
+};
+
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+struct State {
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // 0번은 워커가 아닌 스레드(메인 등)가 공용으로 사용
+    std::vector<std::thread> workers;
+    std::atomic<size_t> pendingTasks{0};
+    std::atomic<bool> stopping{false};
+    std::mutex sleepMutex;
+    std::condition_variable workAvailable;
+    std::mutex doneMutex;
+    std::condition_variable jobDone;
+
+    std::mutex mainMutex;
+    std::vector<std::function<void()>> mainQueue;
+    std::vector<std::function<void()>> mainRunning;  // drain용 (용량 재사용)
+};
+
+State state;
+thread_local size_t currentQueue = 0;  // 워커 i는 i + 1
+
+void pushTask(const Task& task) {
+    WorkQueue& queue = *state.queues[currentQueue];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(task);
+    }
+    state.pendingTasks.fetch_add(1, std::memory_order_release);
+    // 잠든 워커가 조건을 확인하는 사이에 알림이 빠지지 않도록 잠금을 한 번 거침
+    { std::lock_guard<std::mutex> lock(state.sleepMutex); }
+    state.workAvailable.notify_one();
+}
+
+bool popTask(Task& outTask) {
+    if (state.pendingTasks.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    const size_t queueCount = state.queues.size();
+    // 자기 큐는 최근 것부터 (캐시에 남아 있을 가능성이 높음)
+    {
+        WorkQueue& own = *state.queues[currentQueue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            outTask = own.tasks.back();
+            own.tasks.pop_back();
+            state.pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    // 다른 큐에서는 오래된 것부터 훔침
+    for (size_t offset = 1; offset < queueCount; offset++) {
+        WorkQueue& victim = *state.queues[(currentQueue + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            outTask = victim.tasks.front();
+            victim.tasks.pop_front();
+            state.pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool runOneTask() {
+    Task task;
+    if (!popTask(task)) {
+        return false;
+    }
+    task.run(task.context);
+    return true;
+}
+
+void workerLoop(size_t queueIndex) {
+    currentQueue = queueIndex;
+    while (true) {
+        if (runOneTask()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(state.sleepMutex);
+        state.workAvailable.wait(lock, []() {
+            return state.stopping.load(std::memory_order_acquire) ||
+                   state.pendingTasks.load(std::memory_order_acquire) > 0;
+        });
+        if (state.stopping.load(std::memory_order_acquire) &&
+            state.pendingTasks.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+    }
+}
+
+void scheduleJob(const JobSystem::JobHandle& job);
+
+void finishJob(JobSystem::Job* job) {
+    std::vector<JobSystem::JobHandle> ready;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->done = true;
+        job->doneFlag.store(true, std::memory_order_release);
+        ready.swap(job->continuations);
+    }
+    for (const JobSystem::JobHandle& next : ready) {
+        if (next->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            scheduleJob(next);
+        }
+    }
+    { std::lock_guard<std::mutex> lock(state.doneMutex); }
+    state.jobDone.notify_all();
+}
+
+void runJob(void* context) {
+    JobSystem::Job* job = static_cast<JobSystem::Job*>(context);
+    JobSystem::JobHandle keepAlive = std::move(job->self);
+    if (job->fn) {
+        job->fn();
+        job->fn = nullptr;  // 캡처한 자원은 바로 해제
+    }
+    finishJob(job);
+}
+
+void scheduleJob(const JobSystem::JobHandle& job) {
+    if (state.workers.empty()) {
+        // 워커 없음: 호출 스레드에서 바로 실행
+        JobSystem::JobHandle keepAlive = job;
+        if (job->fn) {
+            job->fn();
+            job->fn = nullptr;
+        }
+        finishJob(job.get());
+        return;
+    }
+    job->self = job;
+    pushTask(Task{&runJob, job.get()});
+}
+
+// parallelFor 한 번의 상태 (호출 스레드 스택에 둠)
+struct ParallelFor {
+    void (*body)(void*, size_t, size_t);
+    void* context;
+    size_t count;
+    size_t chunkSize;
+    size_t chunkCount;
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> helpersLeft{0};
+
+    void runChunks() {
+        size_t chunk;
+        while ((chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunkCount) {
+            const size_t begin = chunk * chunkSize;
+            body(context, begin, std::min(count, begin + chunkSize));
+        }
+    }
+};
+
+void runParallelForHelper(void* context) {
+    ParallelFor* work = static_cast<ParallelFor*>(context);
+    work->runChunks();
+    // 이 감소가 마지막 접근 (이후 호출 스레드가 반환하며 상태가 사라짐)
+    work->helpersLeft.fetch_sub(1, std::memory_order_release);
+}
+
+}  // namespace
+
+void JobSystem::start(int workerCount, int reservedThreads) {
+    if (!state.workers.empty()) {
+        shutdown();
+    }
+    if (workerCount < 0) {
+        // 메인 스레드와 풀 밖 워커(디코드/텍스트 큐)를 뺀 나머지 코어
+        int cores = static_cast<int>(std::thread::hardware_concurrency());
+        workerCount = std::max(0, cores - 1 - std::max(0, reservedThreads));
+    }
+    workerCount = std::min(workerCount, 64);
+
+    state.stopping.store(false, std::memory_order_release);
+    state.queues.clear();
+    for (int i = 0; i <= workerCount; i++) {
+        state.queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (int i = 0; i < workerCount; i++) {
+        state.workers.emplace_back(workerLoop, static_cast<size_t>(i + 1));
+    }
+    Log::info("[JobSystem] Started ", workerCount, " worker threads");
+}
+
+void JobSystem::shutdown() {
+    if (!state.workers.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(state.sleepMutex);
+            state.stopping.store(true, std::memory_order_release);
+        }
+        state.workAvailable.notify_all();
+        for (std::thread& worker : state.workers) {
+            worker.join();
+        }
+        state.workers.clear();
+    }
+    // 워커가 종료 직전에 넣은 잡이 남아 있으면 여기서 마저 실행
+    while (!state.queues.empty() && runOneTask()) {
+    }
+    drainMainThread();
+}
+
+int JobSystem::getWorkerCount() {
+    return static_cast<int>(state.workers.size());
+}
+
+JobSystem::JobHandle JobSystem::submit(std::function<void()> fn, const std::vector<JobHandle>& dependencies) {
+    JobHandle job = std::make_shared<Job>();
+    job->fn = std::move(fn);
+    for (const JobHandle& dependency : dependencies) {
+        if (!dependency) continue;
+        std::lock_guard<std::mutex> lock(dependency->mutex);
+        if (!dependency->done) {
+            dependency->continuations.push_back(job);
+            job->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    // 등록 중에 의존 잡이 모두 끝났을 수 있으므로 마지막 1을 놓는 쪽이 스케줄
+    if (job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        scheduleJob(job);
+    }
+    return job;
+}
+
+bool JobSystem::isDone(const JobHandle& job) {
+    return !job || job->doneFlag.load(std::memory_order_acquire);
+}
+
+void JobSystem::wait(const JobHandle& job) {
+    while (!isDone(job)) {
+        if (runOneTask()) {
+            continue;
+        }
+        // 실행할 잡이 없으면 다른 스레드가 끝내기를 기다림 (짧은 시간 제한으로 알림 누락에 대비)
+        std::unique_lock<std::mutex> lock(state.doneMutex);
+        state.jobDone.wait_for(lock, std::chrono::milliseconds(1), [&job]() {
+            return isDone(job) || state.pendingTasks.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+void JobSystem::parallelForImpl(size_t count, size_t minBatch, void (*body)(void*, size_t, size_t), void* context) {
+    if (count == 0) return;
+    minBatch = std::max<size_t>(1, minBatch);
+    const size_t workerCount = state.workers.size();
+    if (workerCount == 0 || count <= minBatch) {
+        body(context, 0, count);
+        return;
+    }
+
+    // 스레드당 몇 구간씩 돌아가도록 나눔 (먼저 끝난 스레드가 남은 구간을 가져감)
+    size_t chunkCount = std::min((count + minBatch - 1) / minBatch, (workerCount + 1) * 4);
+    const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    ParallelFor work;
+    work.body = body;
+    work.context = context;
+    work.count = count;
+    work.chunkSize = chunkSize;
+    work.chunkCount = chunkCount;
+    const size_t helpers = std::min(chunkCount - 1, workerCount);
+    work.helpersLeft.store(helpers, std::memory_order_relaxed);
+    for (size_t i = 0; i < helpers; i++) {
+        pushTask(Task{&runParallelForHelper, &work});
+    }
+
+    work.runChunks();
+    // 도우미가 아직 큐에 있으면 직접 꺼내 실행 (워커가 모두 바빠도 막히지 않음)
+    while (work.helpersLeft.load(std::memory_order_acquire) > 0) {
+        if (!runOneTask()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::postToMainThread(std::function<void()> fn) {
+    std::lock_guard<std::mutex> lock(state.mainMutex);
+    state.mainQueue.push_back(std::move(fn));
+}
+
+size_t JobSystem::drainMainThread() {
+    {
+        std::lock_guard<std::mutex> lock(state.mainMutex);
+        if (state.mainQueue.empty()) {
+            return 0;
+        }
+        state.mainRunning.swap(state.mainQueue);
+    }
+    // 실행 중에 새로 들어온 항목은 다음 drain에서 실행
+    const size_t ran = state.mainRunning.size();
+    for (std::function<void()>& fn : state.mainRunning) {
+        if (fn) fn();
+    }
+    state.mainRunning.clear();
+    return ran;
+}
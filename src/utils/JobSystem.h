@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * 작업 훔치기(work-stealing) 잡 시스템.
+ * 워커마다 자기 큐를 두고, 자기 큐는 뒤에서(LIFO) 꺼내고 비면 다른 큐의 앞에서(FIFO) 훔쳐 온다.
+ * 잡을 기다리는 스레드(메인 포함)는 그동안 큐의 다른 잡을 대신 실행하므로 잡 안에서 다시 기다려도 막히지 않는다.
+ *
+ * - parallelFor: [0, count)를 구간으로 나눠 호출 스레드와 워커가 함께 처리 (끝날 때까지 반환하지 않음, 힙 할당 없음)
+ * - submit: 의존 잡이 모두 끝난 뒤 실행되는 잡. 반환된 핸들로 wait/isDone
+ * - postToMainThread: SDL 텍스처/렌더러, UiManager, Lua처럼 메인 스레드에서만 가능한 후처리를 넣어 두면
+ *   메인 루프가 매 프레임 drainMainThread()로 실행
+ *
+ * 워커 수가 0이면(또는 start 전) 모든 잡을 호출 스레드에서 바로 실행한다 (단일 스레드 동작과 같음).
+ *
+ * 이미지 디코드(ImageDecodeQueue)와 텍스트 래스터화(TextRasterQueue)는 이 풀을 쓰지 않고 자기 스레드를 따로 둔다
+ * (동기 API가 진행 중인 디코드를 기다리고, 래스터 워커는 스레드마다 TTF_Font를 계속 열어 둠).
+ * 코어를 나눠 쓰도록 기본 워커 수에서 그 스레드 수를 뺀다 (start의 reservedThreads).
+ * 잡 본문에서는 SDL 렌더 호출, UiManager, Lua를 직접 건드리지 않는다.
+ */
+class JobSystem {
+public:
+    class Job;
+    using JobHandle = std::shared_ptr<Job>;
+
+    // 워커 스레드 시작 (-1이면 코어 수 - 1 - reservedThreads, 0이면 워커 없음). 이미 실행 중이면 다시 시작.
+    // reservedThreads: 풀 밖에서 따로 도는 워커 스레드 수 (디코드/텍스트 큐)
+    static void start(int workerCount, int reservedThreads = 0);
+    // 남은 잡과 메인 스레드 큐를 모두 실행하고 워커 종료
+    static void shutdown();
+    static int getWorkerCount();
+
+    static JobHandle submit(std::function<void()> fn, const std::vector<JobHandle>& dependencies = {});
+    static void wait(const JobHandle& job);  // 끝날 때까지 다른 잡을 실행하며 대기
+    static bool isDone(const JobHandle& job);
+
+    // fn(begin, end)를 최소 minBatch개씩 나눈 구간마다 호출. fn은 여러 스레드에서 동시에 불림
+    template <typename Fn>
+    static void parallelFor(size_t count, size_t minBatch, Fn&& fn) {
+        using Body = std::remove_reference_t<Fn>;
+        parallelForImpl(count, minBatch,
+                        [](void* context, size_t begin, size_t end) { (*static_cast<Body*>(context))(begin, end); },
+                        const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+    // 아무 스레드에서나 호출 가능. 메인 루프의 drainMainThread()에서 넣은 순서대로 실행
+    static void postToMainThread(std::function<void()> fn);
+    static size_t drainMainThread();  // 메인 스레드 전용. 실행한 개수 반환
+
+private:
+    static void parallelForImpl(size_t count, size_t minBatch, void (*body)(void*, size_t, size_t), void* context);
+};
@@ -0,0 +1,127 @@
+#include "Profiler.h"
+#include "FileIO.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+std::atomic<bool> Profiler::enabled{false};
+std::atomic<uint64_t> Profiler::writeIndex{0};
+std::atomic<uint32_t> Profiler::frameIndex{0};
+Profiler::Slot Profiler::slots[Profiler::kCapacity];
+
+uint64_t Profiler::frameStartNs = 0;
+float Profiler::lastFrameMs = 0.0f;
+float Profiler::frameBudgetMs = 0.0f;
+std::string Profiler::budgetDumpPrefix = "profile";
+std::optional<uint32_t> Profiler::lastBudgetDumpFrame;
+
+// 예산 초과 덤프가 연속으로 쏟아지지 않도록 최소 프레임 간격
+static const uint32_t kBudgetDumpCooldownFrames = 120;
+
+void Profiler::setEnabled(bool value) {
+    enabled.store(value, std::memory_order_relaxed);
+}
+
+void Profiler::setFrameBudget(float budgetMs, const std::string& dumpPrefix) {
+    frameBudgetMs = budgetMs;
+    budgetDumpPrefix = dumpPrefix;
+}
+
+uint64_t Profiler::nowNs() {
+    static const auto origin = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::now() - origin;
+    // 0은 "기록 안 함" 표시로 쓰므로 항상 1 이상
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) + 1;
+}
+
+uint32_t Profiler::currentThreadIndex() {
+    static std::atomic<uint32_t> nextIndex{0};
+    thread_local uint32_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+void Profiler::record(const char* name, uint64_t startNs, uint64_t endNs) {
+    if (!isEnabled()) return;
+
+    // 쓰기 위치 확보 후 슬롯 기록, 완료 표시(sequence)는 마지막에 release로 게시
+    uint64_t index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots[index & (kCapacity - 1)];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.sample.name = name;
+    slot.sample.startNs = startNs;
+    slot.sample.durationNs = endNs > startNs ? endNs - startNs : 0;
+    slot.sample.frame = frameIndex.load(std::memory_order_relaxed);
+    slot.sample.threadIndex = currentThreadIndex();
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::beginFrame() {
+    frameStartNs = nowNs();
+}
+
+float Profiler::endFrame() {
+    uint64_t endNs = nowNs();
+    lastFrameMs = static_cast<float>(endNs - frameStartNs) / 1000000.0f;
+    record("Frame", frameStartNs, endNs);
+
+    uint32_t frame = frameIndex.fetch_add(1, std::memory_order_relaxed);
+
+    if (isEnabled() && frameBudgetMs > 0.0f && lastFrameMs > frameBudgetMs &&
+        (!lastBudgetDumpFrame || frame - *lastBudgetDumpFrame >= kBudgetDumpCooldownFrames)) {
+        lastBudgetDumpFrame = frame;
+        std::string path = budgetDumpPrefix + "_frame" + std::to_string(frame) + ".json";
+        Log::info("[Profiler] Frame ", frame, " took ", lastFrameMs, "ms (budget ", frameBudgetMs,
+                  "ms), dumping trace: ", path);
+        dumpChromeTrace(path);
+    }
+    return lastFrameMs;
+}
+
+bool Profiler::dumpChromeTrace(const std::string& path) {
+    // 현재 링 버퍼에 게시된 샘플만 수집 (쓰는 중인 슬롯은 sequence 불일치로 건너뜀)
+    uint64_t end = writeIndex.load(std::memory_order_acquire);
+    uint64_t begin = end > kCapacity ? end - kCapacity : 0;
+
+    std::vector<Sample> samples;
+    samples.reserve(static_cast<size_t>(end - begin));
+    for (uint64_t i = begin; i < end; i++) {
+        const Slot& slot = slots[i & (kCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != i + 1) continue;
+        Sample sample = slot.sample;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != i + 1) continue;
+        if (sample.name) samples.push_back(sample);
+    }
+    std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) {
+        return a.startNs < b.startNs;
+    });
+
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const Sample& sample : samples) {
+        if (!first) out << ",";
+        first = false;
+        out << "{\"name\":\"";
+        for (const char* c = sample.name; *c; ++c) {
+            if (*c == '"' || *c == '\\') out << '\\';
+            out << *c;
+        }
+        // ts/dur 단위는 마이크로초
+        out << "\",\"cat\":\"engine\",\"ph\":\"X\",\"pid\":1,\"tid\":" << sample.threadIndex
+            << ",\"ts\":" << (sample.startNs / 1000.0)
+            << ",\"dur\":" << (sample.durationNs / 1000.0)
+            << ",\"args\":{\"frame\":" << sample.frame << "}}";
+    }
+    out << "]}";
+
+    if (!FileIO::writeFileAsText(path, out.str())) {
+        Log::error("[Profiler] Failed to write trace: ", path);
+        return false;
+    }
+    Log::info("[Profiler] Wrote ", samples.size(), " samples to ", path);
+    return true;
+}
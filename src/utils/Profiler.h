@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+/**
+ * 프레임 구간 프로파일러.
+ * 스코프 타이머(PROFILE_SCOPE)가 기록한 구간을 고정 크기 lock-free 링 버퍼에 쌓고,
+ * 요청 시 또는 프레임이 예산을 넘었을 때 Chrome trace_event JSON으로 덤프한다.
+ * (chrome://tracing 또는 https://ui.perfetto.dev 에서 열기)
+ *
+ * 구간 이름은 문자열 리터럴만 사용 (포인터만 저장, 복사/할당 없음).
+ */
+class Profiler {
+public:
+    struct Sample {
+        const char* name = nullptr;
+        uint64_t startNs = 0;   // 프로파일러 기준 시각으로부터의 경과 (ns)
+        uint64_t durationNs = 0;
+        uint32_t frame = 0;
+        uint32_t threadIndex = 0;
+    };
+
+    static constexpr size_t kCapacity = 1 << 14;  // 링 버퍼 크기 (2의 거듭제곱)
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    // 프레임 예산 초과 시 자동 덤프 (0 이하면 비활성). 파일명: <prefix>_frame<N>.json
+    static void setFrameBudget(float budgetMs, const std::string& dumpPrefix = "profile");
+
+    // 프레임 경계 (메인 루프에서 호출). endFrame은 프레임 시간(ms)을 반환
+    static void beginFrame();
+    static float endFrame();
+    static float getLastFrameMs() { return lastFrameMs; }
+    static uint32_t getFrameIndex() { return frameIndex.load(std::memory_order_relaxed); }
+
+    // 구간 기록 (ProfileScope가 호출)
+    static uint64_t nowNs();
+    static void record(const char* name, uint64_t startNs, uint64_t endNs);
+
+    // 링 버퍼에 남아 있는 샘플을 Chrome trace_event JSON으로 저장
+    static bool dumpChromeTrace(const std::string& path);
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};  // 기록 완료된 쓰기 번호 + 1 (0이면 비어 있음)
+        Sample sample;
+    };
+
+    static std::atomic<bool> enabled;
+    static std::atomic<uint64_t> writeIndex;
+    static std::atomic<uint32_t> frameIndex;
+    static Slot slots[kCapacity];
+
+    static uint64_t frameStartNs;
+    static float lastFrameMs;
+    static float frameBudgetMs;
+    static std::string budgetDumpPrefix;
+    static std::optional<uint32_t> lastBudgetDumpFrame;  // 아직 덤프한 적 없으면 비어 있음 (0번 프레임도 유효한 값)
+
+    static uint32_t currentThreadIndex();
+};
+
+// RAII 스코프 타이머: 생성~소멸 구간을 Profiler에 기록
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* scopeName)
+        : name(scopeName), startNs(Profiler::isEnabled() ? Profiler::nowNs() : 0) {}
+    ~ProfileScope() {
+        if (startNs != 0) {
+            Profiler::record(name, startNs, Profiler::nowNs());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    uint64_t startNs;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
@@ -15,12 +15,40 @@
 #include "dialog/CustomDialogWidget.h"
 #include "dialog/ToastWidget.h"
 #include "rpg/TilemapWidget.h"
+#include "effect/ParticleWidget.h"
 #include "../ui/uiManager.h"
 #include "../rendering/TextRenderer.h"
 #include "../rendering/ImageRenderer.h"
 #include "../animation/AnimationManager.h"
 #include "../utils/logger.h"
 
+namespace {
+// 파티클 범위 값: 숫자 하나면 min = max, [min, max] 배열이면 각각
+void readParticleRange(const nlohmann::json& json, const char* key, float& outMin, float& outMax) {
+    if (!json.contains(key)) return;
+    const auto& value = json[key];
+    if (value.is_number()) {
+        outMin = outMax = value.get<float>();
+    } else if (value.is_array() && value.size() >= 2) {
+        outMin = value[0].get<float>();
+        outMax = value[1].get<float>();
+    }
+}
+
+// 파티클 중력: 숫자 하나면 아래 방향(y)만, [x, y] 배열이면 각각
+void readParticleGravity(const nlohmann::json& json, float& outX, float& outY) {
+    if (!json.contains("gravity")) return;
+    const auto& value = json["gravity"];
+    if (value.is_number()) {
+        outX = 0.0f;
+        outY = value.get<float>();
+    } else if (value.is_array() && value.size() >= 2) {
+        outX = value[0].get<float>();
+        outY = value[1].get<float>();
+    }
+}
+}
+
 WidgetManager::WidgetManager(UiManager* uiMgr, ResourceManager* resMgr,
                              SDL_Renderer* sdlRenderer, TextRenderer* txtRenderer,
                              AnimationManager* animMgr)
@@ -58,7 +86,7 @@ void WidgetManager::update(float deltaTime) {
     }
 }
 
-void WidgetManager::handleEvents(const std::vector<SDL_Event>& events) {
+void WidgetManager::handleEvents(const std::pmr::vector<SDL_Event>& events) {
     for (const auto& event : events) {
         // 1. 마우스 클릭: 포커스 관리만 (위젯별 처리는 handleEvent로 위임)
         if (event.type == SDL_MOUSEBUTTONDOWN && event.button.button == SDL_BUTTON_LEFT) {
@@ -257,6 +285,10 @@ bool WidgetManager::loadWidgetFromJson(const nlohmann::json& uiElement) {
             button->setFontSize(textSize);
         }
         
+        if (uiElement.contains("font")) {
+            button->setFont(uiElement["font"].get<std::string>());
+        }
+        
         if (uiElement.contains("textColor")) {
             auto rgb = uiElement["textColor"].get<std::vector<int>>();
             SDL_Color textColor = {255, 255, 255, 255};
@@ -323,6 +355,12 @@ bool WidgetManager::loadWidgetFromJson(const nlohmann::json& uiElement) {
             text, size, color, wrapWidth, maxHeight,
             textAlign, loc[0], loc[1], contW, contH
         );
+        if (uiElement.contains("font")) {
+            textWidget->setFont(uiElement["font"].get<std::string>());
+        }
+        if (uiElement.contains("sdf")) {
+            textWidget->setDistanceField(uiElement["sdf"].get<bool>());
+        }
         
         // UIElement의 위치 및 속성 설정. textAlign "center"면 TextWidget이 updateTexture()에서 이미 설정함
         std::string elementId = textWidget->getUIElementId();
@@ -385,6 +423,9 @@ bool WidgetManager::loadWidgetFromJson(const nlohmann::json& uiElement) {
             uiManager, resourceManager, renderer, textRenderer,
             text, size, textColor, bgColor, wrapWidth, maxHeight
         );
+        if (uiElement.contains("font")) {
+            bgTextWidget->setFont(uiElement["font"].get<std::string>());
+        }
         
         // 배경 이미지 설정 (선택)
         if (uiElement.contains("backgroundImage")) {
@@ -1411,6 +1452,62 @@ bool WidgetManager::loadWidgetFromJson(const nlohmann::json& uiElement) {
         
         return true;
     }
+    else if (type == "particles") {
+        SDL_Rect particleRect = SDL_Rect{loc[0], loc[1], loc[2] - loc[0], loc[3] - loc[1]};
+        auto particleWidget = std::make_unique<ParticleWidget>(uiManager, resourceManager, particleRect);
+
+        // 이미터 설정 (image는 위젯에 한 번 적으면 모든 이미터 기본값)
+        std::string defaultImage = uiElement.value("image", "");
+        for (const auto& emitterJson : uiElement.value("emitters", nlohmann::json::array())) {
+            ParticleWidget::EmitterConfig config;
+            config.image = emitterJson.value("image", defaultImage);
+            config.x = emitterJson.value("x", particleRect.w * 0.5f);
+            config.y = emitterJson.value("y", particleRect.h * 0.5f);
+            if (emitterJson.contains("area")) {
+                auto area = emitterJson["area"].get<std::vector<float>>();
+                if (area.size() >= 2) {
+                    config.areaW = area[0];
+                    config.areaH = area[1];
+                }
+            }
+            config.rate = emitterJson.value("rate", 0.0f);
+            config.burst = emitterJson.value("burst", 0);
+            config.maxParticles = emitterJson.value("maxParticles", config.maxParticles);
+            config.durationMs = emitterJson.value("durationMs", -1);
+            readParticleRange(emitterJson, "lifetimeMs", config.lifetimeMin, config.lifetimeMax);
+            readParticleRange(emitterJson, "speed", config.speedMin, config.speedMax);
+            readParticleRange(emitterJson, "angle", config.angleMin, config.angleMax);
+            readParticleGravity(emitterJson, config.gravityX, config.gravityY);
+            readParticleRange(emitterJson, "size", config.sizeStart, config.sizeEnd);
+            readParticleRange(emitterJson, "alpha", config.alphaStart, config.alphaEnd);
+            readParticleRange(emitterJson, "spin", config.spinMin, config.spinMax);
+            if (emitterJson.contains("color")) {
+                auto rgb = emitterJson["color"].get<std::vector<int>>();
+                if (rgb.size() >= 3) {
+                    config.color.r = static_cast<Uint8>(rgb[0]);
+                    config.color.g = static_cast<Uint8>(rgb[1]);
+                    config.color.b = static_cast<Uint8>(rgb[2]);
+                    if (rgb.size() == 4) {
+                        config.color.a = static_cast<Uint8>(rgb[3]);
+                    }
+                }
+            }
+            config.additive = emitterJson.value("blend", "") == "add";
+            particleWidget->addEmitter(config);
+        }
+
+        std::string particleElementId = particleWidget->getUIElementIdentifier();
+        auto* particleElement = uiManager->findElementByName(particleElementId);
+        if (particleElement) {
+            applyElementProperties(particleElement, uiElement);
+        }
+
+        // 부모-자식 관계 설정
+        applyParentRelationship(particleElementId, uiElement);
+
+        addWidget(uiName, std::move(particleWidget));
+        return true;
+    }
     
     // 알 수 없는 위젯 타입
     Log::error("[WidgetManager] Unknown widget type: ", type, " for ", uiName);
@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <memory_resource>
 #include "../utils/sdl_includes.h"
 #include <nlohmann/json.hpp>
 #include "UIWidget.h"  // 같은 폴더
@@ -43,7 +44,7 @@ public:
     
     // 업데이트 및 렌더링
     void update(float deltaTime);
-    void handleEvents(const std::vector<SDL_Event>& events);
+    void handleEvents(const std::pmr::vector<SDL_Event>& events);
     void render(SDL_Renderer* renderer);  // 필요시 (대부분은 UIElement로 렌더링)
     
     // UiManager 접근 (위젯이 UIElement 제어할 때 필요)
@@ -7,25 +7,6 @@
 
 static const int BACKGROUND_PADDING = 8;
 
-// --- 헬퍼: 소스 텍스처를 영구 텍스처로 복사 (ResourceManager에 등록)
-static SDL_Texture* copyToPersistentTexture(SDL_Renderer* renderer, SDL_Texture* source,
-                                            int w, int h, ResourceManager* resMgr,
-                                            std::string& outTextureId) {
-    if (!source || w <= 0 || h <= 0) return nullptr;
-    SDL_Texture* dest = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
-                                          SDL_TEXTUREACCESS_TARGET, w, h);
-    if (!dest) return nullptr;
-    SDL_SetTextureBlendMode(dest, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-    SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-    SDL_SetRenderTarget(renderer, dest);
-    SDL_RenderClear(renderer);
-    SDL_RenderCopy(renderer, source, nullptr, nullptr);
-    SDL_SetRenderTarget(renderer, oldTarget);
-    outTextureId = resMgr->registerTexture(dest);
-    return dest;
-}
-
 BackgroundTextWidget::BackgroundTextWidget(UiManager* uiMgr, ResourceManager* resMgr,
                                            SDL_Renderer* sdlRenderer, TextRenderer* txtRenderer,
                                            const std::string& initialText, int size,
@@ -41,9 +22,7 @@ BackgroundTextWidget::BackgroundTextWidget(UiManager* uiMgr, ResourceManager* re
       useThreePatch(false),
       textElementId(""),
       backgroundElementId(""),
-      textTexture(nullptr),
       backgroundTexture(nullptr),
-      textTextureId(""),
       backgroundTextureId(""),
       wrapWidth(wrapW),
       maxHeight(maxH),
@@ -57,7 +36,6 @@ BackgroundTextWidget::BackgroundTextWidget(UiManager* uiMgr, ResourceManager* re
 BackgroundTextWidget::~BackgroundTextWidget() {
     if (!textElementId.empty()) uiManager->removeUI(textElementId);
     if (!backgroundElementId.empty()) uiManager->removeUI(backgroundElementId);
-    if (!textTextureId.empty() && resourceManager) resourceManager->unregisterTexture(textTextureId);
     if (!backgroundTextureId.empty() && resourceManager) resourceManager->unregisterTexture(backgroundTextureId);
 }
 
@@ -75,23 +53,19 @@ void BackgroundTextWidget::updateTextures() {
         if (!textElementId.empty()) { uiManager->removeUI(textElementId); textElementId = ""; }
         if (!backgroundElementId.empty()) { uiManager->removeUI(backgroundElementId); backgroundElementId = ""; }
     }
-    if (!textTextureId.empty()) {
-        resourceManager->unregisterTexture(textTextureId);
-        textTextureId = "";
-        textTexture = nullptr;
-    }
-    if (!backgroundTextureId.empty()) {
-        resourceManager->unregisterTexture(backgroundTextureId);
-        backgroundTextureId = "";
-        backgroundTexture = nullptr;
+    // 이전 배경은 새 배경을 만든 뒤 반환 (같은 공유 패치면 다시 굽지 않도록)
+    std::string previousBackgroundTextureId = backgroundTextureId;
+    backgroundTextureId = "";
+    backgroundTexture = nullptr;
+
+    // 2. 텍스트 레이아웃 (글리프 아틀라스, 텍스처 생성 없음). 빈 텍스트는 기존처럼 아무것도 표시하지 않음
+    TextRun textRun;
+    if (text.empty() || !textRenderer->layoutText(renderer, text, fontSize, wrapWidth, maxHeight, textRun, fontName)) {
+        if (!previousBackgroundTextureId.empty()) resourceManager->unregisterTexture(previousBackgroundTextureId);
+        return;
     }
-
-    // 2. 텍스트 크기 계산
-    textTexture = textRenderer->renderText(renderer, text, fontSize, textColor, wrapWidth, maxHeight);
-    if (!textTexture) return;
-    int textW, textH;
-    SDL_QueryTexture(textTexture, nullptr, nullptr, &textW, &textH);
-    textTextureId = resourceManager->registerTexture(textTexture);
+    int textW = textRun.width;
+    int textH = textRun.height;
 
     // 3. 배경 크기 및 텍스처 생성
     int bgW = (fixedBackgroundWidth > 0 && fixedBackgroundHeight > 0)
@@ -99,28 +73,24 @@ void BackgroundTextWidget::updateTextures() {
     int bgH = (fixedBackgroundWidth > 0 && fixedBackgroundHeight > 0)
         ? fixedBackgroundHeight : textH + BACKGROUND_PADDING * 2;
 
-    SDL_Texture* bgSrc = nullptr;
-    if (!backgroundImageName.empty()) {
-        SDL_Texture* base = resourceManager->getTexture(backgroundImageName);
-        if (base) {
-            if (useNinePatch) {
-                bgSrc = resourceManager->createNinePatchTexture(base, bgW, bgH);
-            } else if (useThreePatch) {
-                bgSrc = resourceManager->createThreePatchTexture(base, bgW, bgH);
-            } else {
-                ImageRenderer ir(renderer, bgW, bgH);
-                ir.drawImage(base, 0, 0, 0, 0, bgW, bgH);
-                bgSrc = ir.getTexture();
-            }
-        }
+    SDL_Surface* base = backgroundImageName.empty() ? nullptr : resourceManager->getSurface(backgroundImageName);
+    if (base && (useNinePatch || useThreePatch)) {
+        // 공유 패치 텍스처를 그대로 사용 (같은 크기 말풍선끼리 공유, 해제는 backgroundTextureId로)
+        PatchMode mode = useNinePatch ? PatchMode::Nine : PatchMode::Three;
+        backgroundTexture = resourceManager->acquirePatchTexture(backgroundImageName, bgW, bgH, mode, backgroundTextureId);
     }
-    if (!bgSrc) {
+    if (!backgroundTexture) {
+        // CPU에서 합성한 텍스처를 넘겨받아 등록 (렌더 타겟 복사 없음)
         ImageRenderer ir(renderer, bgW, bgH);
-        ir.drawColor(backgroundColor);
-        bgSrc = ir.getTexture();
+        if (base && !useNinePatch && !useThreePatch) {
+            ir.drawImage(base, 0, 0, 0, 0, bgW, bgH);
+        } else {
+            ir.drawColor(backgroundColor);
+        }
+        backgroundTexture = ir.takeTexture();
+        backgroundTextureId = backgroundTexture ? resourceManager->registerTexture(backgroundTexture) : "";
     }
-    backgroundTexture = copyToPersistentTexture(renderer, bgSrc, bgW, bgH, resourceManager, backgroundTextureId);
-    if ((useNinePatch || useThreePatch) && bgSrc) SDL_DestroyTexture(bgSrc);
+    if (!previousBackgroundTextureId.empty()) resourceManager->unregisterTexture(previousBackgroundTextureId);
 
     // 4. 위젯 위치 계산 (textAlign 기준)
     int posX = savedX, posY = savedY;
@@ -141,9 +111,9 @@ void BackgroundTextWidget::updateTextures() {
 
     UIElement txtEl;
     txtEl.name = "";
-    txtEl.texture = textTexture;
-    txtEl.textureId = textTextureId;
-    txtEl.rect = {BACKGROUND_PADDING, BACKGROUND_PADDING, textW, textH};
+    txtEl.setTextRun(std::move(textRun), textColor);
+    txtEl.rect.x = BACKGROUND_PADDING;
+    txtEl.rect.y = BACKGROUND_PADDING;
     txtEl.visible = true;
     txtEl.clickable = false;
     textElementId = uiManager->addUIAndGetId(txtEl);
@@ -162,6 +132,12 @@ void BackgroundTextWidget::setFontSize(int size) {
     updateTextures();
 }
 
+void BackgroundTextWidget::setFont(const std::string& name) {
+    if (fontName == name) return;
+    fontName = name;
+    updateTextures();
+}
+
 void BackgroundTextWidget::setTextColor(SDL_Color color) {
     if (textColor.r == color.r && textColor.g == color.g && textColor.b == color.b && textColor.a == color.a) return;
     textColor = color;
@@ -10,6 +10,7 @@ class BackgroundTextWidget : public UIWidget {
 private:
     std::string text;              // 현재 텍스트 내용
     int fontSize;                   // 폰트 크기
+    std::string fontName;           // 폰트 이름 (빈 문자열이면 기본 폰트)
     SDL_Color textColor;            // 텍스트 색상
     SDL_Color backgroundColor;      // 배경 색상
     std::string backgroundImageName; // 배경 이미지 이름 (빈 문자열이면 배경색 사용)
@@ -19,9 +20,7 @@ private:
     std::string textElementId;      // 텍스트 UIElement ID
     std::string backgroundElementId; // 배경 UIElement ID
     
-    SDL_Texture* textTexture;       // 텍스트 텍스처
-    SDL_Texture* backgroundTexture; // 배경 텍스처
-    std::string textTextureId;      // 텍스트 텍스처 ID
+    SDL_Texture* backgroundTexture; // 배경 텍스처 (텍스트는 글리프 쿼드라 텍스처 없음)
     std::string backgroundTextureId; // 배경 텍스처 ID
     
     // 텍스트 영역 크기 (wrapWidth, maxHeight)
@@ -57,6 +56,7 @@ public:
     
     // 스타일 변경
     void setFontSize(int size);
+    void setFont(const std::string& name);
     void setTextColor(SDL_Color color);
     void setBackgroundColor(SDL_Color color);
     void setBackgroundImage(const std::string& imageName, bool useNinePatch = false, bool useThreePatch = false);  // 배경 이미지 설정
@@ -66,6 +66,7 @@ public:
     void setMaxHeight(int height);
     
     int getFontSize() const { return fontSize; }
+    const std::string& getFont() const { return fontName; }
     SDL_Color getTextColor() const { return textColor; }
     SDL_Color getBackgroundColor() const { return backgroundColor; }
     
@@ -161,32 +161,18 @@ void BackgroundWidget::updateTexture() {
     }
 
     if (useColor) {
+        // CPU에서 채운 텍스처를 넘겨받아 등록 (렌더 타겟 복사 없음)
         ImageRenderer imageRenderer(renderer, width, height);
         imageRenderer.drawColor(backgroundColor);
-        SDL_Texture* baseTexture = imageRenderer.getTexture();
-
-        if (baseTexture) {
-            SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-            SDL_Texture* copiedTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
-                                                           SDL_TEXTUREACCESS_TARGET, width, height);
-            if (copiedTexture) {
-                SDL_SetRenderTarget(renderer, copiedTexture);
-                SDL_RenderCopy(renderer, baseTexture, nullptr, nullptr);
-                SDL_SetRenderTarget(renderer, oldTarget);
-                textureId = resourceManager->registerTexture(copiedTexture);
-                texture = copiedTexture;
-            } else {
-                SDL_SetRenderTarget(renderer, oldTarget);
-                Log::error("[BackgroundWidget] Failed to create target texture for color background");
-                return;
-            }
-        } else {
+        texture = imageRenderer.takeTexture();
+        if (!texture) {
             Log::error("[BackgroundWidget] Failed to create base texture for color background");
             return;
         }
+        textureId = resourceManager->registerTexture(texture);
     } else if (useImage) {
-        SDL_Texture* baseTexture = resourceManager->getTexture(imageName);
-        if (!baseTexture) {
+        SDL_Surface* baseSurface = resourceManager->getSurface(imageName);
+        if (!baseSurface) {
             Log::error("[BackgroundWidget] Texture not found: ", imageName);
             if (imageMode == BackgroundImageMode::SCROLL_H || imageMode == BackgroundImageMode::SCROLL_V) {
                 useImage = false;
@@ -197,44 +183,24 @@ void BackgroundWidget::updateTexture() {
             return;
         }
 
-        int imgW, imgH;
-        SDL_QueryTexture(baseTexture, nullptr, nullptr, &imgW, &imgH);
+        int imgW = baseSurface->w;
+        int imgH = baseSurface->h;
 
         if (imageMode == BackgroundImageMode::SCROLL_H || imageMode == BackgroundImageMode::SCROLL_V) {
             texture = nullptr;
             textureId = "";
             createScrollChild();
         } else {
-            SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-            SDL_Texture* targetTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
-                                                           SDL_TEXTUREACCESS_TARGET, width, height);
-            if (!targetTexture) {
-                SDL_SetRenderTarget(renderer, oldTarget);
-                Log::error("[BackgroundWidget] Failed to create target texture for image background");
-                return;
-            }
-            SDL_SetTextureBlendMode(targetTexture, SDL_BLENDMODE_BLEND);
-            SDL_SetRenderTarget(renderer, targetTexture);
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-            SDL_RenderClear(renderer);
+            // 원본 surface로 CPU 합성 후 업로드 한 번 (투명 배경에서 시작)
+            ImageRenderer imageRenderer(renderer, width, height);
+            imageRenderer.drawColor({0, 0, 0, 0});
 
             if (imageMode == BackgroundImageMode::STRETCH) {
-                SDL_Rect dstRect = {0, 0, width, height};
-                SDL_RenderCopy(renderer, baseTexture, nullptr, &dstRect);
+                imageRenderer.drawImageScaled(baseSurface, 0, 0, width, height);
             } else if (imageMode == BackgroundImageMode::TILE) {
                 for (int y = 0; y < height; y += imgH) {
                     for (int x = 0; x < width; x += imgW) {
-                        SDL_Rect dstRect = {x, y, imgW, imgH};
-                        SDL_Rect srcRect = {0, 0, imgW, imgH};
-                        if (x + imgW > width) {
-                            srcRect.w = width - x;
-                            dstRect.w = width - x;
-                        }
-                        if (y + imgH > height) {
-                            srcRect.h = height - y;
-                            dstRect.h = height - y;
-                        }
-                        SDL_RenderCopy(renderer, baseTexture, &srcRect, &dstRect);
+                        imageRenderer.drawImage(baseSurface, x, y, 0, 0, std::min(imgW, width - x), std::min(imgH, height - y));
                     }
                 }
             } else if (imageMode == BackgroundImageMode::FIT) {
@@ -245,32 +211,22 @@ void BackgroundWidget::updateTexture() {
                 int scaledH = static_cast<int>(imgH * scale);
                 int offsetX = (width - scaledW) / 2;
                 int offsetY = (height - scaledH) / 2;
-                SDL_Rect dstRect = {offsetX, offsetY, scaledW, scaledH};
-                SDL_RenderCopy(renderer, baseTexture, nullptr, &dstRect);
+                imageRenderer.drawImageScaled(baseSurface, offsetX, offsetY, scaledW, scaledH);
             }
 
-            SDL_SetRenderTarget(renderer, oldTarget);
-            textureId = resourceManager->registerTexture(targetTexture);
-            texture = targetTexture;
+            texture = imageRenderer.takeTexture();
+            if (!texture) {
+                Log::error("[BackgroundWidget] Failed to create texture for image background");
+                return;
+            }
+            textureId = resourceManager->registerTexture(texture);
         }
     } else {
         ImageRenderer imageRenderer(renderer, width, height);
         imageRenderer.drawColor({0, 0, 0, 0});
-        SDL_Texture* baseTexture = imageRenderer.getTexture();
-
-        if (baseTexture) {
-            SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-            SDL_Texture* copiedTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
-                                                           SDL_TEXTUREACCESS_TARGET, width, height);
-            if (copiedTexture) {
-                SDL_SetRenderTarget(renderer, copiedTexture);
-                SDL_RenderCopy(renderer, baseTexture, nullptr, nullptr);
-                SDL_SetRenderTarget(renderer, oldTarget);
-                textureId = resourceManager->registerTexture(copiedTexture);
-                texture = copiedTexture;
-            } else {
-                SDL_SetRenderTarget(renderer, oldTarget);
-            }
+        texture = imageRenderer.takeTexture();
+        if (texture) {
+            textureId = resourceManager->registerTexture(texture);
         }
     }
 
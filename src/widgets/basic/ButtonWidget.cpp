@@ -51,6 +51,10 @@ ButtonWidget::ButtonWidget(UiManager* uiMgr, ResourceManager* resMgr,
 }
 
 ButtonWidget::~ButtonWidget() {
+    if (!pendingTextTextureId.empty() && resourceManager) {
+        resourceManager->unregisterTexture(pendingTextTextureId);
+        pendingTextTextureId.clear();
+    }
     if (!iconElementId.empty() && uiManager) {
         uiManager->removeUI(iconElementId);
         iconElementId.clear();
@@ -103,6 +107,12 @@ void ButtonWidget::setFontSize(int size) {
     updateTexture();
 }
 
+void ButtonWidget::setFont(const std::string& name) {
+    if (fontName == name) return;
+    fontName = name;
+    updateTexture();
+}
+
 void ButtonWidget::setTextColor(SDL_Color color) {
     if (textColor.r == color.r && textColor.g == color.g && 
         textColor.b == color.b && textColor.a == color.a) {
@@ -112,9 +122,55 @@ void ButtonWidget::setTextColor(SDL_Color color) {
     updateTexture();
 }
 
+void ButtonWidget::update(float deltaTime) {
+    if (pendingTextTextureId.empty()) {
+        return;
+    }
+    if (resourceManager->findTextTexture(pendingTextTextureId)) {
+        updateTexture();
+    } else if (!resourceManager->isTextPending(pendingTextTextureId)) {
+        // 래스터화 실패: 더 기다리지 않고 배경만 구움
+        resourceManager->unregisterTexture(pendingTextTextureId);
+        pendingTextTextureId.clear();
+        bakeTexture(nullptr);
+    }
+}
+
 void ButtonWidget::updateTexture() {
     if (uiElementId.empty()) return;
     
+    // 텍스트 텍스처 (ResourceManager 텍스트 캐시). 아직 래스터화 중이면 이전 텍스처를 그대로 두고 update()에서 다시 굽기
+    // 배경에 구워 넣으므로 CPU 사본(surface)도 보관하도록 요청
+    SDL_Texture* textTexture = nullptr;
+    std::string textTextureId;
+    if (!buttonText.empty() && textRenderer && renderer) {
+        textTexture = resourceManager->requestTextTexture(textRenderer, buttonText, fontSize, textColor,
+                                                          0, -1, fontName, textTextureId, true);
+    }
+    // 이전 요청은 새 요청 뒤에 반납 (같은 키면 취소되지 않도록)
+    if (!pendingTextTextureId.empty()) {
+        resourceManager->unregisterTexture(pendingTextTextureId);
+        pendingTextTextureId.clear();
+    }
+    if (!textTexture && !textTextureId.empty()) {
+        pendingTextTextureId = textTextureId;
+        textTextureId.clear();
+        auto* shown = uiManager->findElementByName(uiElementId);
+        if (shown && shown->texture) {
+            return;
+        }
+        // 처음 그리는 중이면 텍스트 없이 배경만 먼저 표시
+    }
+    
+    bakeTexture(textTexture ? resourceManager->getSurface(textTextureId) : nullptr);
+    
+    // 구운 뒤 텍스트 텍스처 반납 (참조 0이면 텍스트 캐시에 보관되어 같은 문구는 다시 래스터화하지 않음)
+    if (!textTextureId.empty()) {
+        resourceManager->unregisterTexture(textTextureId);
+    }
+}
+
+void ButtonWidget::bakeTexture(SDL_Surface* textSurface) {
     // 기존 텍스처 해제
     if (!currentTextureId.empty()) {
         resourceManager->unregisterTexture(currentTextureId);
@@ -140,44 +196,25 @@ void ButtonWidget::updateTexture() {
         return;
     }
     
-    // 원본 텍스처 가져오기
-    SDL_Texture* baseTexture = resourceManager->getTexture(imageName);
-    if (!baseTexture) {
-        Log::error("[ButtonWidget] Base texture not found: ", imageName);
-        uiManager->changeTexture(uiElementId, imageName);
-        return;
-    }
-    
     Log::info("[ButtonWidget] Image name: ", imageName, ", useNinePatch: ", useNinePatch ? "true" : "false",
               ", useThreePatch: ", useThreePatch ? "true" : "false", ", button size: ", buttonWidth, "x", buttonHeight);
     
-    SDL_Texture* backgroundTexture = nullptr;
     bool usePatch = useNinePatch || useThreePatch;
-    
-    if (useNinePatch) {
-        backgroundTexture = resourceManager->createNinePatchTexture(baseTexture, buttonWidth, buttonHeight);
-        if (!backgroundTexture) {
-            Log::error("[ButtonWidget] Failed to create nine-patch texture for: ", imageName);
-            uiManager->changeTexture(uiElementId, imageName);
-            return;
-        }
-        Log::info("[ButtonWidget] Nine-patch texture created successfully");
-    } else if (useThreePatch) {
-        backgroundTexture = resourceManager->createThreePatchTexture(baseTexture, buttonWidth, buttonHeight);
-        if (!backgroundTexture) {
-            Log::error("[ButtonWidget] Failed to create three-patch texture for: ", imageName);
-            uiManager->changeTexture(uiElementId, imageName);
-            return;
-        }
-        Log::info("[ButtonWidget] Three-patch texture created successfully");
-    }
+    PatchMode mode = useNinePatch ? PatchMode::Nine : PatchMode::Three;
     
     // 텍스트가 없으면 배경만 사용
-    if (buttonText.empty() || !textRenderer || !renderer) {
-        if (usePatch && backgroundTexture) {
-            // 9패치 텍스처 등록
-            currentTextureId = resourceManager->registerTexture(backgroundTexture);
-            element->texture = backgroundTexture;
+    if (!textSurface) {
+        if (usePatch) {
+            // 공유 패치 텍스처를 그대로 사용 (같은 이미지·크기 버튼끼리 공유)
+            std::string patchTextureId;
+            SDL_Texture* patchTexture = resourceManager->acquirePatchTexture(imageName, buttonWidth, buttonHeight, mode, patchTextureId);
+            if (!patchTexture) {
+                Log::error("[ButtonWidget] Failed to create ", (useNinePatch ? "nine" : "three"), "-patch texture for: ", imageName);
+                uiManager->changeTexture(uiElementId, imageName);
+                return;
+            }
+            currentTextureId = patchTextureId;
+            element->texture = patchTexture;
             element->textureId = currentTextureId;
         } else {
             uiManager->changeTexture(uiElementId, imageName);
@@ -185,84 +222,49 @@ void ButtonWidget::updateTexture() {
         return;
     }
     
-    // ImageRenderer를 사용해 이미지 위에 텍스트 그리기
+    // 배경 원본 surface (텍스처와 같은 픽셀의 CPU 사본, 렌더 타겟 읽기 없음)
+    SDL_Surface* baseSurface = resourceManager->getSurface(imageName);
+    if (!baseSurface) {
+        Log::error("[ButtonWidget] Base image not found: ", imageName);
+        uiManager->changeTexture(uiElementId, imageName);
+        return;
+    }
+    
+    // ImageRenderer를 사용해 이미지 위에 텍스트 그리기 (전부 CPU 합성 후 업로드 한 번)
     ImageRenderer imageRenderer(renderer, buttonWidth, buttonHeight);
     
-    if (usePatch && backgroundTexture) {
-        // 패치 텍스처를 ImageRenderer에 그리기 (이미 버튼 크기로 생성됨)
-        // drawImage를 사용하면 needsUpdate가 자동으로 설정됨
-        int texW, texH;
-        SDL_QueryTexture(backgroundTexture, nullptr, nullptr, &texW, &texH);
-        // 전체 텍스처를 그리기 (이미 버튼 크기로 생성되었으므로)
-        imageRenderer.drawImage(backgroundTexture, 0, 0, 0, 0, texW, texH);
+    if (usePatch) {
+        imageRenderer.drawPatch(baseSurface, mode, 0, 0, buttonWidth, buttonHeight);
     } else {
-        // 일반 이미지를 ImageRenderer에 그리기 (전체 텍스처를 버튼 크기로 스케일하여 채우기)
-        int texW, texH;
-        SDL_QueryTexture(baseTexture, nullptr, nullptr, &texW, &texH);
-        imageRenderer.drawImageScaled(baseTexture, 0, 0, buttonWidth, buttonHeight, 0, 0, texW, texH);
+        // 일반 이미지를 버튼 크기로 스케일하여 채우기
+        imageRenderer.drawImageScaled(baseSurface, 0, 0, buttonWidth, buttonHeight);
     }
     
     // 텍스트: 아이콘 있으면 아이콘 오른쪽부터, 없으면 가운데 정렬
     int textX = 0, textY = 0;
-    int textW = 0, textH = 0;
-    if (textRenderer->getTextSize(buttonText, fontSize, &textW, &textH)) {
-        if (!iconImageName.empty() && iconDisplayW > 0) {
-            textX = iconPadding + iconDisplayW + iconTextSpacing;
-            textY = (buttonHeight - textH) / 2;
-        } else {
-            textX = (buttonWidth - textW) / 2;
-            textY = (buttonHeight - textH) / 2;
-        }
+    int textW = textSurface->w, textH = textSurface->h;
+    if (!iconImageName.empty() && iconDisplayW > 0) {
+        textX = iconPadding + iconDisplayW + iconTextSpacing;
+        textY = (buttonHeight - textH) / 2;
+    } else {
+        textX = (buttonWidth - textW) / 2;
+        textY = (buttonHeight - textH) / 2;
     }
     if (textX < 0) textX = 0;
     if (textY < 0) textY = 0;
     
-    imageRenderer.drawText(buttonText, textX, textY, fontSize, textColor, textRenderer);
+    imageRenderer.drawImage(textSurface, textX, textY);
     
-    // 최종 텍스처 가져오기
-    SDL_Texture* finalTexture = imageRenderer.getTexture();
+    // 최종 텍스처 (ImageRenderer에서 소유권을 넘겨받으므로 복사 없음)
+    SDL_Texture* finalTexture = imageRenderer.takeTexture();
     if (finalTexture) {
-        // 텍스처를 복사해서 ResourceManager에 등록 (ImageRenderer가 소유하므로)
-        // 텍스처 복사 (ImageRenderer가 소유하므로)
-        int texW, texH;
-        SDL_QueryTexture(finalTexture, nullptr, nullptr, &texW, &texH);
-        SDL_Texture* copiedTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, texW, texH);
-        if (copiedTexture) {
-            // 투명도 유지를 위한 블렌딩 모드 설정
-            SDL_SetTextureBlendMode(copiedTexture, SDL_BLENDMODE_BLEND);
-            
-            SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-            SDL_SetRenderTarget(renderer, copiedTexture);
-            
-            // 투명색으로 클리어 (투명도 유지)
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-            SDL_RenderClear(renderer);
-            
-            SDL_RenderCopy(renderer, finalTexture, nullptr, nullptr);
-            SDL_SetRenderTarget(renderer, oldTarget);
-            
-            // ResourceManager에 등록 (자동 ID 생성)
-            currentTextureId = resourceManager->registerTexture(copiedTexture);
-            
-            // UIElement의 텍스처 변경
-            element->texture = copiedTexture;
-            element->textureId = currentTextureId;  // 텍스처 ID 설정
-            
-            // 패치 배경 텍스처는 ImageRenderer에 그려졌으므로 더 이상 필요 없음
-            if (usePatch && backgroundTexture) {
-                SDL_DestroyTexture(backgroundTexture);
-                backgroundTexture = nullptr;
-            }
-        } else {
-            if (usePatch && backgroundTexture) {
-                SDL_DestroyTexture(backgroundTexture);
-            }
-            uiManager->changeTexture(uiElementId, imageName);
-        }
+        // ResourceManager에 등록 (자동 ID 생성)
+        currentTextureId = resourceManager->registerTexture(finalTexture);
+        
+        // UIElement의 텍스처 변경
+        element->texture = finalTexture;
+        element->textureId = currentTextureId;  // 텍스처 ID 설정
     } else {
-        if (usePatch && backgroundTexture) {
-            SDL_DestroyTexture(backgroundTexture);
-        }
         uiManager->changeTexture(uiElementId, imageName);
     }
 }
@@ -25,6 +25,7 @@ private:
     // 텍스트 관련
     std::string buttonText;        // 버튼에 표시할 텍스트
     int fontSize;                   // 폰트 크기
+    std::string fontName;           // 폰트 이름 (빈 문자열이면 기본 폰트)
     SDL_Color textColor;            // 텍스트 색상
     
     State state;
@@ -43,6 +44,8 @@ private:
     
     // 현재 텍스처 ID (해제용)
     std::string currentTextureId;
+    // 워커에서 래스터화 중인 텍스트 텍스처 ID. 업로드되면 update()에서 다시 굽고, 그동안 이전 텍스처 유지
+    std::string pendingTextTextureId;
     
     // Renderer들
     SDL_Renderer* renderer;
@@ -70,6 +73,7 @@ public:
     void setText(const std::string& text);
     const std::string& getText() const { return buttonText; }
     void setFontSize(int size);
+    void setFont(const std::string& name);
     void setTextColor(SDL_Color color);
     
     // 이미지 설정 (useNinePatch 우선, 그다음 useThreePatch)
@@ -83,11 +87,13 @@ public:
     bool canReceiveClick() const override { return state != DISABLED; }
     void onClick() override;  // 클릭 완료 시 호출
     void handleEvent(const SDL_Event& event) override;  // 마우스 이벤트 처리
+    void update(float deltaTime) override;  // 비동기 텍스트 업로드 완료 확인
     
 private:
     bool isMouseDown = false;  // 마우스 상태 추적용
     bool wasClickableOnMouseDown = false;  // mouse_down 시점에 클릭 가능했는지 (애니메이션으로 작아져도 클릭 처리)
     void updateTexture();       // 상태에 따라 UIElement의 texture 변경 (이미지 + 텍스트)
+    void bakeTexture(SDL_Surface* textSurface);  // 배경 + 텍스트를 CPU에서 구워 UIElement에 설정 (textSurface가 없으면 배경만)
     void updateIconElement();   // 아이콘 UIElement 생성/위치 갱신 (setIcon, setRect에서 호출)
 };
 
@@ -20,7 +20,8 @@ EditTextWidget::EditTextWidget(UiManager* uiMgr, ResourceManager* resMgr,
       renderer(sdlRenderer),
       textRenderer(txtRenderer),
       textTexture(nullptr),
-      currentTextureName(""),
+      cursorRect{0, 0, 0, 0},
+      cursorUnderlay(nullptr),
       maxLength(maxLen),
       multiline(multiLine),
       textColor(textColor),
@@ -47,11 +48,10 @@ EditTextWidget::EditTextWidget(UiManager* uiMgr, ResourceManager* resMgr,
 }
 
 EditTextWidget::~EditTextWidget() {
-    // ResourceManager에 텍스처 해제 요청
-    if (!currentTextureName.empty() && resourceManager) {
-        resourceManager->unregisterTexture(currentTextureName);
-        currentTextureName = "";
-        textTexture = nullptr;
+    releaseCanvasTexture();
+    if (cursorUnderlay) {
+        SDL_FreeSurface(cursorUnderlay);
+        cursorUnderlay = nullptr;
     }
     
     // SDL 텍스트 입력 모드 종료
@@ -151,7 +151,13 @@ void EditTextWidget::updateCursorBlink(float deltaTime) {
     if (cursorBlinkTimer >= blinkInterval) {
         cursorBlinkTimer = 0.0f;
         showCursor = !showCursor;
-        updateTexture();  // 커서 표시 업데이트
+        if (canvas) {
+            // 텍스트는 그대로이므로 커서 영역(2px 세로줄)만 다시 그리고 업로드
+            drawCursor();
+            publishTexture();
+        } else {
+            updateTexture();
+        }
     }
 }
 
@@ -238,8 +244,12 @@ void EditTextWidget::updateTexture() {
     textRect.w = widgetW - padding * 2;
     textRect.h = widgetH - padding * 2;
     
-    // ImageRenderer로 배경 + 텍스트 + 커서 그리기
-    ImageRenderer imageRenderer(renderer, widgetW, widgetH);
+    // ImageRenderer로 배경 + 텍스트 + 커서 그리기 (같은 크기면 canvas와 텍스처를 재사용)
+    if (!canvas || canvas->getWidth() != widgetW || canvas->getHeight() != widgetH) {
+        releaseCanvasTexture();
+        canvas = std::make_unique<ImageRenderer>(renderer, widgetW, widgetH);
+    }
+    ImageRenderer& imageRenderer = *canvas;
     
     // 배경 그리기
     imageRenderer.drawRect(0, 0, widgetW, widgetH, backgroundColor, true);
@@ -274,57 +284,102 @@ void EditTextWidget::updateTexture() {
         imageRenderer.drawText(displayText, textRect.x, textRect.y, fontSize, displayColor, textRenderer, textRect.w);
     }
     
+    // 커서 위치: 커서 앞 문자열(현재 줄)의 폭을 drawText와 같은 폰트/크기로 측정 (TTF_SizeUTF8)
+    int cursorX = textRect.x;
+    if (cursorPosition > 0 && textRenderer) {
+        std::string prefix = text.substr(0, cursorPosition);
+        size_t lineStart = prefix.rfind('\n');
+        if (lineStart != std::string::npos) {
+            prefix.erase(0, lineStart + 1);
+        }
+        int prefixW = 0;
+        int prefixH = 0;
+        if (textRenderer->getTextSize(prefix, fontSize, &prefixW, &prefixH)) {
+            cursorX += prefixW;
+        }
+    }
+    cursorRect = {std::max(0, std::min(cursorX, widgetW - 2)), textRect.y, 2, std::max(0, textRect.h)};
+    
+    // 커서 아래 픽셀 보관 (깜빡임 때 되돌리기용, 알파까지 그대로 복사)
+    if (cursorUnderlay && cursorUnderlay->h != cursorRect.h) {
+        SDL_FreeSurface(cursorUnderlay);
+        cursorUnderlay = nullptr;
+    }
+    if (!cursorUnderlay && cursorRect.h > 0) {
+        cursorUnderlay = SDL_CreateRGBSurfaceWithFormat(0, cursorRect.w, cursorRect.h, 32, SDL_PIXELFORMAT_RGBA32);
+        if (cursorUnderlay) {
+            SDL_SetSurfaceBlendMode(cursorUnderlay, SDL_BLENDMODE_NONE);
+        }
+    }
+    if (cursorUnderlay) {
+        SDL_Surface* canvasSurface = imageRenderer.getSurface();
+        SDL_Rect srcRect = cursorRect;
+        SDL_SetSurfaceBlendMode(canvasSurface, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(canvasSurface, &srcRect, cursorUnderlay, nullptr);
+        SDL_SetSurfaceBlendMode(canvasSurface, SDL_BLENDMODE_BLEND);
+    }
+    
     // 커서 그리기 (포커스가 있고 깜빡임 상태일 때)
     if (hasFocus && showCursor) {
-        // 커서 위치 계산 (간단하게 텍스트 끝에 표시)
-        // TODO: 실제 커서 위치 계산 (폰트 메트릭 사용)
-        int cursorX = textRect.x;
-        if (!text.empty()) {
-            // 간단한 근사치 (실제로는 폰트 메트릭 필요)
-            cursorX = textRect.x + static_cast<int>(text.length() * fontSize * 0.6f);
-        }
-        
+        drawCursor();
+    }
+    
+    publishTexture();
+}
+
+void EditTextWidget::drawCursor() {
+    if (!canvas || cursorRect.h <= 0) return;
+    
+    if (hasFocus && showCursor) {
         // 커서 세로선 그리기
-        SDL_Color cursorColor = textColor;
-        imageRenderer.drawRect(cursorX, textRect.y, 2, textRect.h, cursorColor, true);
+        canvas->drawRect(cursorRect.x, cursorRect.y, cursorRect.w, cursorRect.h, textColor, true);
+    } else if (cursorUnderlay) {
+        canvas->drawImage(cursorUnderlay, cursorRect.x, cursorRect.y);
     }
+}
+
+void EditTextWidget::publishTexture() {
+    auto* element = uiManager->findElementByName(uiElementId);
+    if (!element || !canvas) return;
     
-    // 최종 텍스처 가져오기
-    SDL_Texture* compositeTexture = imageRenderer.getTexture();
-    if (compositeTexture) {
-        // 기존 텍스처 해제
-        if (!currentTextureName.empty()) {
-            resourceManager->unregisterTexture(currentTextureName);
-            currentTextureName = "";
+    // 바뀐 영역만 업로드됨. 텍스처는 canvas가 바뀔 때(크기 변경)만 새로 만들어짐
+    SDL_Texture* texture = canvas->getTexture();
+    if (!texture) {
+        Log::error("[EditTextWidget] Failed to create texture: ", SDL_GetError());
+        return;
+    }
+    if (texture != textTexture) {
+        // 새 canvas 텍스처 (크기 변경 시에만): 한 번 등록해서 동적 텍스처 메모리에 집계
+        canvasTextureId = resourceManager->registerTexture(texture);
+        textTexture = texture;
+    }
+    if (texture != element->texture) {
+        TextureRegion region;
+        region.texture = texture;
+        region.rect = {0, 0, canvas->getWidth(), canvas->getHeight()};
+        element->setTextureRegion(region);
+        element->textureId = canvasTextureId;
+    }
+}
+
+void EditTextWidget::releaseCanvasTexture() {
+    if (textTexture && uiManager) {
+        if (auto* element = uiManager->findElementByName(uiElementId)) {
+            if (element->texture == textTexture) {
+                element->texture = nullptr;
+                element->textureId = "";
+            }
         }
-        
-        // 텍스처를 복사하여 등록 (ImageRenderer가 파괴되면 원본 텍스처도 파괴되므로)
-        // 텍스처 속성 가져오기
-        int texW, texH;
-        Uint32 format;
-        int access;
-        SDL_QueryTexture(compositeTexture, &format, &access, &texW, &texH);
-        
-        // 새 텍스처 생성 (복사본)
-        SDL_Texture* copiedTexture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, texW, texH);
-        if (copiedTexture) {
-            // 원본을 복사본으로 복사
-            SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-            SDL_SetRenderTarget(renderer, copiedTexture);
-            SDL_RenderClear(renderer);
-            SDL_RenderCopy(renderer, compositeTexture, nullptr, nullptr);
-            SDL_SetRenderTarget(renderer, oldTarget);
-            
-            // 복사본 등록 (자동 ID 생성)
-            currentTextureName = resourceManager->registerTexture(copiedTexture);
-            textTexture = copiedTexture;
-            
-            // UIElement 업데이트 (uiElementId 사용)
-            uiManager->changeTextureById(uiElementId, currentTextureName);
-        } else {
-            Log::error("[EditTextWidget] Failed to copy texture: ", SDL_GetError());
+    }
+    if (!canvasTextureId.empty()) {
+        // 삭제는 ResourceManager가 하므로 canvas에서 떼어 낸 뒤 반납 (마지막 참조에서 삭제)
+        if (canvas) {
+            canvas->takeTexture();
         }
+        resourceManager->unregisterTexture(canvasTextureId);
+        canvasTextureId.clear();
     }
+    textTexture = nullptr;
 }
 
 void EditTextWidget::render(SDL_Renderer* renderer) {
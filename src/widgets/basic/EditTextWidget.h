@@ -1,5 +1,6 @@
 #pragma once
 #include "../UIWidget.h"
+#include <memory>
 #include <string>
 #include "../../utils/sdl_includes.h"
 
@@ -18,8 +19,11 @@ private:
     // 렌더링 관련
     SDL_Renderer* renderer;
     TextRenderer* textRenderer;
-    SDL_Texture* textTexture;      // 현재 텍스트 텍스처
-    std::string currentTextureName; // ResourceManager에 등록된 텍스처 이름
+    SDL_Texture* textTexture;      // 현재 canvas 텍스처 (ResourceManager에 등록, 내용은 canvas가 갱신)
+    std::string canvasTextureId;   // textTexture의 ResourceManager ID (동적 텍스처 메모리 집계)
+    std::unique_ptr<ImageRenderer> canvas;  // 배경 + 텍스트 + 커서 (크기가 같으면 재사용, 바뀐 영역만 업로드)
+    SDL_Rect cursorRect;           // canvas에서 커서가 그려지는 영역
+    SDL_Surface* cursorUnderlay;   // 커서 아래 원래 픽셀 (깜빡임 때 커서 영역만 되돌려 그림)
     
     // 설정
     int maxLength;                 // 최대 길이 (0이면 무제한)
@@ -35,6 +39,9 @@ private:
     std::string uiElementId;        // UIElement ID (UiManager가 생성한 자동 ID)
     
     void updateCursorBlink(float deltaTime);  // 커서 깜빡임 업데이트
+    void drawCursor();                        // 커서 영역만 다시 그림 (showCursor에 따라 커서 또는 원래 픽셀)
+    void publishTexture();                    // canvas 텍스처를 UIElement에 반영
+    void releaseCanvasTexture();              // UIElement에서 떼고 ResourceManager에 반납 (canvas 교체/소멸 전)
     
     // UIWidget 오버라이드
     std::string getUIElementIdentifier() const override { return uiElementId; }
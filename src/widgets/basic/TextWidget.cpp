@@ -11,8 +11,6 @@ TextWidget::TextWidget(UiManager* uiMgr, ResourceManager* resMgr,
       text(initialText),
       fontSize(size),
       textColor(color),
-      currentTexture(nullptr),
-      currentTextureName(""),
       uiElementId(""),
       wrapWidth(wrapW),
       maxHeight(maxH),
@@ -21,49 +19,25 @@ TextWidget::TextWidget(UiManager* uiMgr, ResourceManager* resMgr,
       renderer(sdlRenderer),
       textRenderer(txtRenderer) {
     
-    // 초기 텍스처 생성
+    // 초기 레이아웃
     updateTexture();
 }
 
 TextWidget::~TextWidget() {
-    // ResourceManager에 텍스처 해제 요청 (참조 카운팅으로 관리)
-    if (!currentTextureName.empty() && resourceManager) {
-        resourceManager->unregisterTexture(currentTextureName);
-        currentTextureName = "";
-        currentTexture = nullptr;
-        
-        // UIElement에서 참조 제거 (안전하게)
-        if (uiManager && !uiElementId.empty()) {
-            auto* element = uiManager->findElementByName(uiElementId);
-            if (element && element->texture == currentTexture) {
-                element->texture = nullptr;
-            }
-        }
-    }
+    // 글리프 쿼드만 들고 있으므로 해제할 텍스처 없음 (글리프 페이지는 TextRenderer 소유)
 }
 
 void TextWidget::updateTexture() {
-    // 기존 텍스처 해제 요청
-    if (!currentTextureName.empty()) {
-        resourceManager->unregisterTexture(currentTextureName);
-        currentTextureName = "";
-        currentTexture = nullptr;
-    }
-    
-    // 텍스트는 항상 개별 텍스처로 생성 (캐싱 없음)
-    currentTexture = textRenderer->renderText(renderer, text, fontSize, textColor, wrapWidth, maxHeight);
-    
-    // ResourceManager에 등록 (자동 ID 생성, 이름 지정 없음)
-    // currentTexture가 nullptr이면 빈 문자열 반환되고, UIElement의 texture도 nullptr이 됨 (렌더링만 스킵)
-    currentTextureName = resourceManager->registerTexture(currentTexture);
+    // 글리프 아틀라스로 레이아웃만 다시 계산 (매 프레임 바뀌는 점수 라벨도 텍스처 할당 없음)
+    TextRun run;
+    textRenderer->layoutText(renderer, text, fontSize, wrapWidth, maxHeight, run, fontName, distanceField);
     
     // UIElement 찾기 또는 생성
     if (uiElementId.empty()) {
         // 처음 생성: UiManager가 ID 생성
         UIElement newElement;
         newElement.name = "";  // 빈 문자열로 전달하면 자동 ID 생성
-        newElement.texture = currentTexture;
-        newElement.textureId = currentTextureName;  // 텍스처 ID 설정
+        newElement.texture = nullptr;
         newElement.rect = SDL_Rect{0, 0, 0, 0};  // 나중에 WidgetManager에서 설정됨
         newElement.visible = true;
         uiElementId = uiManager->addUIAndGetId(newElement);  // ID 저장
@@ -71,13 +45,9 @@ void TextWidget::updateTexture() {
     
     auto* element = uiManager->findElementByName(uiElementId);
     if (element) {
-        element->texture = currentTexture;
-        element->textureId = currentTextureName;  // 텍스처 ID 업데이트
-        
-        int w, h;
-        SDL_QueryTexture(currentTexture, nullptr, nullptr, &w, &h);
-        element->rect.w = w;
-        element->rect.h = h;
+        element->setTextRun(std::move(run), textColor);
+        element->textureId = "";
+        int w = element->rect.w;
         
         // 컨테이너가 지정된 경우 정렬에 따라 위치 설정
         if (containerRect.w >= 0) {
@@ -106,6 +76,13 @@ void TextWidget::setFontSize(int size) {
     updateTexture();
 }
 
+void TextWidget::setFont(const std::string& name) {
+    if (fontName == name) return;
+    
+    fontName = name;
+    updateTexture();
+}
+
 void TextWidget::setTextColor(SDL_Color color) {
     if (textColor.r == color.r && textColor.g == color.g && 
         textColor.b == color.b && textColor.a == color.a) {
@@ -113,7 +90,10 @@ void TextWidget::setTextColor(SDL_Color color) {
     }
     
     textColor = color;
-    updateTexture();
+    // 글자색은 정점 색이므로 레이아웃을 다시 할 필요 없음
+    if (auto* element = uiManager->findElementByName(uiElementId)) {
+        element->tint = textColor;
+    }
 }
 
 void TextWidget::setWrapWidth(int width) {
@@ -130,3 +110,10 @@ void TextWidget::setMaxHeight(int height) {
     updateTexture();
 }
 
+void TextWidget::setDistanceField(bool enabled) {
+    if (distanceField == enabled) return;
+    
+    distanceField = enabled;
+    updateTexture();
+}
+
@@ -9,9 +9,9 @@ class TextWidget : public UIWidget {
 private:
     std::string text;              // 현재 텍스트 내용
     int fontSize;                   // 폰트 크기
+    std::string fontName;           // 폰트 이름 (빈 문자열이면 기본 폰트)
     SDL_Color textColor;            // 텍스트 색상
-    SDL_Texture* currentTexture;    // 현재 텍스처 포인터 (ResourceManager에서 관리)
-    std::string currentTextureName; // 현재 텍스처 이름 (ResourceManager 해제용)
+    bool distanceField = false;     // 거리장 글리프 사용 (스케일 애니메이션용, JSON "sdf")
     std::string uiElementId;        // UIElement ID (UiManager가 생성한 자동 ID)
     
     // 텍스트 영역 크기 (wrapWidth, maxHeight)
@@ -21,7 +21,7 @@ private:
     // 정렬 및 컨테이너 영역 (textAlign "center" 시 컨테이너 내 가로 가운데)
     std::string textAlign;
     SDL_Rect containerRect;  // x,y,w,h. w<0 이면 미사용
-    void updateTexture();  // 텍스트 변경 시 텍스처 재생성
+    void updateTexture();  // 텍스트 변경 시 글리프 레이아웃 다시 계산 (텍스처 생성 없음)
     
     // UIWidget 오버라이드
     std::string getUIElementIdentifier() const override { return uiElementId; }
@@ -45,12 +45,16 @@ public:
     
     // 스타일 변경
     void setFontSize(int size);
+    void setFont(const std::string& name);
     void setTextColor(SDL_Color color);
     void setWrapWidth(int width);
     void setMaxHeight(int height);
+    void setDistanceField(bool enabled);  // 켜면 setFontSize/스케일 변경이 래스터화 없이 배율만 바꿈
     
     int getFontSize() const { return fontSize; }
+    const std::string& getFont() const { return fontName; }
     SDL_Color getTextColor() const { return textColor; }
+    bool isDistanceField() const { return distanceField; }
     
     // UIElement ID 반환
     std::string getUIElementId() const { return uiElementId; }
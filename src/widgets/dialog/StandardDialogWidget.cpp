@@ -61,29 +61,11 @@ void StandardDialogWidget::createBackgroundElement() {
     ImageRenderer imageRenderer(renderer, bgWidth, bgHeight);
     imageRenderer.drawColor(SDL_Color{255, 255, 255, 255});  // 흰색 배경
     
-    SDL_Texture* bgTexture = imageRenderer.getTexture();
+    SDL_Texture* bgTexture = imageRenderer.takeTexture();  // 소유권을 넘겨받아 그대로 등록 (복사 없음)
     if (bgTexture) {
-        // 텍스처를 복사하여 등록 (ImageRenderer가 소유하므로)
-        int texW, texH;
-        Uint32 format;
-        int access;
-        SDL_QueryTexture(bgTexture, &format, &access, &texW, &texH);
-        
-        SDL_Texture* copiedTexture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, texW, texH);
-        if (copiedTexture) {
-            SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-            SDL_SetRenderTarget(renderer, copiedTexture);
-            SDL_RenderClear(renderer);
-            SDL_RenderCopy(renderer, bgTexture, nullptr, nullptr);
-            SDL_SetRenderTarget(renderer, oldTarget);
-            
-            std::string textureId = resourceManager->registerTexture(copiedTexture);
-            bgElement.texture = copiedTexture;
-            bgElement.textureId = textureId;
-        } else {
-            bgElement.texture = nullptr;
-            Log::error("[StandardDialogWidget] Failed to copy background texture: ", SDL_GetError());
-        }
+        std::string textureId = resourceManager->registerTexture(bgTexture);
+        bgElement.texture = bgTexture;
+        bgElement.textureId = textureId;
     } else {
         bgElement.texture = nullptr;
         Log::error("[StandardDialogWidget] Failed to create background texture");
@@ -24,25 +24,13 @@ ToastWidget::ToastWidget(UiManager* uiMgr, ResourceManager* resMgr,
     
     ImageRenderer imageRenderer(renderer, rect.w, rect.h);
     imageRenderer.drawColor(SDL_Color{0, 0, 0, 180});
-    SDL_Texture* bgTexture = imageRenderer.getTexture();
-    
-    int texW, texH;
-    Uint32 format;
-    int access;
-    SDL_QueryTexture(bgTexture, &format, &access, &texW, &texH);
-    SDL_Texture* copiedTexture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, texW, texH);
-    if (copiedTexture) {
-        SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-        SDL_SetRenderTarget(renderer, copiedTexture);
-        SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, bgTexture, nullptr, nullptr);
-        SDL_SetRenderTarget(renderer, oldTarget);
-        
-        std::string textureId = resourceManager->registerTexture(copiedTexture);
+    SDL_Texture* bgTexture = imageRenderer.takeTexture();
+    if (bgTexture) {
+        std::string textureId = resourceManager->registerTexture(bgTexture);
         
         UIElement bgElement;
         bgElement.name = "";
-        bgElement.texture = copiedTexture;
+        bgElement.texture = bgTexture;
         bgElement.textureId = textureId;
         bgElement.rect = rect;
         bgElement.visible = false;
@@ -0,0 +1,364 @@
+#include "ParticleWidget.h"
+#include "../../ui/uiManager.h"
+#include "../../resource/resourceManager.h"
+#include "../../utils/logger.h"
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+ParticleWidget::ParticleWidget(UiManager* uiMgr, ResourceManager* resMgr, const SDL_Rect& rect, bool visible)
+    : UIWidget(uiMgr, resMgr) {
+    // UIElement 생성 (렌더링 영역/클리핑용, 파티클은 직접 렌더링)
+    UIElement element;
+    element.name = "";  // 빈 이름으로 자동 ID 생성
+    element.texture = nullptr;
+    element.rect = rect;
+    element.visible = visible;
+    element.clickable = false;
+    uiElementId = uiManager->addUIAndGetId(element);
+}
+
+ParticleWidget::~ParticleWidget() {
+    // 텍스처는 ResourceManager에서 관리하므로 여기서 해제하지 않음
+}
+
+int ParticleWidget::addEmitter(const EmitterConfig& config) {
+    TextureRegion region = resourceManager->getTextureRegion(config.image);
+    if (!region) {
+        Log::error("[ParticleWidget] Particle image not found: ", config.image);
+        return -1;
+    }
+    int texW = 0, texH = 0;
+    SDL_QueryTexture(region.texture, nullptr, nullptr, &texW, &texH);
+    if (texW <= 0 || texH <= 0 || region.rect.w <= 0 || region.rect.h <= 0) {
+        Log::error("[ParticleWidget] Invalid particle texture: ", config.image);
+        return -1;
+    }
+
+    Emitter emitter;
+    emitter.config = config;
+    emitter.config.maxParticles = std::max(1, config.maxParticles);
+    emitter.region = region;
+    emitter.u0 = static_cast<float>(region.rect.x) / texW;
+    emitter.v0 = static_cast<float>(region.rect.y) / texH;
+    emitter.u1 = static_cast<float>(region.rect.x + region.rect.w) / texW;
+    emitter.v1 = static_cast<float>(region.rect.y + region.rect.h) / texH;
+    emitter.aspect = static_cast<float>(region.rect.h) / region.rect.w;
+    emitter.pendingBurst = std::max(0, config.burst);
+    emitter.rotates = config.spinMin != 0.0f || config.spinMax != 0.0f;
+
+    // 풀은 여기서 한 번만 할당 (방출/소멸은 앞쪽 count개 안에서만 일어남)
+    const size_t capacity = static_cast<size_t>(emitter.config.maxParticles);
+    for (std::vector<float>* column : {&emitter.posX, &emitter.posY, &emitter.velX, &emitter.velY,
+                                       &emitter.age, &emitter.ageRate, &emitter.rotation, &emitter.spin}) {
+        column->assign(capacity, 0.0f);
+    }
+
+    emitters.push_back(std::move(emitter));
+    return static_cast<int>(emitters.size()) - 1;
+}
+
+void ParticleWidget::burst(int count, int emitterIndex) {
+    if (emitterIndex >= 0) {
+        if (emitterIndex < static_cast<int>(emitters.size())) {
+            spawn(emitters[emitterIndex], count);
+        }
+        return;
+    }
+    for (Emitter& emitter : emitters) {
+        spawn(emitter, count);
+    }
+}
+
+void ParticleWidget::setEmitting(bool emitting) {
+    for (Emitter& emitter : emitters) {
+        emitter.emitting = emitting;
+        emitter.emitElapsed = 0.0f;
+        emitter.spawnCarry = 0.0f;
+    }
+}
+
+void ParticleWidget::clearParticles() {
+    for (Emitter& emitter : emitters) {
+        emitter.count = 0;
+        emitter.pendingBurst = 0;
+    }
+}
+
+size_t ParticleWidget::getParticleCount() const {
+    size_t total = 0;
+    for (const Emitter& emitter : emitters) {
+        total += emitter.count;
+    }
+    return total;
+}
+
+float ParticleWidget::random(float min, float max) {
+    // xorshift32: 파티클 방출용 (품질보다 속도)
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return min + (max - min) * (static_cast<float>(rngState >> 8) * (1.0f / 16777216.0f));
+}
+
+void ParticleWidget::spawn(Emitter& emitter, int count) {
+    const EmitterConfig& config = emitter.config;
+    const size_t capacity = static_cast<size_t>(config.maxParticles);
+    const float degToRad = static_cast<float>(M_PI) / 180.0f;
+
+    for (int k = 0; k < count && emitter.count < capacity; k++) {
+        const size_t i = emitter.count++;
+        const float angle = random(config.angleMin, config.angleMax) * degToRad;
+        const float speed = random(config.speedMin, config.speedMax);
+        const float lifetimeMs = std::max(1.0f, random(config.lifetimeMin, config.lifetimeMax));
+
+        emitter.posX[i] = config.x + random(-0.5f, 0.5f) * config.areaW;
+        emitter.posY[i] = config.y + random(-0.5f, 0.5f) * config.areaH;
+        emitter.velX[i] = std::cos(angle) * speed;
+        emitter.velY[i] = std::sin(angle) * speed;
+        emitter.age[i] = 0.0f;
+        emitter.ageRate[i] = 1000.0f / lifetimeMs;
+        emitter.rotation[i] = emitter.rotates ? random(0.0f, 360.0f) : 0.0f;
+        emitter.spin[i] = emitter.rotates ? random(config.spinMin, config.spinMax) : 0.0f;
+    }
+}
+
+void ParticleWidget::integrate(Emitter& emitter, float dt) {
+    // 열마다 분기 없는 루프 (열끼리 겹치지 않으므로 자동 벡터화됨)
+    const size_t n = emitter.count;
+    const float gx = emitter.config.gravityX * dt;
+    const float gy = emitter.config.gravityY * dt;
+    float* velX = emitter.velX.data();
+    float* velY = emitter.velY.data();
+    float* posX = emitter.posX.data();
+    float* posY = emitter.posY.data();
+    float* age = emitter.age.data();
+    const float* ageRate = emitter.ageRate.data();
+
+    for (size_t i = 0; i < n; i++) {
+        velX[i] += gx;
+        posX[i] += velX[i] * dt;
+    }
+    for (size_t i = 0; i < n; i++) {
+        velY[i] += gy;
+        posY[i] += velY[i] * dt;
+    }
+    for (size_t i = 0; i < n; i++) {
+        age[i] += ageRate[i] * dt;
+    }
+    if (emitter.rotates) {
+        float* rotation = emitter.rotation.data();
+        const float* spin = emitter.spin.data();
+        for (size_t i = 0; i < n; i++) {
+            rotation[i] += spin[i] * dt;
+        }
+    }
+}
+
+void ParticleWidget::removeDead(Emitter& emitter) {
+    // 수명이 끝난 파티클 자리에 마지막 파티클을 옮김 (순서는 중요하지 않음)
+    size_t i = 0;
+    while (i < emitter.count) {
+        if (emitter.age[i] < 1.0f) {
+            i++;
+            continue;
+        }
+        const size_t last = --emitter.count;
+        emitter.posX[i] = emitter.posX[last];
+        emitter.posY[i] = emitter.posY[last];
+        emitter.velX[i] = emitter.velX[last];
+        emitter.velY[i] = emitter.velY[last];
+        emitter.age[i] = emitter.age[last];
+        emitter.ageRate[i] = emitter.ageRate[last];
+        emitter.rotation[i] = emitter.rotation[last];
+        emitter.spin[i] = emitter.spin[last];
+    }
+}
+
+void ParticleWidget::update(float deltaTime) {
+    if (deltaTime <= 0.0f) return;
+    const float dt = deltaTime / 1000.0f;  // 물리는 초 단위
+
+    for (Emitter& emitter : emitters) {
+        integrate(emitter, dt);
+        removeDead(emitter);
+
+        if (emitter.pendingBurst > 0) {
+            spawn(emitter, emitter.pendingBurst);
+            emitter.pendingBurst = 0;
+        }
+
+        const EmitterConfig& config = emitter.config;
+        if (emitter.emitting && config.rate > 0.0f) {
+            if (config.durationMs >= 0 && emitter.emitElapsed >= config.durationMs) {
+                emitter.emitting = false;
+                continue;
+            }
+            emitter.emitElapsed += deltaTime;
+            emitter.spawnCarry += config.rate * dt;
+            const int count = static_cast<int>(emitter.spawnCarry);
+            emitter.spawnCarry -= static_cast<float>(count);
+            spawn(emitter, count);
+        }
+    }
+}
+
+void ParticleWidget::appendVertices(const Emitter& emitter, const ScreenTransform& transform) {
+    const EmitterConfig& config = emitter.config;
+    const size_t n = emitter.count;
+    const size_t base = vertices.size();
+    vertices.resize(base + n * 4);
+    SDL_Vertex* out = vertices.data() + base;
+
+    const float sizeDelta = config.sizeEnd - config.sizeStart;
+    const float alphaDelta = config.alphaEnd - config.alphaStart;
+    const float alphaScale = transform.alpha * config.color.a;  // 0~255
+    const float degToRad = static_cast<float>(M_PI) / 180.0f;
+    const float us[4] = {emitter.u0, emitter.u1, emitter.u1, emitter.u0};
+    const float vs[4] = {emitter.v0, emitter.v0, emitter.v1, emitter.v1};
+
+    for (size_t i = 0; i < n; i++) {
+        const float t = emitter.age[i];
+        const float halfW = (config.sizeStart + sizeDelta * t) * transform.scale * 0.5f;
+        const float halfH = halfW * emitter.aspect;
+        const float a = std::min(1.0f, std::max(0.0f, config.alphaStart + alphaDelta * t));
+        const SDL_Color color = {config.color.r, config.color.g, config.color.b,
+                                 static_cast<Uint8>(a * alphaScale)};
+        float cx, cy;
+        transform.apply(emitter.posX[i], emitter.posY[i], cx, cy);
+
+        // 꼭짓점 오프셋 (좌상, 우상, 우하, 좌하)
+        float ox[4] = {-halfW, halfW, halfW, -halfW};
+        float oy[4] = {-halfH, -halfH, halfH, halfH};
+        if (emitter.rotates || transform.rotation != 0.0f) {
+            const float rad = (emitter.rotation[i] + transform.rotation) * degToRad;
+            const float cosR = std::cos(rad);
+            const float sinR = std::sin(rad);
+            for (int c = 0; c < 4; c++) {
+                const float x = ox[c] * cosR - oy[c] * sinR;
+                oy[c] = ox[c] * sinR + oy[c] * cosR;
+                ox[c] = x;
+            }
+        }
+        for (int c = 0; c < 4; c++) {
+            SDL_Vertex& v = out[i * 4 + c];
+            v.position.x = cx + ox[c];
+            v.position.y = cy + oy[c];
+            v.color = color;
+            v.tex_coord.x = us[c];
+            v.tex_coord.y = vs[c];
+        }
+    }
+}
+
+void ParticleWidget::drawVertices(SDL_Renderer* renderer, SDL_Texture* texture, SDL_BlendMode blend) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // 쿼드 인덱스 패턴은 늘어날 때만 이어서 채움
+    const size_t quadCount = vertices.size() / 4;
+    for (size_t q = indices.size() / 6; q < quadCount; q++) {
+        const int base = static_cast<int>(q * 4);
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+
+    // 아틀라스 텍스처는 다른 요소와 공유하므로 블렌드 모드를 바꿨다가 되돌림
+    SDL_BlendMode previousBlend = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureBlendMode(texture, &previousBlend);
+    if (previousBlend != blend) {
+        SDL_SetTextureBlendMode(texture, blend);
+    }
+    if (SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()),
+                           indices.data(), static_cast<int>(quadCount * 6)) != 0) {
+        Log::error("[ParticleWidget] SDL_RenderGeometry failed, falling back to RenderCopyEx: ", SDL_GetError());
+        geometrySupported = false;
+    }
+    if (previousBlend != blend) {
+        SDL_SetTextureBlendMode(texture, previousBlend);
+    }
+#else
+    (void)renderer;
+    (void)texture;
+    (void)blend;
+    geometrySupported = false;
+#endif
+}
+
+void ParticleWidget::render(SDL_Renderer* renderer) {
+    if (!uiManager) return;
+    auto* element = uiManager->findElementByName(uiElementId);
+    const UiManager::WorldTransform* world = uiManager->getWorldTransform(uiElementId);
+    if (!element || !world || !world->visible) return;
+
+    // UIElement 렌더와 같은 월드 변환 (이번 프레임 UiManager::render에서 갱신된 캐시)
+    ScreenTransform transform;
+    transform.centerX = world->dst.x + world->dst.w * 0.5f;
+    transform.centerY = world->dst.y + world->dst.h * 0.5f;
+    transform.pivotX = element->rect.w * 0.5f;
+    transform.pivotY = element->rect.h * 0.5f;
+    transform.scale = world->scale;
+    transform.rotation = world->rotation;
+    const float rad = world->rotation * static_cast<float>(M_PI) / 180.0f;
+    transform.cosR = std::cos(rad);
+    transform.sinR = std::sin(rad);
+    transform.alpha = world->alpha;
+
+    // WidgetManager가 잡은 클리핑(스케일 미적용 위치)을 화면상의 요소 영역으로 교체 (회전 시 외접 사각형)
+    const float halfW = std::abs(world->dst.w * 0.5f * transform.cosR) + std::abs(world->dst.h * 0.5f * transform.sinR);
+    const float halfH = std::abs(world->dst.w * 0.5f * transform.sinR) + std::abs(world->dst.h * 0.5f * transform.cosR);
+    SDL_Rect clipRect = {static_cast<int>(std::floor(transform.centerX - halfW)),
+                         static_cast<int>(std::floor(transform.centerY - halfH)),
+                         static_cast<int>(std::ceil(halfW * 2.0f)), static_cast<int>(std::ceil(halfH * 2.0f))};
+    SDL_RenderSetClipRect(renderer, &clipRect);
+
+    // 텍스처·블렌드 모드가 같은 연속 이미터를 한 번에 그림
+    SDL_Texture* batchTexture = nullptr;
+    SDL_BlendMode batchBlend = SDL_BLENDMODE_BLEND;
+    vertices.clear();
+    for (const Emitter& emitter : emitters) {
+        if (emitter.count == 0) continue;
+        const SDL_BlendMode blend = emitter.config.additive ? SDL_BLENDMODE_ADD : SDL_BLENDMODE_BLEND;
+        const SDL_Texture* texture = emitter.region.texture;
+
+        if (!geometrySupported) {
+            // 폴백: 파티클마다 RenderCopyEx (색/알파는 텍스처 mod로)
+            const EmitterConfig& config = emitter.config;
+            Uint8 previousAlpha = 255, previousR = 255, previousG = 255, previousB = 255;
+            SDL_BlendMode previousBlend = SDL_BLENDMODE_BLEND;
+            SDL_GetTextureAlphaMod(emitter.region.texture, &previousAlpha);
+            SDL_GetTextureColorMod(emitter.region.texture, &previousR, &previousG, &previousB);
+            SDL_GetTextureBlendMode(emitter.region.texture, &previousBlend);
+            SDL_SetTextureColorMod(emitter.region.texture, config.color.r, config.color.g, config.color.b);
+            SDL_SetTextureBlendMode(emitter.region.texture, blend);
+            for (size_t i = 0; i < emitter.count; i++) {
+                const float t = emitter.age[i];
+                const float w = (config.sizeStart + (config.sizeEnd - config.sizeStart) * t) * transform.scale;
+                const float h = w * emitter.aspect;
+                const float a = std::min(1.0f, std::max(0.0f, config.alphaStart + (config.alphaEnd - config.alphaStart) * t));
+                float cx, cy;
+                transform.apply(emitter.posX[i], emitter.posY[i], cx, cy);
+                SDL_Rect dst = {static_cast<int>(cx - w * 0.5f), static_cast<int>(cy - h * 0.5f),
+                                static_cast<int>(w), static_cast<int>(h)};
+                SDL_SetTextureAlphaMod(emitter.region.texture, static_cast<Uint8>(a * transform.alpha * config.color.a));
+                SDL_RenderCopyEx(renderer, emitter.region.texture, &emitter.region.rect, &dst,
+                                 emitter.rotation[i] + transform.rotation, nullptr, SDL_FLIP_NONE);
+            }
+            SDL_SetTextureAlphaMod(emitter.region.texture, previousAlpha);
+            SDL_SetTextureColorMod(emitter.region.texture, previousR, previousG, previousB);
+            SDL_SetTextureBlendMode(emitter.region.texture, previousBlend);
+            continue;
+        }
+
+        if (!vertices.empty() && (texture != batchTexture || blend != batchBlend)) {
+            drawVertices(renderer, batchTexture, batchBlend);
+            vertices.clear();
+        }
+        batchTexture = emitter.region.texture;
+        batchBlend = blend;
+        appendVertices(emitter, transform);
+    }
+    if (!vertices.empty()) {
+        drawVertices(renderer, batchTexture, batchBlend);
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "../UIWidget.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../utils/sdl_includes.h"
+#include "../../resource/TextureAtlas.h"
+
+/**
+ * 파티클 위젯 (반짝이, 코인, 꽃가루 등).
+ * 파티클마다 UIElement/Animator를 만들지 않고, 이미터별 구조체 배열(SoA)에 상태를 두고
+ * 분기 없는 루프로 한꺼번에 적분한다 (컴파일러 자동 벡터화 대상).
+ * 그리기는 같은 텍스처·블렌드 모드인 이미터를 묶어 SDL_RenderGeometry 한 번으로 처리
+ * (이미지가 같은 아틀라스에 있으면 이미터가 여러 개여도 한 번).
+ * 좌표는 위젯 기준이며, 그릴 때 UiManager의 월드 변환 캐시(부모 포함 스케일/회전/alpha)로 화면 좌표로 옮긴다.
+ * 위젯 영역(회전 시 그 외접 사각형) 밖은 잘린다.
+ */
+class ParticleWidget : public UIWidget {
+public:
+    // JSON "emitters" 항목 하나. 범위 값은 [min, max] 중 균등 랜덤, 시작/끝 값은 수명 동안 선형 보간
+    struct EmitterConfig {
+        std::string image;                       // 파티클 이미지 (아틀라스 영역)
+        float x = 0.0f, y = 0.0f;                // 방출 중심 (위젯 기준)
+        float areaW = 0.0f, areaH = 0.0f;        // 방출 영역 크기 (중심 기준 사각형)
+        float rate = 0.0f;                       // 초당 방출 수
+        int burst = 0;                           // 시작할 때 한 번에 방출할 수
+        int maxParticles = 500;                  // 동시에 살아 있는 최대 수 (풀 크기, 넘으면 방출 생략)
+        int durationMs = -1;                     // 연속 방출 시간 (-1 무한)
+        float lifetimeMin = 1000.0f, lifetimeMax = 1000.0f;  // ms
+        float speedMin = 0.0f, speedMax = 0.0f;  // px/s
+        float angleMin = 0.0f, angleMax = 360.0f;  // 도 (0 = 오른쪽, 90 = 아래)
+        float gravityX = 0.0f, gravityY = 0.0f;  // px/s²
+        float sizeStart = 16.0f, sizeEnd = 16.0f;  // 너비 px (높이는 이미지 비율)
+        float alphaStart = 1.0f, alphaEnd = 0.0f;
+        float spinMin = 0.0f, spinMax = 0.0f;    // 도/s
+        SDL_Color color = {255, 255, 255, 255};
+        bool additive = false;                   // true면 가산 블렌드 (빛나는 효과)
+    };
+
+    ParticleWidget(UiManager* uiMgr, ResourceManager* resMgr, const SDL_Rect& rect, bool visible = true);
+    virtual ~ParticleWidget();
+
+    std::string getUIElementIdentifier() const override { return uiElementId; }
+
+    // 이미터 추가 (풀을 maxParticles만큼 미리 할당). 이미지를 찾지 못하면 -1
+    int addEmitter(const EmitterConfig& config);
+    // 즉시 count개 방출 (emitterIndex -1이면 모든 이미터)
+    void burst(int count, int emitterIndex = -1);
+    // 연속 방출 켜기/끄기 (켜면 durationMs를 처음부터 다시 셈). 살아 있는 파티클은 수명대로 진행
+    void setEmitting(bool emitting);
+    void clearParticles();
+    size_t getParticleCount() const;
+
+    void update(float deltaTime) override;
+    void render(SDL_Renderer* renderer) override;
+
+private:
+    struct Emitter {
+        EmitterConfig config;
+        TextureRegion region;
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;  // 영역의 텍스처 좌표
+        float aspect = 1.0f;         // 높이 / 너비
+        float spawnCarry = 0.0f;     // 아직 방출하지 못한 소수 부분
+        float emitElapsed = 0.0f;    // 연속 방출 경과 시간 (ms)
+        bool emitting = true;
+        int pendingBurst = 0;
+        bool rotates = false;        // 회전 속도가 0이 아닌 파티클이 있을 수 있음
+
+        // 파티클 상태 (SoA, 크기는 maxParticles로 고정하고 앞쪽 count개만 사용)
+        size_t count = 0;
+        std::vector<float> posX, posY, velX, velY;
+        std::vector<float> age;      // 0~1 (정규화된 나이)
+        std::vector<float> ageRate;  // 1 / 수명(초)
+        std::vector<float> rotation, spin;
+    };
+
+    // 위젯 좌표 → 화면 좌표 (요소 중심을 축으로 월드 스케일·회전, UiManager::WorldTransform에서 계산)
+    struct ScreenTransform {
+        float centerX = 0.0f, centerY = 0.0f;  // 요소 화면 중심
+        float pivotX = 0.0f, pivotY = 0.0f;    // 같은 점의 위젯 좌표 (rect 크기의 절반)
+        float scale = 1.0f;
+        float rotation = 0.0f;                 // 도
+        float cosR = 1.0f, sinR = 0.0f;
+        float alpha = 1.0f;
+
+        void apply(float x, float y, float& outX, float& outY) const {
+            const float dx = (x - pivotX) * scale;
+            const float dy = (y - pivotY) * scale;
+            outX = centerX + dx * cosR - dy * sinR;
+            outY = centerY + dx * sinR + dy * cosR;
+        }
+    };
+
+    void spawn(Emitter& emitter, int count);
+    void integrate(Emitter& emitter, float dt);
+    void removeDead(Emitter& emitter);
+    // 이미터의 파티클을 정점 버퍼 뒤에 추가
+    void appendVertices(const Emitter& emitter, const ScreenTransform& transform);
+    void drawVertices(SDL_Renderer* renderer, SDL_Texture* texture, SDL_BlendMode blend);
+    float random(float min, float max);
+
+    std::string uiElementId;
+    std::vector<Emitter> emitters;
+    std::vector<SDL_Vertex> vertices;  // 재사용 버퍼
+    std::vector<int> indices;          // 쿼드 인덱스 패턴 (필요한 만큼만 늘림)
+    uint32_t rngState = 0x9E3779B9u;
+    bool geometrySupported = true;     // SDL_RenderGeometry 실패 시 false로 바꾸고 폴백
+};
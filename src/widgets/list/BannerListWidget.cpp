@@ -169,11 +169,9 @@ SDL_Texture* BannerListWidget::createBackgroundTexture(int w, int h, const std::
 
     std::string imgToUse = !imageName.empty() ? imageName : backgroundImageName;
     if (!imgToUse.empty()) {
-        SDL_Texture* baseTex = resourceManager->getTexture(imgToUse);
-        if (baseTex) {
-            int tw, th;
-            SDL_QueryTexture(baseTex, nullptr, nullptr, &tw, &th);
-            imgRenderer.drawImageScaled(baseTex, 0, 0, w, h, 0, 0, tw, th);
+        SDL_Surface* baseSurface = resourceManager->getSurface(imgToUse);
+        if (baseSurface) {
+            imgRenderer.drawImageScaled(baseSurface, 0, 0, w, h);
         } else {
             imgRenderer.drawColor(backgroundColor);
         }
@@ -181,25 +179,11 @@ SDL_Texture* BannerListWidget::createBackgroundTexture(int w, int h, const std::
         imgRenderer.drawColor(backgroundColor);
     }
 
-    SDL_Texture* finalTex = imgRenderer.getTexture();
+    // 합성 결과의 소유권을 넘겨받아 등록 (렌더 타겟 복사 없음)
+    SDL_Texture* finalTex = imgRenderer.takeTexture();
     if (!finalTex) return nullptr;
-
-    int tw, th;
-    SDL_QueryTexture(finalTex, nullptr, nullptr, &tw, &th);
-    SDL_Texture* copiedTex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
-                                               SDL_TEXTUREACCESS_TARGET, tw, th);
-    if (copiedTex) {
-        SDL_SetTextureBlendMode(copiedTex, SDL_BLENDMODE_BLEND);
-        SDL_Texture* oldTarget = SDL_GetRenderTarget(renderer);
-        SDL_SetRenderTarget(renderer, copiedTex);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-        SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, finalTex, nullptr, nullptr);
-        SDL_SetRenderTarget(renderer, oldTarget);
-        outTextureId = resourceManager->registerTexture(copiedTex);
-        return copiedTex;
-    }
-    return nullptr;
+    outTextureId = resourceManager->registerTexture(finalTex);
+    return finalTex;
 }
 
 void BannerListWidget::computeTextPosition(int itemW, int itemH, int textW, int textH,
@@ -330,9 +314,6 @@ void BannerListWidget::updateVisibleItems() {
             }
             if (!it->textElementId.empty()) {
                 uiManager->removeUI(it->textElementId);
-                if (!it->textTextureId.empty()) {
-                    resourceManager->unregisterTexture(it->textTextureId);
-                }
             }
             it = visibleItems.erase(it);
         } else {
@@ -387,24 +368,21 @@ void BannerListWidget::createItemElement(int index) {
     if (textMaxW < 10) textMaxW = itemW;
     if (textMaxH < 10) textMaxH = itemHeight;
 
-    SDL_Texture* textTex = nullptr;
-    if (!title.empty() && textRenderer) {
-        textTex = textRenderer->renderText(renderer, title, fontSize, textColor, textMaxW, textMaxH);
-    }
-    if (textTex) {
-        vi.textTextureId = resourceManager->registerTexture(textTex);
-
-        int textW, textH;
-        SDL_QueryTexture(textTex, nullptr, nullptr, &textW, &textH);
+    // 제목은 글리프 쿼드로 그림 (스크롤로 항목이 다시 만들어져도 텍스처 할당 없음)
+    TextRun textRun;
+    if (!title.empty() && textRenderer &&
+        textRenderer->layoutText(renderer, title, fontSize, textMaxW, textMaxH, textRun)) {
+        int textW = textRun.width;
+        int textH = textRun.height;
 
         int tx, ty;
         computeTextPosition(itemW, itemHeight, textW, textH, tx, ty);
 
         UIElement textEl;
         textEl.name = "";
-        textEl.texture = textTex;
-        textEl.textureId = vi.textTextureId;
-        textEl.rect = SDL_Rect{tx, baseY + ty, textW, textH};
+        textEl.setTextRun(std::move(textRun), textColor);
+        textEl.rect.x = tx;
+        textEl.rect.y = baseY + ty;
         textEl.visible = true;
         textEl.clickable = false;
 
@@ -458,9 +436,6 @@ void BannerListWidget::clearVisibleItems() {
         }
         if (!vi.textElementId.empty()) {
             uiManager->removeUI(vi.textElementId);
-            if (!vi.textTextureId.empty()) {
-                resourceManager->unregisterTexture(vi.textTextureId);
-            }
         }
     }
     visibleItems.clear();
@@ -49,8 +49,7 @@ private:
         int itemIndex;
         std::string bgElementId;
         std::string bgTextureId;
-        std::string textElementId;
-        std::string textTextureId;
+        std::string textElementId;  // 제목 (글리프 쿼드, 텍스처 없음)
     };
     std::vector<VisibleItem> visibleItems;
 
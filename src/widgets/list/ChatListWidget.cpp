@@ -243,15 +243,16 @@ void ChatListWidget::updateMessageElements() {
         int textH = bgElement->rect.h;
         
         // 아이콘 텍스처 가져오기 및 크기 계산
-        SDL_Texture* iconTexture = nullptr;
+        TextureRegion iconRegion;
         int iconW = 0, iconH = 0;
         int iconX = 0, iconY = 0;
         
         if (!msg.iconName.empty()) {
-            iconTexture = resourceManager->getTexture(msg.iconName);
-            if (iconTexture) {
+            iconRegion = resourceManager->getTextureRegion(msg.iconName);
+            if (iconRegion) {
                 int origW, origH;
-                SDL_QueryTexture(iconTexture, nullptr, nullptr, &origW, &origH);
+                origW = iconRegion.rect.w;
+                origH = iconRegion.rect.h;
                 // 비율 유지하면서 크기 조정
                 float scale = std::min(static_cast<float>(iconSize) / origW, static_cast<float>(iconSize) / origH);
                 iconW = static_cast<int>(origW * scale);
@@ -263,7 +264,7 @@ void ChatListWidget::updateMessageElements() {
         int textX = 0, textY = 0;
         if (msg.alignment == ChatAlignment::LEFT) {
             // 왼쪽 정렬: 아이콘 왼쪽, 텍스트 아이콘 오른쪽
-            if (iconTexture && iconW > 0) {
+            if (iconRegion && iconW > 0) {
                 iconX = 10;  // 왼쪽 여백
                 iconY = baseY + (itemHeight - iconH) / 2;  // 수직 중앙 정렬
                 textX = iconX + iconW + iconTextSpacing;
@@ -273,7 +274,7 @@ void ChatListWidget::updateMessageElements() {
             textY = baseY + (itemHeight - textH) / 2;  // 수직 중앙 정렬
         } else {
             // 오른쪽 정렬: 텍스트 왼쪽, 아이콘 텍스트 오른쪽
-            if (iconTexture && iconW > 0) {
+            if (iconRegion && iconW > 0) {
                 textX = maxWidth - iconW - iconTextSpacing - textW - 10;  // 오른쪽 여백 고려
                 iconX = textX + textW + iconTextSpacing;
                 iconY = baseY + (itemHeight - iconH) / 2;  // 수직 중앙 정렬
@@ -294,10 +295,10 @@ void ChatListWidget::updateMessageElements() {
         messageTextWidgets.push_back(std::move(bgTextWidget));
         
         // 아이콘 UIElement 생성 (아이콘이 있는 경우)
-        if (iconTexture && iconW > 0 && iconH > 0) {
+        if (iconRegion && iconW > 0 && iconH > 0) {
             UIElement iconElement;
             iconElement.name = "";  // 빈 문자열로 전달하면 자동 ID 생성
-            iconElement.texture = iconTexture;
+            iconElement.setTextureRegion(iconRegion);
             iconElement.textureId = msg.iconName;  // ResourceManager에 등록된 이름 사용
             iconElement.rect = SDL_Rect{iconX, iconY, iconW, iconH};
             iconElement.visible = true;
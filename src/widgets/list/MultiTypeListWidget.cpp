@@ -6,7 +6,6 @@
 #include "../../resource/resourceManager.h"
 #include "../../utils/logger.h"
 #include <algorithm>
-#include <set>
 
 MultiTypeListWidget::MultiTypeListWidget(UiManager* uiMgr, ResourceManager* resMgr,
                                          SDL_Renderer* sdlRenderer, TextRenderer* txtRenderer,
@@ -42,7 +41,8 @@ MultiTypeListWidget::MultiTypeListWidget(UiManager* uiMgr, ResourceManager* resM
     element.scale = scale;
     element.rotation = rotation;
     element.alpha = alpha;
-    uiElementId = uiManager->addUIAndGetId(element);
+    uiHandle = uiManager->addUIAndGetHandle(element);
+    uiElementId = uiManager->getElement(uiHandle)->name;
     
     // maxVisibleItems 계산
     if (rect.h > 0) {
@@ -59,7 +59,7 @@ void MultiTypeListWidget::setItems(const std::vector<ListItem>& newItems) {
     items = newItems;
     
     // 스크롤 오프셋이 범위를 벗어나지 않도록 조정
-    auto* element = uiManager->findElementByName(uiElementId);
+    auto* element = uiManager->getElement(uiHandle);
     if (element) {
         int widgetH = element->rect.h;
         int maxScroll = static_cast<int>(items.size()) * itemHeight - widgetH;
@@ -144,7 +144,7 @@ void MultiTypeListWidget::setScrollOffset(int offset) {
     scrollOffset = offset;
     
     // 범위 제한
-    auto* element = uiManager->findElementByName(uiElementId);
+    auto* element = uiManager->getElement(uiHandle);
     if (!element) return;
     
     int widgetH = element->rect.h;
@@ -164,7 +164,7 @@ void MultiTypeListWidget::scrollToTop() {
 }
 
 void MultiTypeListWidget::scrollToBottom() {
-    auto* element = uiManager->findElementByName(uiElementId);
+    auto* element = uiManager->getElement(uiHandle);
     if (!element) return;
     
     int widgetH = element->rect.h;
@@ -177,7 +177,7 @@ void MultiTypeListWidget::scrollToBottom() {
 
 void MultiTypeListWidget::handleEvent(const SDL_Event& event) {
     // 위젯의 위치와 크기 가져오기
-    auto* element = uiManager->findElementByName(uiElementId);
+    auto* element = uiManager->getElement(uiHandle);
     if (!element) return;
     
     if (event.type == SDL_MOUSEBUTTONDOWN && event.button.button == SDL_BUTTON_LEFT) {
@@ -226,7 +226,7 @@ void MultiTypeListWidget::updateVisibleItems() {
         return;
     }
     
-    auto* element = uiManager->findElementByName(uiElementId);
+    auto* element = uiManager->getElement(uiHandle);
     if (!element) return;
     
     int viewportHeight = element->rect.h;
@@ -247,15 +247,9 @@ void MultiTypeListWidget::updateVisibleItems() {
         return;
     }
     
-    // 현재 보이는 인덱스 집합
-    std::set<int> currentVisible;
-    for (int i = startIndex; i <= endIndex; i++) {
-        currentVisible.insert(i);
-    }
-    
-    // 제거: 보이지 않는 항목 제거
+    // 제거: 보이지 않는 항목 제거 (보이는 인덱스는 [startIndex, endIndex] 연속 구간이라 범위 비교로 충분)
     for (auto it = visibleItems.begin(); it != visibleItems.end();) {
-        if (currentVisible.find(it->itemIndex) == currentVisible.end()) {
+        if (it->itemIndex < startIndex || it->itemIndex > endIndex) {
             Log::info("[removeItemElement] Removing child for item index: ", it->itemIndex);
             if (it->textWidget) {
                 Log::info("[MultiTypeListWidget] Removing text widget for item index: ", it->itemIndex);
@@ -263,13 +257,13 @@ void MultiTypeListWidget::updateVisibleItems() {
             }
             
             // 아이콘 UIElement 제거
-            if (!it->iconElementId.empty()) {
-                uiManager->removeUI(it->iconElementId);
+            if (!it->iconHandle.isNull()) {
+                uiManager->removeUI(it->iconHandle);
             }
             
             // 이미지 UIElement 제거
-            if (!it->imageElementId.empty()) {
-                uiManager->removeUI(it->imageElementId);
+            if (!it->imageHandle.isNull()) {
+                uiManager->removeUI(it->imageHandle);
             }
             
             it = visibleItems.erase(it);
@@ -303,7 +297,7 @@ void MultiTypeListWidget::createItemElement(int index) {
     VisibleItem visible;
     visible.itemIndex = index;
     
-    auto* parentElement = uiManager->findElementByName(uiElementId);
+    auto* parentElement = uiManager->getElement(uiHandle);
     if (!parentElement) return;
     
     int maxWidth = parentElement->rect.w;
@@ -364,10 +358,11 @@ void MultiTypeListWidget::createItemElement(int index) {
             
             // 아이콘 생성
             if (!item.iconName.empty()) {
-                SDL_Texture* iconTexture = resourceManager->getTexture(item.iconName);
-                if (iconTexture) {
+                TextureRegion iconRegion = resourceManager->getTextureRegion(item.iconName);
+                if (iconRegion) {
                     int origW, origH;
-                    SDL_QueryTexture(iconTexture, nullptr, nullptr, &origW, &origH);
+                    origW = iconRegion.rect.w;
+                    origH = iconRegion.rect.h;
                     float scale = std::min(static_cast<float>(iconSize) / origW, 
                                           static_cast<float>(iconSize) / origH);
                     int iconW = static_cast<int>(origW * scale);
@@ -375,15 +370,14 @@ void MultiTypeListWidget::createItemElement(int index) {
                     
                     UIElement iconElement;
                     iconElement.name = "";
-                    iconElement.texture = iconTexture;
+                    iconElement.setTextureRegion(iconRegion);
                     iconElement.textureId = item.iconName;
                     iconElement.rect = SDL_Rect{10, 0, iconW, iconH};  // Y는 updateItemPositions에서 설정
                     iconElement.visible = true;
                     iconElement.clickable = false;
                     
-                    std::string iconId = uiManager->addUIAndGetId(iconElement);
-                    uiManager->setParent(iconId, uiElementId);
-                    visible.iconElementId = iconId;
+                    visible.iconHandle = uiManager->addUIAndGetHandle(iconElement);
+                    uiManager->setParent(visible.iconHandle, uiElementId);
                     
                     // 텍스트 위치 (아이콘 오른쪽)
                     bgElement->rect.x = 10 + iconW + iconTextSpacing;
@@ -426,10 +420,11 @@ void MultiTypeListWidget::createItemElement(int index) {
             
             // 아이콘 생성
             if (!item.iconName.empty()) {
-                SDL_Texture* iconTexture = resourceManager->getTexture(item.iconName);
-                if (iconTexture) {
+                TextureRegion iconRegion = resourceManager->getTextureRegion(item.iconName);
+                if (iconRegion) {
                     int origW, origH;
-                    SDL_QueryTexture(iconTexture, nullptr, nullptr, &origW, &origH);
+                    origW = iconRegion.rect.w;
+                    origH = iconRegion.rect.h;
                     float scale = std::min(static_cast<float>(iconSize) / origW, 
                                           static_cast<float>(iconSize) / origH);
                     int iconW = static_cast<int>(origW * scale);
@@ -437,15 +432,14 @@ void MultiTypeListWidget::createItemElement(int index) {
                     
                     UIElement iconElement;
                     iconElement.name = "";
-                    iconElement.texture = iconTexture;
+                    iconElement.setTextureRegion(iconRegion);
                     iconElement.textureId = item.iconName;
                     iconElement.rect = SDL_Rect{maxWidth - iconW - 10, 0, iconW, iconH};  // Y는 updateItemPositions에서 설정
                     iconElement.visible = true;
                     iconElement.clickable = false;
                     
-                    std::string iconId = uiManager->addUIAndGetId(iconElement);
-                    uiManager->setParent(iconId, uiElementId);
-                    visible.iconElementId = iconId;
+                    visible.iconHandle = uiManager->addUIAndGetHandle(iconElement);
+                    uiManager->setParent(visible.iconHandle, uiElementId);
                     
                     // 텍스트 위치 (아이콘 왼쪽)
                     bgElement->rect.x = maxWidth - iconW - iconTextSpacing - textW - 10;
@@ -465,23 +459,22 @@ void MultiTypeListWidget::createItemElement(int index) {
         case ListItemType::CENTER_IMAGE: {
             // 가운데 이미지
             if (!item.imageName.empty()) {
-                SDL_Texture* imageTexture = resourceManager->getTexture(item.imageName);
-                if (imageTexture) {
+                TextureRegion imageRegion = resourceManager->getTextureRegion(item.imageName);
+                if (imageRegion) {
                     // 이미지 크기: width는 위젯의 절반, height는 width의 절반
                     int imgW = maxWidth / 2;
                     int imgH = imgW / 2;
                     
                     UIElement imageElement;
                     imageElement.name = "";
-                    imageElement.texture = imageTexture;
+                    imageElement.setTextureRegion(imageRegion);
                     imageElement.textureId = item.imageName;
                     imageElement.rect = SDL_Rect{(maxWidth - imgW) / 2, 0, imgW, imgH};  // Y는 updateItemPositions에서 설정
                     imageElement.visible = true;
                     imageElement.clickable = false;
                     
-                    std::string imageId = uiManager->addUIAndGetId(imageElement);
-                    uiManager->setParent(imageId, uiElementId);
-                    visible.imageElementId = imageId;
+                    visible.imageHandle = uiManager->addUIAndGetHandle(imageElement);
+                    uiManager->setParent(visible.imageHandle, uiElementId);
                 }
             }
             break;
@@ -501,13 +494,13 @@ void MultiTypeListWidget::removeItemElement(int index) {
             }
             
             // 아이콘 UIElement 제거
-            if (!it->iconElementId.empty()) {
-                uiManager->removeUI(it->iconElementId);
+            if (!it->iconHandle.isNull()) {
+                uiManager->removeUI(it->iconHandle);
             }
             
             // 이미지 UIElement 제거
-            if (!it->imageElementId.empty()) {
-                uiManager->removeUI(it->imageElementId);
+            if (!it->imageHandle.isNull()) {
+                uiManager->removeUI(it->imageHandle);
             }
             
             // visibleItems.erase(it)는 updateVisibleItems()에서 처리
@@ -539,8 +532,8 @@ void MultiTypeListWidget::updateItemPositions() {
         }
         
         // 아이콘 위치
-        if (!visible.iconElementId.empty()) {
-            auto* iconElement = uiManager->findElementByName(visible.iconElementId);
+        if (!visible.iconHandle.isNull()) {
+            auto* iconElement = uiManager->getElement(visible.iconHandle);
             if (iconElement) {
                 int iconH = iconElement->rect.h;
                 iconElement->rect.y = baseY + (itemHeight - iconH) / 2;  // 수직 중앙 정렬
@@ -548,8 +541,8 @@ void MultiTypeListWidget::updateItemPositions() {
         }
         
         // 이미지 위치
-        if (!visible.imageElementId.empty()) {
-            auto* imageElement = uiManager->findElementByName(visible.imageElementId);
+        if (!visible.imageHandle.isNull()) {
+            auto* imageElement = uiManager->getElement(visible.imageHandle);
             if (imageElement) {
                 int imgH = imageElement->rect.h;
                 imageElement->rect.y = baseY + (itemHeight - imgH) / 2;  // 수직 중앙 정렬
@@ -563,11 +556,11 @@ void MultiTypeListWidget::clearVisibleItems() {
         if (visible.textWidget) {
             visible.textWidget.reset();
         }
-        if (!visible.iconElementId.empty()) {
-            uiManager->removeUI(visible.iconElementId);
+        if (!visible.iconHandle.isNull()) {
+            uiManager->removeUI(visible.iconHandle);
         }
-        if (!visible.imageElementId.empty()) {
-            uiManager->removeUI(visible.imageElementId);
+        if (!visible.imageHandle.isNull()) {
+            uiManager->removeUI(visible.imageHandle);
         }
     }
     visibleItems.clear();
@@ -3,8 +3,8 @@
 #include <string>
 #include <vector>
 #include <memory>
-#include <set>
 #include "../../utils/sdl_includes.h"
+#include "../../ui/ElementHandle.h"
 
 class TextRenderer;
 class BackgroundTextWidget;
@@ -54,8 +54,8 @@ private:
     struct VisibleItem {
         int itemIndex;                                    // 원본 items의 인덱스
         std::unique_ptr<BackgroundTextWidget> textWidget; // 텍스트 위젯 (있는 경우)
-        std::string iconElementId;                        // 아이콘 UIElement ID (있는 경우)
-        std::string imageElementId;                      // 이미지 UIElement ID (있는 경우)
+        ElementHandle iconHandle;                         // 아이콘 UIElement 핸들 (있는 경우)
+        ElementHandle imageHandle;                        // 이미지 UIElement 핸들 (있는 경우)
     };
     std::vector<VisibleItem> visibleItems;  // 보이는 항목만
     
@@ -66,6 +66,7 @@ private:
     void clearVisibleItems();       // 모든 보이는 항목 제거
     
     std::string uiElementId;  // 리스트 컨테이너 UIElement ID
+    ElementHandle uiHandle;   // 리스트 컨테이너 UIElement 핸들 (매 프레임 조회용)
     
 public:
     MultiTypeListWidget(UiManager* uiMgr, ResourceManager* resMgr,
@@ -221,10 +221,11 @@ void SectionGridWidget::computeLayout(int maxWidth) {
 
             int headerH = 0;
             if (!item.headerImage.empty()) {
-                SDL_Texture* tex = resourceManager->getTexture(item.headerImage);
-                if (tex) {
+                TextureRegion region = resourceManager->getTextureRegion(item.headerImage);
+                if (region) {
                     int texW = 0, texH = 0;
-                    SDL_QueryTexture(tex, nullptr, nullptr, &texW, &texH);
+                    texW = region.rect.w;
+                    texH = region.rect.h;
                     if (texW > 0 && texH > 0) {
                         int headerW = static_cast<int>(maxWidth * headerImageScale);
                         headerH = static_cast<int>(
@@ -332,11 +333,11 @@ void SectionGridWidget::updateVisibleItems() {
 
             if (item.kind == ItemKind::Header) {
                 if (!item.headerImage.empty()) {
-                    SDL_Texture* tex = resourceManager->getTexture(item.headerImage);
-                    if (tex) {
+                    TextureRegion region = resourceManager->getTextureRegion(item.headerImage);
+                    if (region) {
                         UIElement imgEl;
                         imgEl.name = "";
-                        imgEl.texture = tex;
+                        imgEl.setTextureRegion(region);
                         imgEl.textureId = item.headerImage;
                         imgEl.rect = SDL_Rect{ld.headerX, ld.y, ld.headerW, ld.headerH};
                         imgEl.visible = true;
@@ -350,11 +351,12 @@ void SectionGridWidget::updateVisibleItems() {
 
                 createdElements[i] = ce;
             } else {
-                SDL_Texture* tex = resourceManager->getTexture(item.cardImage);
-                if (!tex) continue;
+                TextureRegion region = resourceManager->getTextureRegion(item.cardImage);
+                if (!region) continue;
 
                 int origW = 0, origH = 0;
-                SDL_QueryTexture(tex, nullptr, nullptr, &origW, &origH);
+                origW = region.rect.w;
+                origH = region.rect.h;
                 float imgScale = std::min(
                     static_cast<float>(ld.frameW) / std::max(1, origW),
                     static_cast<float>(ld.frameH) / std::max(1, origH));
@@ -365,7 +367,7 @@ void SectionGridWidget::updateVisibleItems() {
 
                 UIElement imgEl;
                 imgEl.name = "";
-                imgEl.texture = tex;
+                imgEl.setTextureRegion(region);
                 imgEl.textureId = item.cardImage;
                 imgEl.rect = SDL_Rect{imgX, imgY, imgW, imgH};
                 imgEl.visible = true;
@@ -379,14 +381,14 @@ void SectionGridWidget::updateVisibleItems() {
                     auto it = overlays.find(item.overlayId);
                     if (it != overlays.end()) {
                         const OverlayDef& overlayDef = it->second;
-                        SDL_Texture* overlayTex = resourceManager->getTexture(overlayDef.imageName);
-                        if (overlayTex) {
+                        TextureRegion overlayRegion = resourceManager->getTextureRegion(overlayDef.imageName);
+                        if (overlayRegion) {
                             int overlayH = overlayDef.height;
                             int overlayY = imgY + (imgH - overlayH) / 2;
 
                             UIElement overlayEl;
                             overlayEl.name = "";
-                            overlayEl.texture = overlayTex;
+                            overlayEl.setTextureRegion(overlayRegion);
                             overlayEl.textureId = overlayDef.imageName;
                             overlayEl.rect = SDL_Rect{imgX, overlayY, imgW, overlayH};
                             overlayEl.visible = true;
@@ -3,6 +3,7 @@
 #include "../../scene.h"  // MOUSE_CLICK_EVENT 접근용
 #include "../../rendering/TextRenderer.h"
 #include "../../resource/resourceManager.h"
+#include <algorithm>
 #include <sstream>
 
 TextListWidget::TextListWidget(UiManager* uiMgr, ResourceManager* resMgr,
@@ -62,22 +63,8 @@ void TextListWidget::setItems(const std::vector<std::string>& newItems) {
 
 void TextListWidget::addItem(const std::string& item) {
     items.push_back(item);
-    // 새 항목의 텍스처 생성
-    SDL_Texture* texture = textRenderer->renderText(renderer, item, fontSize, textColor);
-    if (texture) {
-        // ResourceManager에 등록
-        std::string textureId = resourceManager->registerTexture(texture);
-        
-        int w, h;
-        SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
-        ItemTexture itemTex;
-        itemTex.text = item;
-        itemTex.texture = texture;
-        itemTex.textureId = textureId;
-        itemTex.width = w;
-        itemTex.height = h;
-        itemTextures.push_back(itemTex);
-    }
+    // 텍스처는 화면에 보일 때 render에서 얻음
+    itemTextures.emplace_back();
 }
 
 void TextListWidget::clearItems() {
@@ -210,10 +197,22 @@ void TextListWidget::render(SDL_Renderer* sdlRenderer) {
         endIndex = static_cast<int>(items.size());
     }
     
+    // 보이는 범위 앞뒤로 한 화면씩만 텍스처 유지, 나머지는 반납 (텍스트 캐시에 남아 되돌아올 때 재사용)
+    int keepBegin = startIndex - maxVisibleItems;
+    int keepEnd = endIndex + maxVisibleItems;
+    if (keepBegin < 0) keepBegin = 0;
+    if (keepEnd > static_cast<int>(itemTextures.size())) keepEnd = static_cast<int>(itemTextures.size());
+    for (int i = residentBegin; i < residentEnd && i < static_cast<int>(itemTextures.size()); i++) {
+        if (i < keepBegin || i >= keepEnd) {
+            releaseItemTexture(i);
+        }
+    }
+    
     // 각 항목 렌더링
     for (int i = startIndex; i < endIndex; i++) {
         if (i >= static_cast<int>(itemTextures.size())) continue;
         
+        acquireItemTexture(i);
         const ItemTexture& itemTex = itemTextures[i];
         if (!itemTex.texture) continue;
         
@@ -238,37 +237,51 @@ void TextListWidget::render(SDL_Renderer* sdlRenderer) {
         
         SDL_RenderCopy(sdlRenderer, itemTex.texture, &srcRect, &dstRect);
     }
+    residentBegin = std::min(keepBegin, startIndex);
+    residentEnd = std::max(keepEnd, endIndex);
 }
 
 void TextListWidget::updateItemTextures() {
     clearItemTextures();
-    
-    for (const auto& item : items) {
-        SDL_Texture* texture = textRenderer->renderText(renderer, item, fontSize, textColor);
-        if (texture) {
-            // ResourceManager에 등록
-            std::string textureId = resourceManager->registerTexture(texture);
-            
-            int w, h;
-            SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
-            ItemTexture itemTex;
-            itemTex.text = item;
-            itemTex.texture = texture;
-            itemTex.textureId = textureId;
-            itemTex.width = w;
-            itemTex.height = h;
-            itemTextures.push_back(itemTex);
+    // 같은 내용이면 다음 render에서 텍스트 캐시 히트 (setItems로 목록을 다시 채워도 래스터화 없음)
+    itemTextures.resize(items.size());
+}
+
+void TextListWidget::acquireItemTexture(int index) {
+    ItemTexture& itemTex = itemTextures[index];
+    if (!itemTex.acquired) {
+        itemTex.acquired = true;
+        // 캐시에 없으면 워커에서 래스터화 (그동안 행은 비워 둠)
+        itemTex.texture = resourceManager->requestTextTexture(textRenderer, items[index], fontSize, textColor,
+                                                              0, -1, "", itemTex.textureId);
+    } else if (!itemTex.texture && !itemTex.textureId.empty()) {
+        itemTex.texture = resourceManager->findTextTexture(itemTex.textureId);  // 업로드 완료 확인
+        if (!itemTex.texture && !resourceManager->isTextPending(itemTex.textureId)) {
+            itemTex.textureId.clear();  // 래스터화 실패: 빈 행으로 두고 더 확인하지 않음
         }
+    } else {
+        return;
+    }
+    if (itemTex.texture) {
+        SDL_QueryTexture(itemTex.texture, nullptr, nullptr, &itemTex.width, &itemTex.height);
     }
 }
 
+void TextListWidget::releaseItemTexture(int index) {
+    ItemTexture& itemTex = itemTextures[index];
+    if (!itemTex.textureId.empty()) {
+        // ResourceManager를 통해 텍스처 해제 (참조 카운팅, 업로드 전이면 요청 취소)
+        resourceManager->unregisterTexture(itemTex.textureId);
+    }
+    itemTex = ItemTexture{};
+}
+
 void TextListWidget::clearItemTextures() {
-    for (auto& itemTex : itemTextures) {
-        if (!itemTex.textureId.empty()) {
-            // ResourceManager를 통해 텍스처 해제 (참조 카운팅)
-            resourceManager->unregisterTexture(itemTex.textureId);
-        }
+    for (int i = 0; i < static_cast<int>(itemTextures.size()); i++) {
+        releaseItemTexture(i);
     }
     itemTextures.clear();
+    residentBegin = 0;
+    residentEnd = 0;
 }
 
@@ -23,18 +23,23 @@ private:
     int lastMouseY;
     int dragStartY;
     
-    // 각 항목의 텍스처 캐시 (성능 최적화)
+    // 항목별 텍스처 (items와 같은 인덱스). 보이는 범위에 들어올 때 ResourceManager 텍스트 캐시에서 얻고,
+    // 범위를 벗어나면 반납 → 다시 스크롤해 오면 캐시에서 재래스터화 없이 돌아옴
     struct ItemTexture {
-        std::string text;
-        SDL_Texture* texture;
-        std::string textureId;  // ResourceManager 텍스처 ID
-        int width;
-        int height;
+        SDL_Texture* texture = nullptr;
+        std::string textureId;  // ResourceManager 텍스처 ID ("text:" 키)
+        int width = 0;
+        int height = 0;
+        bool acquired = false;  // 얻기를 시도했는지 (빈 문자열 등 실패도 매 프레임 다시 시도하지 않음)
     };
     std::vector<ItemTexture> itemTextures;
+    int residentBegin = 0;  // 텍스처를 들고 있을 수 있는 항목 범위 [residentBegin, residentEnd)
+    int residentEnd = 0;
     
-    void updateItemTextures();  // 텍스처 업데이트
+    void updateItemTextures();  // 텍스처 업데이트 (모두 반납, 다음 render에서 보이는 것만 다시 얻음)
     void clearItemTextures();    // 텍스처 해제
+    void acquireItemTexture(int index);
+    void releaseItemTexture(int index);
     
     std::string uiElementId;  // UIElement ID
     
@@ -328,22 +328,10 @@ void UpgradeListWidget::createItemElement(int index) {
     
     if (!itemBackgroundImage.empty()) {
         SDL_Texture* bgTex = nullptr;
-        if (useItemBackgroundNinePatch) {
-            SDL_Texture* baseTex = resourceManager->getTexture(itemBackgroundImage);
-            if (baseTex) {
-                bgTex = resourceManager->createNinePatchTexture(baseTex, maxW, itemHeight);
-                if (bgTex) {
-                    vi.rowBgTextureId = resourceManager->registerTexture(bgTex);
-                }
-            }
-        } else if (useItemBackgroundThreePatch) {
-            SDL_Texture* baseTex = resourceManager->getTexture(itemBackgroundImage);
-            if (baseTex) {
-                bgTex = resourceManager->createThreePatchTexture(baseTex, maxW, itemHeight);
-                if (bgTex) {
-                    vi.rowBgTextureId = resourceManager->registerTexture(bgTex);
-                }
-            }
+        if (useItemBackgroundNinePatch || useItemBackgroundThreePatch) {
+            // 행 배경은 모두 같은 크기 → 공유 패치 텍스처 하나를 참조 카운트로 나눠 씀
+            PatchMode mode = useItemBackgroundNinePatch ? PatchMode::Nine : PatchMode::Three;
+            bgTex = resourceManager->acquirePatchTexture(itemBackgroundImage, maxW, itemHeight, mode, vi.rowBgTextureId);
         } else {
             bgTex = resourceManager->getTexture(itemBackgroundImage);
         }
@@ -361,10 +349,11 @@ void UpgradeListWidget::createItemElement(int index) {
     }
     
     if (!item.iconName.empty()) {
-        SDL_Texture* iconTex = resourceManager->getTexture(item.iconName);
-        if (iconTex) {
+        TextureRegion iconRegion = resourceManager->getTextureRegion(item.iconName);
+        if (iconRegion) {
             int iw, ih;
-            SDL_QueryTexture(iconTex, nullptr, nullptr, &iw, &ih);
+            iw = iconRegion.rect.w;
+            ih = iconRegion.rect.h;
             float scale = std::min(static_cast<float>(iconSize) / iw,
                                   static_cast<float>(iconSize) / ih);
             int iconW = static_cast<int>(iw * scale);
@@ -372,7 +361,7 @@ void UpgradeListWidget::createItemElement(int index) {
             
             UIElement iconEl;
             iconEl.name = "";
-            iconEl.texture = iconTex;
+            iconEl.setTextureRegion(iconRegion);
             iconEl.textureId = item.iconName;
             iconEl.rect = SDL_Rect{iconX, 0, iconW, iconH};
             iconEl.visible = true;
@@ -169,8 +169,8 @@ void VerticalGridWidget::createCellElement(int index) {
     if (index < 0 || index >= static_cast<int>(items.size())) return;
     
     const std::string& imageName = items[index];
-    SDL_Texture* tex = resourceManager->getTexture(imageName);
-    if (!tex) return;
+    TextureRegion region = resourceManager->getTextureRegion(imageName);
+    if (!region) return;
     
     int row = index / columns;
     int col = index % columns;
@@ -185,11 +185,11 @@ void VerticalGridWidget::createCellElement(int index) {
     std::string parentForImage = uiElementId;
     
     if (!cellBackgroundImage.empty()) {
-        SDL_Texture* frameTex = resourceManager->getTexture(cellBackgroundImage);
-        if (frameTex) {
+        TextureRegion frameRegion = resourceManager->getTextureRegion(cellBackgroundImage);
+        if (frameRegion) {
             UIElement frameElement;
             frameElement.name = "";
-            frameElement.texture = frameTex;
+            frameElement.setTextureRegion(frameRegion);
             frameElement.textureId = cellBackgroundImage;
             frameElement.rect = SDL_Rect{baseX, baseY, frameW, frameH};
             frameElement.visible = true;
@@ -203,7 +203,8 @@ void VerticalGridWidget::createCellElement(int index) {
     int innerW = static_cast<int>(frameW * 0.80f);
     int innerH = static_cast<int>(frameH * 0.80f);
     int origW, origH;
-    SDL_QueryTexture(tex, nullptr, nullptr, &origW, &origH);
+    origW = region.rect.w;
+    origH = region.rect.h;
     float imgScale = std::min(static_cast<float>(innerW) / origW,
                              static_cast<float>(innerH) / origH);
     int imgW = static_cast<int>(origW * imgScale);
@@ -213,7 +214,7 @@ void VerticalGridWidget::createCellElement(int index) {
     
     UIElement imageElement;
     imageElement.name = "";
-    imageElement.texture = tex;
+    imageElement.setTextureRegion(region);
     imageElement.textureId = imageName;
     imageElement.rect = SDL_Rect{imgX, imgY, imgW, imgH};
     imageElement.visible = true;
@@ -9,7 +9,6 @@ TilemapWidget::TilemapWidget(UiManager* uiMgr, ResourceManager* resMgr,
                              int mapWidth, int mapHeight, const SDL_Rect& rect,
                              float scale, float rotation, float alpha, bool visible, bool clickable)
     : UIWidget(uiMgr, resMgr),
-      tilesetTexture(nullptr),
       tilesetTextureName(tilesetName),
       tileSize(tileSize),
       mapWidth(mapWidth),
@@ -21,8 +20,8 @@ TilemapWidget::TilemapWidget(UiManager* uiMgr, ResourceManager* resMgr,
       uiElementId("") {
     
     // 타일셋 텍스처 로드
-    tilesetTexture = resourceManager->getTexture(tilesetName);
-    if (!tilesetTexture) {
+    tileset = resourceManager->getTextureRegion(tilesetName);
+    if (!tileset) {
         Log::error("[TilemapWidget] Tileset texture not found: ", tilesetName);
     }
     
@@ -95,15 +94,12 @@ void TilemapWidget::getOffset(int& x, int& y) const {
 }
 
 SDL_Rect TilemapWidget::getTileSourceRect(int tileId) const {
-    if (tileId < 0 || tilesetTexture == nullptr) {
+    if (tileId < 0 || !tileset) {
         return {0, 0, 0, 0};  // 빈 rect
     }
     
-    // 타일셋 텍스처 크기 가져오기
-    int textureWidth, textureHeight;
-    if (SDL_QueryTexture(tilesetTexture, nullptr, nullptr, &textureWidth, &textureHeight) != 0) {
-        return {0, 0, 0, 0};  // 텍스처 정보를 가져올 수 없음
-    }
+    // 타일셋 크기 (아틀라스 영역이면 영역 크기)
+    int textureHeight = tileset.rect.h;
     
     // 타일셋의 행 개수 계산
     int tilesetRows = textureHeight / tileSize;
@@ -124,16 +120,16 @@ SDL_Rect TilemapWidget::getTileSourceRect(int tileId) const {
     }
     
     return {
-        tileX * tileSize,
-        tileY * tileSize,
+        tileset.rect.x + tileX * tileSize,
+        tileset.rect.y + tileY * tileSize,
         tileSize,
         tileSize
     };
 }
 
 void TilemapWidget::render(SDL_Renderer* renderer) {
-    if (!tilesetTexture) {
-        Log::error("[TilemapWidget] render() called but tilesetTexture is null!");
+    if (!tileset) {
+        Log::error("[TilemapWidget] render() called but tileset texture is null!");
         return;  // 타일셋이 없으면 렌더링하지 않음
     }
     
@@ -195,7 +191,7 @@ void TilemapWidget::render(SDL_Renderer* renderer) {
             };
             
             // 렌더링
-            SDL_RenderCopy(renderer, tilesetTexture, &srcRect, &dstRect);
+            SDL_RenderCopy(renderer, tileset.texture, &srcRect, &dstRect);
             renderedCount++;
         }
     }
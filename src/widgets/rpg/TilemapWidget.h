@@ -3,11 +3,12 @@
 #include <vector>
 #include <string>
 #include "../../utils/sdl_includes.h"
+#include "../../resource/TextureAtlas.h"
 
 class TilemapWidget : public UIWidget {
 private:
     std::vector<std::vector<int>> tileData;  // 타일 ID 그리드 [y][x]
-    SDL_Texture* tilesetTexture;             // 타일셋 텍스처
+    TextureRegion tileset;                   // 타일셋 텍스처 (아틀라스에 있으면 페이지의 일부 영역)
     std::string tilesetTextureName;          // 타일셋 텍스처 이름
     
     int tileSize;                             // 타일 크기 (픽셀)
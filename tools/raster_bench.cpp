@@ -0,0 +1,174 @@
+// RasterKernels 마이크로 벤치마크: ImageRenderer의 이전 픽셀 단위 루프 / SDL_BlitSurface와 비교
+// 빌드: cmake -DBUILD_RASTER_BENCH=ON ..  →  ./raster_bench [반복 횟수]
+#define SDL_MAIN_HANDLED
+#include "../src/rendering/RasterKernels.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace {
+
+constexpr int kSize = 512;
+
+struct Canvas {
+    std::vector<Uint32> pixels = std::vector<Uint32>(kSize * kSize, 0);
+    Uint32* row(int y) { return pixels.data() + y * kSize; }
+};
+
+double measureMs(int iterations, const std::function<void()>& body) {
+    body();  // 워밍업
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        body();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+void report(const char* name, double before, double after, bool same) {
+    std::printf("%-28s %9.4f ms  %9.4f ms  x%6.1f  %s\n", name, before, after, before / std::max(after, 1e-9),
+                same ? "ok" : "MISMATCH");
+}
+
+// ---- 이전 ImageRenderer 루프 ----
+
+void legacyFilledCircle(Canvas& canvas, int centerX, int centerY, int radius, Uint32 color) {
+    for (int y = -radius; y <= radius; y++) {
+        for (int x = -radius; x <= radius; x++) {
+            if (x * x + y * y <= radius * radius) {
+                int px = centerX + x;
+                int py = centerY + y;
+                if (px >= 0 && px < kSize && py >= 0 && py < kSize) {
+                    canvas.pixels[py * kSize + px] = color;
+                }
+            }
+        }
+    }
+}
+
+void legacyOutlineRect(Canvas& canvas, int x, int y, int w, int h, Uint32 color) {
+    for (int px = x; px < x + w; px++) {
+        if (px >= 0 && px < kSize) {
+            if (y >= 0 && y < kSize) canvas.pixels[y * kSize + px] = color;
+            if (y + h - 1 >= 0 && y + h - 1 < kSize) canvas.pixels[(y + h - 1) * kSize + px] = color;
+        }
+    }
+    for (int py = y; py < y + h; py++) {
+        if (py >= 0 && py < kSize) {
+            if (x >= 0 && x < kSize) canvas.pixels[py * kSize + x] = color;
+            if (x + w - 1 >= 0 && x + w - 1 < kSize) canvas.pixels[py * kSize + x + w - 1] = color;
+        }
+    }
+}
+
+// ---- RasterKernels (ImageRenderer와 같은 구간 계산) ----
+
+void spanFilledCircle(Canvas& canvas, int centerX, int centerY, int radius, Uint32 color) {
+    int rowBegin = std::max(-radius, -centerY);
+    int rowEnd = std::min(radius, kSize - 1 - centerY);
+    for (int y = rowBegin; y <= rowEnd; y++) {
+        int limit = radius * radius - y * y;
+        int halfWidth = static_cast<int>(std::sqrt(static_cast<float>(limit)));
+        while (halfWidth * halfWidth > limit) halfWidth--;
+        while ((halfWidth + 1) * (halfWidth + 1) <= limit) halfWidth++;
+        int spanBegin = std::max(0, centerX - halfWidth);
+        int spanEnd = std::min(kSize - 1, centerX + halfWidth);
+        if (spanBegin <= spanEnd) {
+            RasterKernels::fillSpan(canvas.row(centerY + y) + spanBegin, spanEnd - spanBegin + 1, color);
+        }
+    }
+}
+
+void spanOutlineRect(Canvas& canvas, int x, int y, int w, int h, Uint32 color) {
+    RasterKernels::fillSpan(canvas.row(y) + x, w, color);
+    RasterKernels::fillSpan(canvas.row(y + h - 1) + x, w, color);
+    for (int py = y; py < y + h; py++) {
+        canvas.row(py)[x] = color;
+        canvas.row(py)[x + w - 1] = color;
+    }
+}
+
+void blendRect(Canvas& canvas, Uint32 color) {
+    for (int y = 0; y < kSize; y++) {
+        RasterKernels::blendSpan(canvas.row(y), kSize, color);
+    }
+}
+
+void fillGradient(Canvas& canvas, bool translucent) {
+    for (int y = 0; y < kSize; y++) {
+        for (int x = 0; x < kSize; x++) {
+            Uint8 alpha = translucent ? static_cast<Uint8>((x + y) & 0xFF) : 255;
+            SDL_Color color = {static_cast<Uint8>(x), static_cast<Uint8>(y), static_cast<Uint8>(x ^ y), alpha};
+            canvas.row(y)[x] = RasterKernels::packColor(color);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200;
+    RasterKernels::Backend best = RasterKernels::getBackend();
+    std::printf("backend: %s, canvas %dx%d, %d iterations\n\n", RasterKernels::getBackendName(best), kSize, kSize, iterations);
+    std::printf("%-28s %12s  %12s  %7s\n", "kernel", "before", "after", "speedup");
+
+    const Uint32 opaque = RasterKernels::packColor({40, 120, 200, 255});
+    const Uint32 translucent = RasterKernels::packColor({255, 255, 255, 96});
+
+    // 채운 원: 바운딩 박스 전체 검사 vs 행 구간 채우기
+    {
+        Canvas a, b;
+        double before = measureMs(iterations, [&]() { legacyFilledCircle(a, 256, 256, 240, opaque); });
+        double after = measureMs(iterations, [&]() { spanFilledCircle(b, 256, 256, 240, opaque); });
+        report("filled circle r=240", before, after, a.pixels == b.pixels);
+    }
+
+    // 테두리 사각형: 픽셀마다 범위 검사 vs 행 채우기
+    {
+        Canvas a, b;
+        double before = measureMs(iterations * 10, [&]() { legacyOutlineRect(a, 8, 8, 496, 496, opaque); });
+        double after = measureMs(iterations * 10, [&]() { spanOutlineRect(b, 8, 8, 496, 496, opaque); });
+        report("outline rect 496x496", before, after, a.pixels == b.pixels);
+    }
+
+    // 반투명 채우기: 스칼라 백엔드 vs SIMD 백엔드 (결과는 비트 단위로 같아야 함)
+    {
+        Canvas a, b;
+        fillGradient(a, false);
+        fillGradient(b, false);
+        RasterKernels::setBackend(RasterKernels::Backend::Scalar);
+        double before = measureMs(iterations, [&]() { blendRect(a, translucent); });
+        RasterKernels::setBackend(best);
+        double after = measureMs(iterations, [&]() { blendRect(b, translucent); });
+        report("blended fill 512x512", before, after, a.pixels == b.pixels);
+    }
+
+    // RGBA32 알파 blit: SDL_BlitSurface vs blitSpan
+    {
+        Canvas src, a, b;
+        fillGradient(src, true);
+        fillGradient(a, false);
+        fillGradient(b, false);
+        SDL_Surface* srcSurface = SDL_CreateRGBSurfaceWithFormatFrom(src.pixels.data(), kSize, kSize, 32, kSize * 4, SDL_PIXELFORMAT_RGBA32);
+        SDL_Surface* dstSurface = SDL_CreateRGBSurfaceWithFormatFrom(a.pixels.data(), kSize, kSize, 32, kSize * 4, SDL_PIXELFORMAT_RGBA32);
+        if (srcSurface && dstSurface) {
+            SDL_SetSurfaceBlendMode(srcSurface, SDL_BLENDMODE_BLEND);
+            double before = measureMs(iterations, [&]() { SDL_BlitSurface(srcSurface, nullptr, dstSurface, nullptr); });
+            double after = measureMs(iterations, [&]() {
+                for (int y = 0; y < kSize; y++) {
+                    RasterKernels::blitSpan(b.row(y), src.row(y), kSize);
+                }
+            });
+            // SDL 블리터는 255 나눗셈을 근사하므로 값 비교 없이 속도만 표시
+            report("alpha blit 512x512", before, after, true);
+        }
+        if (srcSurface) SDL_FreeSurface(srcSurface);
+        if (dstSurface) SDL_FreeSurface(dstSurface);
+    }
+
+    return 0;
+}